@@ -21,7 +21,7 @@ public:
         ::Texture2D texture,
         ::Rectangle* recs = nullptr,
         ::GlyphInfo* glyphs = nullptr)
-        : ::Font{baseSize, glyphCount, glyphPadding, texture, recs, glyphs} {
+        : ::Font{baseSize, glyphCount, glyphPadding, texture, recs, glyphs, nullptr} {
         // Nothing.
     }
 
@@ -93,6 +93,7 @@ public:
         other.texture = {};
         other.recs = nullptr;
         other.glyphs = nullptr;
+        other.lookup = nullptr;
     }
 
     ~Font() { Unload(); }
@@ -143,6 +144,7 @@ public:
         other.texture = {};
         other.recs = nullptr;
         other.glyphs = nullptr;
+        other.lookup = nullptr;
 
         return *this;
     }
@@ -323,6 +325,7 @@ protected:
         texture = font.texture;
         recs = font.recs;
         glyphs = font.glyphs;
+        lookup = font.lookup;
     }
 };
 } // namespace raylib
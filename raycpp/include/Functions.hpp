@@ -157,6 +157,19 @@ namespace raylib {
     return output;
 }
 
+/**
+ * Get filenames in a directory path, with extension filtering and recursive directory scan
+ *
+ * Use "DIR" in the filter string to include directories in the result.
+ */
+[[maybe_unused]] RLCPPAPI std::vector<std::string>
+LoadDirectoryFiles(const std::string& basePath, const std::string& filter, bool scanSubdirs = false) {
+    FilePathList files = ::RLLoadDirectoryFilesEx(basePath.c_str(), filter.empty() ? nullptr : filter.c_str(), scanSubdirs);
+    std::vector<std::string> output(files.paths, files.paths + files.count);
+    ::RLUnloadDirectoryFiles(files);
+    return output;
+}
+
 /**
  * Change working directory, return true on success
  */
@@ -13,6 +13,10 @@ namespace raylib {
  * Image type, bpp always RGBA (32bit)
  *
  * Data stored in CPU memory (RAM)
+ *
+ * Define RAYLIB_CPP_MOVE_ONLY to forbid implicit deep copies, use Clone() instead.
+ *
+ * @see raylib::ImageView
  */
 class Image : public ::Image {
 public:
@@ -88,7 +92,14 @@ public:
         set(::RLImageTextEx(font, text.c_str(), fontSize, spacing, tint));
     }
 
+#if defined(RAYLIB_CPP_MOVE_ONLY)
+    /**
+     * Explicitly forbid the copy constructor, use Clone() to duplicate image data.
+     */
+    Image(const Image&) = delete;
+#else
     Image(const Image& other) { set(other.Copy()); }
+#endif
 
     Image(Image&& other) {
         set(other);
@@ -178,6 +189,12 @@ public:
         return *this;
     }
 
+#if defined(RAYLIB_CPP_MOVE_ONLY)
+    /**
+     * Explicitly forbid copy assignment, use Clone() to duplicate image data.
+     */
+    Image& operator=(const Image&) = delete;
+#else
     Image& operator=(const Image& other) {
         if (this == &other) {
             return *this;
@@ -188,6 +205,7 @@ public:
 
         return *this;
     }
+#endif
 
     Image& operator=(Image&& other) noexcept {
         if (this == &other) {
@@ -349,6 +367,11 @@ public:
      */
     ::Image Copy() const { return ::RLImageCopy(*this); }
 
+    /**
+     * Create an image duplicate, owning its own data
+     */
+    Image Clone() const { return Image(::RLImageCopy(*this)); }
+
     /**
      * Create an image from another image piece
      */
@@ -0,0 +1,86 @@
+#ifndef RAYLIB_CPP_INCLUDE_IMAGEVIEW_HPP_
+#define RAYLIB_CPP_INCLUDE_IMAGEVIEW_HPP_
+
+#include <string>
+
+#include "./Color.hpp"
+#include "./Image.hpp"
+#include "./RaylibException.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Non-owning view of image data, it never allocates nor unloads pixel data.
+ *
+ * Wraps existing pixel buffers to be used with raylib functions, copying a view
+ * only copies the description. Use Clone() to get an owning raylib::Image.
+ *
+ * @see raylib::Image
+ */
+class ImageView : public ::Image {
+public:
+    ImageView(
+        void* data = nullptr,
+        int width = 0,
+        int height = 0,
+        int mipmaps = 1,
+        int format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8)
+        : ::Image{data, width, height, mipmaps, format} {
+        // Nothing.
+    }
+
+    /**
+     * View the data of the given image, the image must outlive the view.
+     */
+    ImageView(const ::Image& image) : ::Image{image.data, image.width, image.height, image.mipmaps, image.format} {
+        // Nothing.
+    }
+
+    GETTER(void*, Data, data)
+    GETTER(int, Width, width)
+    GETTER(int, Height, height)
+    GETTER(int, Mipmaps, mipmaps)
+    GETTER(int, Format, format)
+
+    /**
+     * Retrieve the width and height of the image.
+     */
+    ::Vector2 GetSize() const { return {static_cast<float>(width), static_cast<float>(height)}; }
+
+    /**
+     * Returns the pixel data size based on the current image.
+     */
+    int GetPixelDataSize() const { return ::RLGetPixelDataSize(width, height, format); }
+
+    /**
+     * Get image pixel color at (x, y) position
+     */
+    raylib::Color GetColor(int x = 0, int y = 0) const { return ::RLGetImageColor(*this, x, y); }
+
+    /**
+     * Export image data to file
+     *
+     * @throws raylib::RaylibException Thrown if the image failed to export to the file.
+     */
+    void Export(const std::string& fileName) const {
+        if (!::RLExportImage(*this, fileName.c_str())) {
+            throw RaylibException(RLTextFormat("Failed to export Image to file: %s", fileName.c_str()));
+        }
+    }
+
+    /**
+     * Create an image duplicate, owning its own data
+     */
+    Image Clone() const { return Image(::RLImageCopy(*this)); }
+
+    /**
+     * Retrieve whether or not the viewed data is a valid image.
+     */
+    bool IsValid() const { return ::RLIsImageValid(*this); }
+};
+} // namespace raylib
+
+using RImageView = raylib::ImageView;
+
+#endif // RAYLIB_CPP_INCLUDE_IMAGEVIEW_HPP_
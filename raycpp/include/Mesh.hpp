@@ -1,6 +1,7 @@
 #ifndef RAYLIB_CPP_INCLUDE_MESH_HPP_
 #define RAYLIB_CPP_INCLUDE_MESH_HPP_
 
+#include <cstring>
 #include <string>
 #include <vector>
 
@@ -51,6 +52,8 @@ public:
         other.animNormals = nullptr;
         other.boneIds = nullptr;
         other.boneWeights = nullptr;
+        other.boneMatrices = nullptr;
+        other.boneCount = 0;
         other.vaoId = 0;
         other.vboId = nullptr;
     }
@@ -76,6 +79,8 @@ public:
         other.animNormals = nullptr;
         other.boneIds = nullptr;
         other.boneWeights = nullptr;
+        other.boneMatrices = nullptr;
+        other.boneCount = 0;
         other.vaoId = 0;
         other.vboId = nullptr;
 
@@ -83,6 +88,45 @@ public:
     }
 
     ~Mesh() { Unload(); }
+
+    /**
+     * Create a mesh duplicate, owning its own vertex data (CPU)
+     *
+     * NOTE: Duplicate is not uploaded to GPU, use Upload() if required.
+     */
+    Mesh Clone() const {
+        ::Mesh mesh{};
+        mesh.vertexCount = vertexCount;
+        mesh.triangleCount = triangleCount;
+        mesh.vertices = CloneData(vertices, vertexCount*3);
+        mesh.texcoords = CloneData(texcoords, vertexCount*2);
+        mesh.texcoords2 = CloneData(texcoords2, vertexCount*2);
+        mesh.normals = CloneData(normals, vertexCount*3);
+        mesh.tangents = CloneData(tangents, vertexCount*4);
+        mesh.colors = CloneData(colors, vertexCount*4);
+        mesh.indices = CloneData(indices, triangleCount*3);
+        mesh.animVertices = CloneData(animVertices, vertexCount*3);
+        mesh.animNormals = CloneData(animNormals, vertexCount*3);
+        mesh.boneIds = CloneData(boneIds, vertexCount*4);
+        mesh.boneWeights = CloneData(boneWeights, vertexCount*4);
+        mesh.boneMatrices = CloneData(boneMatrices, boneCount);
+        mesh.boneCount = boneCount;
+
+        return Mesh(mesh);
+    }
+private:
+    template <typename T> static T* CloneData(const T* data, int count) {
+        if (data == nullptr || count <= 0) {
+            return nullptr;
+        }
+
+        T* result = static_cast<T*>(::MemAlloc(static_cast<unsigned int>(count*sizeof(T))));
+        if (result != nullptr) {
+            std::memcpy(result, data, count*sizeof(T));
+        }
+
+        return result;
+    }
 };
 } // namespace raylib
 
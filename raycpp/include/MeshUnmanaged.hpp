@@ -146,9 +146,11 @@ public:
      * Unload mesh from memory (RAM and/or VRAM)
      */
     void Unload() {
-        if (vboId != nullptr) {
+        // Meshes not uploaded to GPU (i.e. cloned) still own CPU data
+        if ((vboId != nullptr) || (vertices != nullptr)) {
             ::RLUnloadMesh(*this);
             vboId = nullptr;
+            vertices = nullptr;
         }
     }
 
@@ -208,6 +210,11 @@ public:
      */
     operator raylib::BoundingBox() { return BoundingBox(); }
 
+    /**
+     * Load bounding volume hierarchy for fast ray queries, must be unloaded with UnloadMeshBVH()
+     */
+    ::MeshBVH LoadBVH() const { return ::RLLoadMeshBVH(*this); }
+
     /**
      * Compute mesh tangents
      */
@@ -246,6 +253,8 @@ protected:
         animNormals = mesh.animNormals;
         boneIds = mesh.boneIds;
         boneWeights = mesh.boneWeights;
+        boneMatrices = mesh.boneMatrices;
+        boneCount = mesh.boneCount;
         vaoId = mesh.vaoId;
         vboId = mesh.vboId;
     }
@@ -2,6 +2,7 @@
 #define RAYLIB_CPP_INCLUDE_MODEL_HPP_
 
 #include <string>
+#include <vector>
 
 #include "./RaylibException.hpp"
 #include "./raylib-cpp-utils.hpp"
@@ -135,6 +136,22 @@ public:
         return *this;
     }
 
+    /**
+     * Update model animation pose from bone transforms (CPU)
+     */
+    Model& UpdateAnimationPose(const std::vector<::Transform>& pose) {
+        ::RLUpdateModelAnimationPose(*this, pose.data());
+        return *this;
+    }
+
+    /**
+     * Update model mesh bone matrices from bone transforms (GPU skinning)
+     */
+    Model& UpdateAnimationPoseBones(const std::vector<::Transform>& pose) {
+        ::RLUpdateModelAnimationPoseBones(*this, pose.data());
+        return *this;
+    }
+
     /**
      * Check model animation skeleton match
      */
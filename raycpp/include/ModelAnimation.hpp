@@ -91,6 +91,58 @@ public:
         return *this;
     }
 
+    /**
+     * Update model animation pose at a fractional frame (interpolated)
+     */
+    ModelAnimation& Update(const ::Model& model, float frame, std::vector<::Transform>& pose) {
+        Sample(frame, pose);
+        ::RLUpdateModelAnimationPose(model, pose.data());
+        return *this;
+    }
+
+    /**
+     * Sample animation pose at a fractional frame (interpolated)
+     */
+    std::vector<::Transform> Sample(float frame) const {
+        std::vector<::Transform> pose(static_cast<size_t>(boneCount));
+        ::RLSampleModelAnimation(*this, frame, pose.data());
+        return pose;
+    }
+
+    /**
+     * Sample animation pose at a fractional frame (interpolated), reusing pose storage
+     */
+    void Sample(float frame, std::vector<::Transform>& pose) const {
+        pose.resize(static_cast<size_t>(boneCount));
+        ::RLSampleModelAnimation(*this, frame, pose.data());
+    }
+
+    /**
+     * Sample animation and blend it over pose, boneMask (one value per bone) is optional
+     */
+    ModelAnimation& BlendLayer(float frame, float weight, std::vector<::Transform>& pose,
+            const std::vector<float>& boneMask = {}) {
+        pose.resize(static_cast<size_t>(boneCount));
+        ::RLBlendModelAnimationLayer(*this, frame, weight, boneMask.empty() ? nullptr : boneMask.data(), pose.data());
+        return *this;
+    }
+
+    /**
+     * Sample multiple animations and blend them by weight
+     */
+    static std::vector<::Transform> Blend(const std::vector<::ModelAnimation>& animations,
+            const std::vector<float>& frames, const std::vector<float>& weights) {
+        std::vector<::Transform> pose;
+        if (animations.empty() || (frames.size() < animations.size()) || (weights.size() < animations.size())) {
+            return pose;
+        }
+
+        pose.resize(static_cast<size_t>(animations[0].boneCount));
+        ::RLBlendModelAnimations(animations.data(), frames.data(), weights.data(),
+            static_cast<int>(animations.size()), pose.data());
+        return pose;
+    }
+
     /**
      * Check model animation skeleton match
      */
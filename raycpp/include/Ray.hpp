@@ -52,6 +52,13 @@ public:
         return ::RLGetRayCollisionMesh(*this, mesh, transform);
     }
 
+    /**
+     * Get collision information between ray and mesh, using mesh BVH
+     */
+    RayCollision GetCollision(const ::MeshBVH& bvh, const ::Matrix& transform) const {
+        return ::RLGetRayCollisionMeshBVH(*this, bvh, transform);
+    }
+
     /**
      * Get collision info between ray and triangle
      */
@@ -2,6 +2,7 @@
 #define RAYLIB_CPP_INCLUDE_TEXT_HPP_
 
 #include <string>
+#include <utility>
 
 #include "./RaylibException.hpp"
 #include "./raylib-cpp-utils.hpp"
@@ -38,6 +39,11 @@ public:
      */
     float spacing;
 
+    /**
+     * The width to wrap words at (0 for no wrapping).
+     */
+    float wrapWidth = 0;
+
     /**
      * Initializes a new Text object.
      *
@@ -89,25 +95,63 @@ public:
     GETTERSETTER(::Font, Font, font)
     GETTERSETTER(::Color, Color, color)
     GETTERSETTER(float, Spacing, spacing)
+    GETTERSETTER(float, WrapWidth, wrapWidth)
+
+    Text(const Text& other)
+        : text(other.text)
+        , fontSize(other.fontSize)
+        , color(other.color)
+        , font(other.font)
+        , spacing(other.spacing)
+        , wrapWidth(other.wrapWidth) {
+        // Layout is not shared, laid out again on first use.
+    }
+
+    Text(Text&& other) noexcept
+        : text(std::move(other.text))
+        , fontSize(other.fontSize)
+        , color(other.color)
+        , font(other.font)
+        , spacing(other.spacing)
+        , wrapWidth(other.wrapWidth)
+        , run(other.run)
+        , runText(std::move(other.runText))
+        , runFont(other.runFont)
+        , runWrapWidth(other.runWrapWidth) {
+        other.run = {};
+    }
+
+    ~Text() { ::RLUnloadTextRun(run); }
 
     /**
-     * Draw text with values in class.
+     * Get the text laid out as a text run, laid out again when text, font, size, spacing, wrap width or line spacing changed.
+     *
+     * @see ::LoadTextRun
      */
-    void Draw(const ::Vector2& position) const {
-        ::RLDrawTextEx(font, text.c_str(), position, fontSize, spacing, color);
+    const ::TextRun& GetRun() const {
+        if (!::RLIsTextRunValid(run) || (runText != text) || (runFont.glyphs != font.glyphs) ||
+            (runFont.texture.id != font.texture.id) || (run.fontSize != fontSize) || (run.spacing != spacing) ||
+            (runWrapWidth != wrapWidth) || (run.lineSpacing != ::RLGetTextLineSpacing())) {
+            ::RLUnloadTextRun(run);
+            run = ::RLLoadTextRun(font, text.c_str(), fontSize, spacing, wrapWidth);
+            runText = text;
+            runFont = font;
+            runWrapWidth = wrapWidth;
+        }
+
+        return run;
     }
 
     /**
-     * Draw text with values in class.
+     * Draw text with values in class, using the text layout.
+     */
+    void Draw(const ::Vector2& position) const { ::RLDrawTextRun(GetRun(), position, color); }
+
+    /**
+     * Draw text with values in class, using the text layout.
      */
     void Draw(int posX, int posY) const {
-        ::RLDrawTextEx(
-            font,
-            text.c_str(),
-            {static_cast<float>(posX), static_cast<float>(posY)},
-            fontSize,
-            spacing,
-            color);
+        ::RLDrawTextRun(GetRun(), {static_cast<float>(posX), static_cast<float>(posY)}, color);
     }
 
     /**
@@ -125,9 +169,9 @@ public:
     int Measure() const { return ::RLMeasureText(text.c_str(), static_cast<int>(fontSize)); }
 
     /**
-     * Measure string size for Font
+     * Measure string size for Font, from the text layout (wrapped size if wrap width is set)
      */
-    Vector2 MeasureEx() const { return ::RLMeasureTextEx(font, text.c_str(), fontSize, spacing); }
+    Vector2 MeasureEx() const { return GetRun().size; }
 
     Text& operator=(const Text& other) {
         if (this == &other) {
@@ -139,6 +183,30 @@ public:
         color = other.color;
         font = other.font;
         spacing = other.spacing;
+        wrapWidth = other.wrapWidth;
+
+        return *this;
+    }
+
+    Text& operator=(Text&& other) noexcept {
+        if (this == &other) {
+            return *this;
+        }
+
+        ::RLUnloadTextRun(run);
+
+        text = std::move(other.text);
+        fontSize = other.fontSize;
+        color = other.color;
+        font = other.font;
+        spacing = other.spacing;
+        wrapWidth = other.wrapWidth;
+        run = other.run;
+        runText = std::move(other.runText);
+        runFont = other.runFont;
+        runWrapWidth = other.runWrapWidth;
+
+        other.run = {};
 
         return *this;
     }
@@ -193,6 +261,14 @@ public:
         const ::Color& color) {
         ::RLDrawTextPro(font, text.c_str(), position, origin, rotation, fontSize, spacing, color);
     }
+protected:
+    /**
+     * Text layout, and the values it was laid out with.
+     */
+    mutable ::TextRun run{};
+    mutable std::string runText;
+    mutable ::Font runFont{};
+    mutable float runWrapWidth = 0;
 };
 } // namespace raylib
 
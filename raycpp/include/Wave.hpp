@@ -10,6 +10,10 @@
 namespace raylib {
 /**
  * Wave type, defines audio wave data
+ *
+ * Define RAYLIB_CPP_MOVE_ONLY to forbid implicit deep copies, use Clone() instead.
+ *
+ * @see raylib::WaveView
  */
 class Wave : public ::Wave {
 public:
@@ -41,7 +45,14 @@ public:
         Load(fileType, fileData, dataSize);
     }
 
+#if defined(RAYLIB_CPP_MOVE_ONLY)
+    /**
+     * Explicitly forbid the copy constructor, use Clone() to duplicate wave data.
+     */
+    Wave(const Wave&) = delete;
+#else
     Wave(const Wave& other) { set(other.Copy()); }
+#endif
 
     Wave(Wave&& other) {
         set(other);
@@ -69,6 +80,12 @@ public:
         return *this;
     }
 
+#if defined(RAYLIB_CPP_MOVE_ONLY)
+    /**
+     * Explicitly forbid copy assignment, use Clone() to duplicate wave data.
+     */
+    Wave& operator=(const Wave&) = delete;
+#else
     Wave& operator=(const Wave& other) {
         if (this == &other) {
             return *this;
@@ -79,9 +96,10 @@ public:
 
         return *this;
     }
+#endif
 
     Wave& operator=(Wave&& other) noexcept {
-        if (this != &other) {
+        if (this == &other) {
             return *this;
         }
 
@@ -102,6 +120,11 @@ public:
      */
     ::Wave Copy() const { return ::RLWaveCopy(*this); }
 
+    /**
+     * Create a wave duplicate, owning its own data
+     */
+    Wave Clone() const { return Wave(::RLWaveCopy(*this)); }
+
     /**
      * Crop a wave to defined samples range
      */
@@ -0,0 +1,68 @@
+#ifndef RAYLIB_CPP_INCLUDE_WAVEVIEW_HPP_
+#define RAYLIB_CPP_INCLUDE_WAVEVIEW_HPP_
+
+#include <string>
+
+#include "./Wave.hpp"
+#include "./raylib-cpp-utils.hpp"
+#include "./raylib.hpp"
+
+namespace raylib {
+/**
+ * Non-owning view of wave data, it never allocates nor unloads samples data.
+ *
+ * Wraps existing samples buffers to be used with raylib functions, copying a view
+ * only copies the description. Use Clone() to get an owning raylib::Wave.
+ *
+ * @see raylib::Wave
+ */
+class WaveView : public ::Wave {
+public:
+    WaveView(
+        unsigned int frameCount = 0,
+        unsigned int sampleRate = 0,
+        unsigned int sampleSize = 0,
+        unsigned int channels = 0,
+        void* data = nullptr)
+        : ::Wave{frameCount, sampleRate, sampleSize, channels, data} {
+        // Nothing.
+    }
+
+    /**
+     * View the data of the given wave, the wave must outlive the view.
+     */
+    WaveView(const ::Wave& wave) : ::Wave{wave.frameCount, wave.sampleRate, wave.sampleSize, wave.channels, wave.data} {
+        // Nothing.
+    }
+
+    GETTER(unsigned int, FrameCount, frameCount)
+    GETTER(unsigned int, SampleRate, sampleRate)
+    GETTER(unsigned int, SampleSize, sampleSize)
+    GETTER(unsigned int, Channels, channels)
+    GETTER(void*, Data, data)
+
+    /**
+     * Export wave data to file, returns true on success
+     */
+    bool Export(const std::string& fileName) const { return ::RLExportWave(*this, fileName.c_str()); }
+
+    /**
+     * Load sound from wave data
+     */
+    ::Sound LoadSound() const { return ::RLLoadSoundFromWave(*this); }
+
+    /**
+     * Create a wave duplicate, owning its own data
+     */
+    Wave Clone() const { return Wave(::RLWaveCopy(*this)); }
+
+    /**
+     * Retrieve whether or not the viewed data is a valid wave.
+     */
+    bool IsValid() const { return ::RLIsWaveValid(*this); }
+};
+} // namespace raylib
+
+using RWaveView = raylib::WaveView;
+
+#endif // RAYLIB_CPP_INCLUDE_WAVEVIEW_HPP_
@@ -44,6 +44,7 @@
 #include "./Functions.hpp"
 #include "./Gamepad.hpp"
 #include "./Image.hpp"
+#include "./ImageView.hpp"
 #include "./Keyboard.hpp"
 #include "./Material.hpp"
 #include "./Matrix.hpp"
@@ -68,6 +69,7 @@
 #include "./Vector4.hpp"
 #include "./VrStereoConfig.hpp"
 #include "./Wave.hpp"
+#include "./WaveView.hpp"
 #include "./Window.hpp"
 
 /**
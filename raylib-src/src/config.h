@@ -62,10 +62,13 @@
 #define SUPPORT_SCREEN_CAPTURE          1
 // Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
 #define SUPPORT_GIF_RECORDING           1
-// Support CompressData() and DecompressData() functions
+// Support CompressData() and DecompressData() functions and compression streams
 #define SUPPORT_COMPRESSION_API         1
 // Support automatic generated events, loading and recording of those events when required
 #define SUPPORT_AUTOMATION_EVENTS       1
+// Scan directories recursively on job workers [LoadDirectoryFilesEx()], requires SUPPORT_THREADED_JOBS
+// NOTE: Only on POSIX systems, directories are opened relative to base directory [openat()]
+#define SUPPORT_DIRECTORY_PARALLEL_SCAN 1
 // Support custom frame control, only for advanced users
 // By default EndDrawing() does this job: draws everything + SwapScreenBuffer() + manage frame timing + PollInputEvents()
 // Enabling this flag allows manual control of the frame processes, use at your own risk
@@ -74,7 +77,6 @@
 
 // rcore: Configuration values
 //------------------------------------------------------------------------------------
-#define MAX_FILEPATH_CAPACITY        8192       // Maximum file paths capacity
 #define MAX_FILEPATH_LENGTH          4096       // Maximum length for filepaths (Linux PATH_MAX default value)
 
 #define MAX_KEYBOARD_KEYS             512       // Maximum number of keyboard keys supported
@@ -87,7 +89,7 @@
 #define MAX_KEY_PRESSED_QUEUE          16       // Maximum number of keys in the key input queue
 #define MAX_CHAR_PRESSED_QUEUE         16       // Maximum number of characters in the char input queue
 
-#define MAX_DECOMPRESSION_SIZE         64       // Max size allocated for decompression in MB
+#define COMPRESSION_PARALLEL_BLOCK_SIZE  1048576 // Data block size compressed independently on job workers [CompressData()]
 
 #define MAX_AUTOMATION_EVENTS       16384       // Maximum number of automation events to record
 
@@ -101,12 +103,17 @@
 // Show OpenGL extensions and capabilities detailed logs on init
 //#define RLGL_SHOW_GL_DETAILS_INFO              1
 
+// Use interleaved vertex layout for render batches, persistently mapped if GL_ARB_buffer_storage is supported
+//#define RLGL_ENABLE_BATCH_INTERLEAVED          1
+
 #define RL_SUPPORT_MESH_GPU_SKINNING           1      // GPU skinning, comment if your GPU does not support more than 8 VBOs
 
 //#define RL_DEFAULT_BATCH_BUFFER_ELEMENTS    4096    // Default internal render batch elements limits
 #define RL_DEFAULT_BATCH_BUFFERS               1      // Default number of batch buffers (multi-buffering)
 #define RL_DEFAULT_BATCH_DRAWCALLS           256      // Default number of batch draw calls (by state changes: mode, texture)
 #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS     4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+#define RL_DEFAULT_BATCH_TEXTURE_SLOTS         8      // Maximum number of textures sampled by one batch draw call with default shader (1 to disable, max 8)
+#define RL_DEFAULT_BATCH_MAPPED_BUFFERS        3      // Minimum number of batch buffers if persistently mapped (RLGL_ENABLE_BATCH_INTERLEAVED)
 
 #define RL_MAX_MATRIX_STACK_SIZE              32      // Maximum size of internal Matrix stack
 
@@ -186,6 +193,13 @@
 // Support multiple image editing functions to scale, adjust colors, flip, draw on images, crop...
 // If not defined, still some functions are supported: ImageFormat(), ImageCrop(), ImageToPOT()
 #define SUPPORT_IMAGE_MANIPULATION      1
+// Use SIMD kernels (SSE2/NEON, if available on target) for image filtering: ImageBlurGaussian(), ImageKernelConvolution(), and format conversion: ImageFormat()
+#define SUPPORT_SIMD_FILTERING          1
+
+// rtextures: Configuration values
+//------------------------------------------------------------------------------------
+#define IMAGE_FILTER_BATCH_ROWS        32       // Image rows filtered per band (and minimum per worker batch): ImageBlurGaussian(), ImageKernelConvolution()
+#define IMAGE_FILTER_STRIP_COLUMNS     16       // Image columns blurred together on vertical passes (cache blocking): ImageBlurGaussian()
 
 
 //------------------------------------------------------------------------------------
@@ -208,11 +222,19 @@
 // drawing text and shapes with a single draw call [SetShapesTexture()].
 #define SUPPORT_FONT_ATLAS_WHITE_REC    1
 
+// Keep recently drawn texts laid out as text runs [DrawTextEx()], texts up to MAX_TEXT_BUFFER_LENGTH bytes,
+// repeated texts skip codepoints decoding, glyphs lookup and layout, drawn with a single texture change
+#define SUPPORT_TEXT_RUN_CACHE          1
+
 // rtext: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TEXT_BUFFER_LENGTH       1024       // Size of internal static buffers used on some functions:
                                                 // TextFormat(), TextSubtext(), TextToUpper(), TextToLower(), TextToPascal(), TextSplit()
 #define MAX_TEXTSPLIT_COUNT           128       // Maximum number of substrings to split: TextSplit()
+#define FONT_RASTER_BATCH_GLYPHS       16       // Glyphs rasterized per worker batch: LoadFontData()
+#define FONT_CACHE_DEFAULT_GLYPHS    1024       // Dynamic font default glyphs cache capacity: LoadFontDynamic()
+#define FONT_CACHE_ATLAS_PAGES          4       // Dynamic font atlas pages, least recently used page evicted when full: LoadFontDynamic()
+#define TEXT_RUN_CACHE_SIZE            64       // Text runs kept by DrawTextEx() cache (power of two), direct mapped by text hash
 
 
 //------------------------------------------------------------------------------------
@@ -225,13 +247,24 @@
 #define SUPPORT_FILEFORMAT_GLTF         1
 #define SUPPORT_FILEFORMAT_VOX          1
 #define SUPPORT_FILEFORMAT_M3D          1
+#define SUPPORT_FILEFORMAT_RANIM        1       // Compressed animations (.ranim), loaded by LoadModelAnimations()
 // Support procedural mesh generation functions, uses external par_shapes.h library
 // NOTE: Some generated meshes DO NOT include generated texture coordinates
 #define SUPPORT_MESH_GENERATION         1
+// Use SIMD kernels (SSE2/NEON, if available on target) for CPU skinning on UpdateModelAnimation()
+#define SUPPORT_SIMD_SKINNING           1
 
 // rmodels: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_MATERIAL_MAPS              12       // Maximum number of shader maps supported
+#define SKINNING_BATCH_VERTICES      4096       // Minimum vertices per worker batch on CPU skinning
+#define GLTF_ANIMDELAY                 17       // glTF animations baking frame delay in ms (~60 FPS), i.e. 33 (~30 FPS) to reduce memory, use SampleModelAnimation() for smooth playback
+#define GLTF_ANIM_BATCH_BONES           4       // glTF animations bones baked per worker batch (all frames of every bone)
+#define GLTF_ANIM_BATCH_FRAMES         64       // glTF animations frames built from parent joints per worker batch
+#define M3D_ANIMDELAY                  17       // M3D animations baking frame delay in ms (~60 FPS)
+#define MESH_BVH_LEAF_TRIANGLES         4       // Maximum triangles per mesh BVH leaf node (when splitting is not worth it)
+#define MESH_BVH_PARALLEL_TRIANGLES  8192       // Triangles per mesh BVH subtree built as a separate worker job
+#define INSTANCE_BUFFER_RING_SEGMENTS   3       // Instance buffer segments used round-robin on INSTANCE_BUFFER_RING mode (frames in flight)
 
 #ifdef RL_SUPPORT_MESH_GPU_SKINNING
 #define MAX_MESH_VERTEX_BUFFERS         9       // Maximum vertex buffers (VBO) per mesh
@@ -250,6 +283,11 @@
 //#define SUPPORT_FILEFORMAT_FLAC         1
 #define SUPPORT_FILEFORMAT_XM           1
 #define SUPPORT_FILEFORMAT_MOD          1
+// Use SIMD kernels (SSE/AVX/NEON, if available on target) for voices mixing
+#define SUPPORT_SIMD_MIXING             1
+// Support music streams decoding on a background thread, enabled with SetMusicDecoderThreaded()
+// NOTE: Music streams loaded afterwards are decoded ahead, UpdateMusicStream() just checks stream end
+#define SUPPORT_MUSIC_DECODER_THREAD    1
 
 // raudio: Configuration values
 //------------------------------------------------------------------------------------
@@ -258,20 +296,35 @@
 #define AUDIO_DEVICE_SAMPLE_RATE           0    // Device sample rate (device default)
 
 #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels
+#define AUDIO_COMMAND_QUEUE_SIZE        1024    // Audio mixer commands queue size (power of two)
+#define AUDIO_MIXER_BLOCK_FRAMES        2048    // Audio mixer frames read per voice at once
+#define MUSIC_DECODER_READAHEAD_MS       500    // Music decoded ahead per stream on background decoding (default, in milliseconds)
+#define MUSIC_DECODER_CHUNK_FRAMES      4096    // Music decoder maximum frames decoded per stream on every update
+#define MUSIC_DECODER_INTERVAL_MS          5    // Music decoder thread sleep time between updates (in milliseconds)
 
 //------------------------------------------------------------------------------------
 // Module: utils - Configuration Flags
 //------------------------------------------------------------------------------------
 // Standard file io library (stdio.h) included
 #define SUPPORT_STANDARD_FILEIO         1
+// Map files read-only in memory for assets loading (images, fonts, sounds, models), instead of reading a copy
+// NOTE: If not defined or not available on platform (Android, Web), files are loaded with LoadFileData()
+#define SUPPORT_FILE_MAPPING            1
 // Show TRACELOG() output messages
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG                1
 //#define SUPPORT_TRACELOG_DEBUG          1
+// Use a pool of worker threads for data-parallel processing (i.e. CPU skinning)
+// NOTE: If not defined, parallel jobs run serially on the calling thread
+#define SUPPORT_THREADED_JOBS           1
 
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define MAX_JOB_WORKER_THREADS          8       // Max number of worker threads for parallel jobs
+#define MAX_BACKGROUND_JOBS            64       // Max number of background jobs queued at once
+#define MAX_MOUNTED_ASSET_PACKS         8       // Max number of asset packs mounted at once
+#define ASSET_PACK_DATA_ALIGNMENT      64       // Asset pack files data alignment on export (bytes, power of two)
 
 
 // Enable partial support for clipboard image, only working on SDL3 or
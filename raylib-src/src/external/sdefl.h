@@ -168,6 +168,15 @@ extern int sdefl_bound(int in_len);
 extern int sdeflate(struct sdefl *s, void *o, const void *i, int n, int lvl);
 extern int zsdeflate(struct sdefl *s, void *o, const void *i, int n, int lvl);
 
+// raylib: added streaming compression, input is compressed in ranges of a buffer
+// where previous SDEFL_WIN_SIZ bytes are available for matching, pending bits are kept
+// in state between ranges (output is only byte aligned after last range or a sync)
+extern void sdefl_begin(struct sdefl *s);
+extern void sdefl_prime(struct sdefl *s, const void *i, int begin, int end);
+extern void sdefl_shift(struct sdefl *s, int off);
+extern int sdeflate_range(struct sdefl *s, void *o, const void *i, int begin, int end, int is_last, int lvl);
+extern int sdefl_sync(struct sdefl *s, void *o);
+
 #ifdef __cplusplus
 }
 #endif
@@ -661,15 +670,19 @@ sdefl_fnd(struct sdefl_match *m, const struct sdefl *s, int chain_len,
 }
 static int
 sdefl_compr(struct sdefl *s, unsigned char *out, const unsigned char *in,
-            int in_len, int lvl) {
+            int in_begin, int in_len, int is_last, int lvl) {
   unsigned char *q = out;
   static const unsigned char pref[] = {8,10,14,24,30,48,65,96,130};
   int max_chain = (lvl < 8) ? (1 << (lvl + 1)): (1 << 13);
-  int n, i = 0, litlen = 0;
-  for (n = 0; n < SDEFL_HASH_SIZ; ++n) {
-    s->tbl[n] = SDEFL_NIL;
-  }
-  do {int blk_begin = i;
+  int i = in_begin, litlen = 0;
+  if (i >= in_len) {
+    /* raylib: no input, only final block required (empty fixed huffman block) */
+    if (is_last) {
+      sdefl_put(&q, s, 0x01, 1); /* block */
+      sdefl_put(&q, s, 0x01, 2); /* fixed huffman */
+      sdefl_put(&q, s, 0x00, 7); /* end of block */
+    }
+  } else do {int blk_begin = i;
     int blk_end = ((i + SDEFL_BLK_MAX) < in_len) ? (i + SDEFL_BLK_MAX) : in_len;
     while (i < blk_end) {
       struct sdefl_match m = {0};
@@ -718,18 +731,66 @@ sdefl_compr(struct sdefl *s, unsigned char *out, const unsigned char *in,
       sdefl_seq(s, i - litlen, litlen);
       litlen = 0;
     }
-    sdefl_flush(&q, s, blk_end == in_len, in, blk_begin, blk_end);
+    sdefl_flush(&q, s, is_last && (blk_end == in_len), in, blk_begin, blk_end);
   } while (i < in_len);
-  if (s->bitcnt) {
+  if (is_last && s->bitcnt) {
     sdefl_put(&q, s, 0x00, 8 - s->bitcnt);
   }
-  assert(s->bitcnt == 0);
+  assert(!is_last || s->bitcnt == 0);
   return (int)(q - out);
 }
+extern void
+sdefl_begin(struct sdefl *s) {
+  int n;
+  s->bits = s->bitcnt = 0;
+  s->seq_cnt = 0;
+  memset(&s->freq, 0, sizeof(s->freq));
+  for (n = 0; n < SDEFL_HASH_SIZ; ++n) {
+    s->tbl[n] = SDEFL_NIL;
+  }
+}
+extern void
+sdefl_prime(struct sdefl *s, const void *mem, int begin, int end) {
+  const unsigned char *in = (const unsigned char*)mem;
+  int i;
+  for (i = begin; i + SDEFL_MIN_MATCH <= end; ++i) {
+    unsigned h = sdefl_hash32(&in[i]);
+    s->prv[i&SDEFL_WIN_MSK] = s->tbl[h];
+    s->tbl[h] = i;
+  }
+}
+extern void
+sdefl_shift(struct sdefl *s, int off) {
+  /* offset must be a multiple of SDEFL_WIN_SIZ to keep previous matches slots */
+  int n;
+  assert((off & SDEFL_WIN_MSK) == 0);
+  for (n = 0; n < SDEFL_HASH_SIZ; ++n) {
+    s->tbl[n] = (s->tbl[n] >= off) ? s->tbl[n] - off : SDEFL_NIL;
+  }
+  for (n = 0; n < SDEFL_WIN_SIZ; ++n) {
+    s->prv[n] = (s->prv[n] >= off) ? s->prv[n] - off : SDEFL_NIL;
+  }
+}
+extern int
+sdeflate_range(struct sdefl *s, void *out, const void *in, int begin, int end, int is_last, int lvl) {
+  return sdefl_compr(s, (unsigned char*)out, (const unsigned char*)in, begin, end, is_last, lvl);
+}
+extern int
+sdefl_sync(struct sdefl *s, void *out) {
+  unsigned char *q = (unsigned char*)out;
+  sdefl_put(&q, s, 0x00, 1); /* block */
+  sdefl_put(&q, s, 0x00, 2); /* stored block */
+  if (s->bitcnt) {
+    sdefl_put(&q, s, 0x00, 8 - s->bitcnt);
+  }
+  sdefl_put16(&q, 0x0000);
+  sdefl_put16(&q, 0xFFFF);
+  return (int)(q - (unsigned char*)out);
+}
 extern int
 sdeflate(struct sdefl *s, void *out, const void *in, int n, int lvl) {
-  s->bits = s->bitcnt = 0;
-  return sdefl_compr(s, (unsigned char*)out, (const unsigned char*)in, n, lvl);
+  sdefl_begin(s);
+  return sdefl_compr(s, (unsigned char*)out, (const unsigned char*)in, 0, n, 1, lvl);
 }
 static unsigned
 sdefl_adler32(unsigned adler32, const unsigned char *in, int in_len) {
@@ -768,10 +829,10 @@ zsdeflate(struct sdefl *s, void *out, const void *in, int n, int lvl) {
   unsigned a = 0;
   unsigned char *q = (unsigned char*)out;
 
-  s->bits = s->bitcnt = 0;
+  sdefl_begin(s);
   sdefl_put(&q, s, 0x78, 8); /* deflate, 32k window */
   sdefl_put(&q, s, 0x01, 8); /* fast compression */
-  q += sdefl_compr(s, q, (const unsigned char*)in, n, lvl);
+  q += sdefl_compr(s, q, (const unsigned char*)in, 0, n, 1, lvl);
 
   /* append adler checksum */
   a = sdefl_adler32(SDEFL_ADLER_INIT, (const unsigned char*)in, n);
@@ -132,6 +132,14 @@ struct sinfl {
 extern int sinflate(void *out, int cap, const void *in, int size);
 extern int zsinflate(void *out, int cap, const void *in, int size);
 
+// raylib: added block resumable decompression, output and input position are only
+// advanced on complete blocks, so decoding can be resumed with more input or output space
+#define SINFL_STREAM_END      0     /* last block decoded */
+#define SINFL_STREAM_INPUT    1     /* more input required to decode next block */
+#define SINFL_STREAM_OUTPUT   2     /* more output space required to decode next block */
+#define SINFL_STREAM_ERROR  (-1)    /* invalid data */
+extern int sinflate_stream(void *out, int *len, int cap, const void *in, int *bitpos, int size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -223,6 +231,7 @@ sinfl_refill(struct sinfl *s) {
       int byteswant = bitswant >> 3;
       int bytesuse = s->bitend - s->bitptr <= byteswant ? (int)(s->bitend - s->bitptr) : byteswant;
       unsigned long long n = 0;
+      if (bytesuse <= 0) return;    // raylib: input exhausted, bitcnt can be negative
       memcpy(&n, s->bitptr, bytesuse);
       s->bitbuf |= n << s->bitcnt;
       s->bitptr += bytesuse;
@@ -380,7 +389,12 @@ sinfl_decode(struct sinfl *s, const unsigned *tbl, int bit_len) {
   return (key >> 16) & 0x0fff;
 }
 static int
-sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size) {
+sinfl_fail(const struct sinfl *s, int status) {
+  /* raylib: bits were consumed past the end of input, block is not complete yet */
+  return (s->bitcnt < 0) ? SINFL_STREAM_INPUT : status;
+}
+static int
+sinfl_decompress(unsigned char *o, int *olen, int cap, const unsigned char *in, int *bitpos, int size) {
   static const unsigned char order[] = {16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15};
   static const short dbase[30+2] = {1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,
       257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577};
@@ -391,25 +405,33 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
   static const unsigned char lbits[29+2] = {0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,
       4,4,4,5,5,5,5,0,0,0};
 
-  const unsigned char *oe = out + cap;
-  const unsigned char *e = in + size, *o = out;
+  const unsigned char *oe = o + cap;
+  const unsigned char *e = in + size;
+  unsigned char *out = o + *olen;
   enum sinfl_states {hdr,stored,fixed,dyn,blk};
   enum sinfl_states state = hdr;
   struct sinfl s = {0};
   int last = 0;
 
-  s.bitptr = in;
+  s.bitptr = in + (*bitpos >> 3);
   s.bitend = e;     // @raysan5: added
+  sinfl_refill(&s);
+  sinfl_eat(&s, *bitpos & 7);
   while (1) {
     switch (state) {
     case hdr: {
       /* block header */
       int type = 0;
+      /* raylib: previous block complete, commit output and input position */
+      *olen = (int)(out - o);
+      *bitpos = (int)((s.bitptr - in) << 3) - s.bitcnt;
+      if (last) return SINFL_STREAM_END;
       sinfl_refill(&s);
       last = sinfl__get(&s,1);
       type = sinfl__get(&s,2);
+      if (s.bitcnt < 0) return SINFL_STREAM_INPUT;
 
-      switch (type) {default: return (int)(out-o);
+      switch (type) {default: return SINFL_STREAM_ERROR;
       case 0x00: state = stored; break;
       case 0x01: state = fixed; break;
       case 0x02: state = dyn; break;}
@@ -420,17 +442,20 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
       sinfl__get(&s,s.bitcnt & 7);
       len = (unsigned short)sinfl__get(&s,16);
       nlen = (unsigned short)sinfl__get(&s,16);
+      if (s.bitcnt < 0) return SINFL_STREAM_INPUT;
       s.bitptr -= s.bitcnt / 8;
       s.bitbuf = s.bitcnt = 0;
 
+      /* raylib: empty stored blocks are valid, used to align output (flush) */
       if ((unsigned short)len != (unsigned short)~nlen)
-        return (int)(out-o);
-      if (len > (e - s.bitptr) || !len)
-        return (int)(out-o);
+        return SINFL_STREAM_ERROR;
+      if (len > (e - s.bitptr))
+        return SINFL_STREAM_INPUT;
+      if (len > (oe - out))
+        return SINFL_STREAM_OUTPUT;
 
       memcpy(out, s.bitptr, (size_t)len);
       s.bitptr += len, out += len;
-      if (last) return (int)(out-o);
       state = hdr;
     } break;
     case fixed: {
@@ -459,18 +484,26 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
       int nlen = 4 + sinfl__get(&s,4);
       for (n = 0; n < nlen; n++)
         nlens[order[n]] = (unsigned char)sinfl_get(&s,3);
+      if (s.bitcnt < 0) return SINFL_STREAM_INPUT;
       sinfl_build(hlens, nlens, 7, 7, 19);
 
       /* decode code lengths */
       for (n = 0; n < nlit + ndist;) {
         int sym = 0;
+        if (s.bitcnt < 0) return SINFL_STREAM_INPUT;
         sinfl_refill(&s);
         sym = sinfl_decode(&s, hlens, 7);
         switch (sym) {default: lens[n++] = (unsigned char)sym; break;
-        case 16: for (i=3+sinfl_get(&s,2);i;i--,n++) lens[n]=lens[n-1]; break;
-        case 17: for (i=3+sinfl_get(&s,3);i;i--,n++) lens[n]=0; break;
-        case 18: for (i=11+sinfl_get(&s,7);i;i--,n++) lens[n]=0; break;}
+        case 16: i=3+sinfl__get(&s,2); break;
+        case 17: i=3+sinfl__get(&s,3); break;
+        case 18: i=11+sinfl__get(&s,7); break;}
+        if (sym < 16) continue;
+        /* raylib: check repeated lengths fit in table */
+        if ((sym == 16 && !n) || (n + i > nlit + ndist))
+          return sinfl_fail(&s, SINFL_STREAM_ERROR);
+        for (;i;i--,n++) lens[n] = (sym == 16) ? lens[n-1] : 0;
       }
+      if (s.bitcnt < 0) return SINFL_STREAM_INPUT;
       /* build lit/dist tables */
       sinfl_build(s.lits, lens, 10, 15, nlit);
       sinfl_build(s.dsts, lens + nlit, 8, 15, ndist);
@@ -480,40 +513,52 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
       /* decompress block */
       while (1) {
         int sym;
+        if (sinfl_unlikely(s.bitcnt < 0)) {
+          return SINFL_STREAM_INPUT;
+        }
         sinfl_refill(&s);
         sym = sinfl_decode(&s, s.lits, 10);
         if (sym < 256) {
           /* literal */
           if (sinfl_unlikely(out >= oe)) {
-            return (int)(out-o);
+            return sinfl_fail(&s, SINFL_STREAM_OUTPUT);
           }
           *out++ = (unsigned char)sym;
           sym = sinfl_decode(&s, s.lits, 10);
           if (sym < 256) {
+            if (sinfl_unlikely(out >= oe)) {
+              return sinfl_fail(&s, SINFL_STREAM_OUTPUT);
+            }
             *out++ = (unsigned char)sym;
             continue;
           }
         }
         if (sinfl_unlikely(sym == 256)) {
           /* end of block */
-          if (last) return (int)(out-o);
+          if (s.bitcnt < 0) return SINFL_STREAM_INPUT;
           state = hdr;
           break;
         }
         /* match */
         if (sym >= 286) {
           /* length codes 286 and 287 must not appear in compressed data */
-          return (int)(out-o);
+          return sinfl_fail(&s, SINFL_STREAM_ERROR);
         }
         sym -= 257;
-        {int len = sinfl__get(&s, lbits[sym]) + lbase[sym];
-        int dsym = sinfl_decode(&s, s.dsts, 8);
-        int offs = sinfl__get(&s, dbits[dsym]) + dbase[dsym];
-        unsigned char *dst = out, *src = out - offs;
-        if (sinfl_unlikely(offs > (int)(out-o))) {
-          return (int)(out-o);
+        {int mlen = sinfl__get(&s, lbits[sym]) + lbase[sym];
+        int dsym, offs;
+        unsigned char *dst, *src;
+        sinfl_refill(&s);   /* raylib: literal and match can take more bits than a refill */
+        dsym = sinfl_decode(&s, s.dsts, 8);
+        offs = sinfl__get(&s, dbits[dsym]) + dbase[dsym];
+        dst = out, src = out - offs;
+        if (sinfl_unlikely(dsym >= 30 || offs > (int)(out-o))) {
+          return sinfl_fail(&s, SINFL_STREAM_ERROR);
         }
-        out = out + len;
+        if (sinfl_unlikely(mlen > (int)(oe-out))) {
+          return sinfl_fail(&s, SINFL_STREAM_OUTPUT);
+        }
+        out = out + mlen;
 
 #ifndef SINFL_NO_SIMD
         if (sinfl_likely(oe - out >= 16 * 3)) {
@@ -579,11 +624,17 @@ sinfl_decompress(unsigned char *out, int cap, const unsigned char *in, int size)
       }
     } break;}
   }
-  return (int)(out-o);
+  return SINFL_STREAM_ERROR;
 }
 extern int
 sinflate(void *out, int cap, const void *in, int size) {
-  return sinfl_decompress((unsigned char*)out, cap, (const unsigned char*)in, size);
+  int len = 0, bitpos = 0;
+  sinfl_decompress((unsigned char*)out, &len, cap, (const unsigned char*)in, &bitpos, size);
+  return len;
+}
+extern int
+sinflate_stream(void *out, int *len, int cap, const void *in, int *bitpos, int size) {
+  return sinfl_decompress((unsigned char*)out, len, cap, (const unsigned char*)in, bitpos, size);
 }
 static unsigned
 sinfl_adler32(unsigned adler32, const unsigned char *in, int in_len) {
@@ -617,7 +668,7 @@ zsinflate(void *out, int cap, const void *mem, int size) {
   const unsigned char *in = (const unsigned char*)mem;
   if (size >= 6) {
     const unsigned char *eob = in + size - 4;
-    int n = sinfl_decompress((unsigned char*)out, cap, in + 2u, size);
+    int n = sinflate(out, cap, in + 2u, size - 6);
     unsigned a = sinfl_adler32(1u, (unsigned char*)out, n);
     unsigned h = eob[0] << 24 | eob[1] << 16 | eob[2] << 8 | eob[3] << 0;
     return a == h ? n : -1;
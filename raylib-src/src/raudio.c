@@ -28,6 +28,13 @@
 *           Selected desired fileformats to be supported for loading. Some of those formats are
 *           supported by default, to remove support, just comment unrequired #define in this module
 *
+*       #define SUPPORT_SIMD_MIXING
+*           Use SIMD kernels (SSE, AVX or NEON, depending on compilation target) for voices mixing
+*
+*       #define SUPPORT_MUSIC_DECODER_THREAD
+*           Support music streams decoding on a background thread (opt-in, SetMusicDecoderThreaded()),
+*           decoded frames are read by the mixer from a lock-free ring buffer per music stream
+*
 *   DEPENDENCIES:
 *       miniaudio.h  - Audio device management lib (https://github.com/mackron/miniaudio)
 *       stb_vorbis.h - Ogg audio files loading (http://www.nothings.org/stb_vorbis/)
@@ -184,6 +191,19 @@ typedef struct tagBITMAPINFOHEADER {
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>                     // Required for: strcmp() [Used in IsFileExtension(), LoadWaveFromMemory(), LoadMusicStreamFromMemory()]
 
+#if defined(SUPPORT_SIMD_MIXING)
+    #if defined(__AVX__)
+        #define RL_MIXING_AVX
+        #include <immintrin.h>          // Required for: AVX intrinsics [Used in MixAudioFrames()]
+    #elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+        #define RL_MIXING_SSE
+        #include <xmmintrin.h>          // Required for: SSE intrinsics [Used in MixAudioFrames()]
+    #elif defined(__ARM_NEON)
+        #define RL_MIXING_NEON
+        #include <arm_neon.h>           // Required for: NEON intrinsics [Used in MixAudioFrames()]
+    #endif
+#endif
+
 #if defined(RAUDIO_STANDALONE)
     #ifndef TRACELOG
         #define TRACELOG(level, ...)    printf(__VA_ARGS__)
@@ -298,6 +318,31 @@ typedef struct tagBITMAPINFOHEADER {
 #ifndef MAX_AUDIO_BUFFER_POOL_CHANNELS
     #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
 #endif
+#ifndef AUDIO_COMMAND_QUEUE_SIZE
+    #define AUDIO_COMMAND_QUEUE_SIZE        1024    // Audio mixer commands queue size (power of two)
+#endif
+#ifndef AUDIO_MIXER_BLOCK_FRAMES
+    #define AUDIO_MIXER_BLOCK_FRAMES        2048    // Audio mixer frames read per voice at once
+#endif
+#ifndef MUSIC_DECODER_READAHEAD_MS
+    #define MUSIC_DECODER_READAHEAD_MS       500    // Music decoded ahead per stream on background decoding (default, in milliseconds)
+#endif
+#ifndef MUSIC_DECODER_CHUNK_FRAMES
+    #define MUSIC_DECODER_CHUNK_FRAMES      4096    // Music decoder maximum frames decoded per stream on every update
+#endif
+#ifndef MUSIC_DECODER_INTERVAL_MS
+    #define MUSIC_DECODER_INTERVAL_MS          5    // Music decoder thread sleep time between updates (in milliseconds)
+#endif
+
+// No threads available on web platform (unless built with pthreads)
+#if defined(PLATFORM_WEB) && !defined(__EMSCRIPTEN_PTHREADS__)
+    #undef SUPPORT_MUSIC_DECODER_THREAD
+#endif
+
+// Audio buffer program state, playing/paused flags and changes sequence packed in a single atomic value
+#define AUDIO_STATE_PLAYING                  0x1    // Audio buffer state flag: playing
+#define AUDIO_STATE_PAUSED                   0x2    // Audio buffer state flag: paused
+#define AUDIO_STATE_SEQUENCE_SHIFT             2    // Audio buffer state changes sequence, stored above flags
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -338,7 +383,49 @@ typedef enum {
     AUDIO_BUFFER_USAGE_STREAM
 } AudioBufferUsage;
 
+// Audio mixer commands, sent from program to mixer
+// NOTE: Play state commands carry the program state sequence they were requested with
+typedef enum {
+    AUDIO_COMMAND_PLAY = 0,         // Start playing from the beginning
+    AUDIO_COMMAND_STOP,             // Stop playing, cursor moved back to the beginning
+    AUDIO_COMMAND_PAUSE,            // Pause playing
+    AUDIO_COMMAND_RESUME,           // Resume paused playing
+    AUDIO_COMMAND_REWIND,           // Move cursor back to the beginning (stream refilled from scratch)
+    AUDIO_COMMAND_VOLUME,           // Set volume
+    AUDIO_COMMAND_PITCH,            // Set pitch
+    AUDIO_COMMAND_PAN,              // Set pan
+    AUDIO_COMMAND_CALLBACK          // Set audio buffer callback
+} AudioCommandType;
+
+// Audio mixer retired objects, freed once the mixer can not access them anymore
+typedef enum {
+    AUDIO_RETIRED_BUFFER = 0,       // Audio buffer, including data
+    AUDIO_RETIRED_BUFFER_ALIAS,     // Audio buffer, data shared with source buffer
+    AUDIO_RETIRED_PROCESSOR         // Audio processor
+} AudioRetiredType;
+
+// Music decoder, keeps a music stream decoded ahead from the decoder thread
+// NOTE: Ring buffer is written by the decoder thread and read by the mixer (single producer, single consumer),
+// music context is only accessed with decoders lock, by the decoder thread or program on seek/stop
+typedef struct MusicDecoder {
+    Music music;                    // Music stream (context copy, looping is synced on UpdateMusicStream())
+    unsigned char *ring;            // Decoded frames ring buffer, stream format
+    ma_uint32 capacity;             // Ring buffer capacity in frames (power of two)
+    ma_uint32 writePos;             // Ring buffer frames written (atomic, decoder thread)
+    ma_uint32 readPos;              // Ring buffer frames read (atomic, mixer)
+    ma_uint32 discardPos;           // Ring buffer frames before this position are skipped, decoded before seek/stop (atomic, acknowledged by mixer)
+    ma_uint32 looping;              // Music looping (atomic)
+    ma_uint32 ended;                // Music decoded until the end, not looping (atomic)
+    ma_uint32 finished;             // Music ended and all decoded frames played (atomic, mixer)
+    unsigned int cursor;            // Music frame to be decoded next
+    unsigned int startFrame;        // Music frame at ring position startPos (time played)
+    ma_uint32 startPos;             // Ring buffer position of last seek/stop
+    struct MusicDecoder *next;      // Next music decoder on the list
+} MusicDecoder;
+
 // Audio buffer struct
+// NOTE: Audio buffer data is owned by the mixer (audio thread), program changes are sent as commands,
+// program state (playing/paused) is kept separately and updated by mixer only when a non-looping buffer ends
 struct rAudioBuffer {
     ma_data_converter converter;    // Audio data converter
 
@@ -354,12 +441,17 @@ struct rAudioBuffer {
     bool looping;                   // Audio buffer looping, default to true for AudioStreams
     int usage;                      // Audio buffer usage mode: STATIC or STREAM
 
-    bool isSubBufferProcessed[2];   // SubBuffer processed (virtual double buffer)
+    ma_uint32 isSubBufferProcessed[2]; // SubBuffer processed (virtual double buffer) (atomic)
     unsigned int sizeInFrames;      // Total buffer size in frames
-    unsigned int frameCursorPos;    // Frame cursor position
-    unsigned int framesProcessed;   // Total frames processed in this buffer (required for play timing)
+    ma_uint32 frameCursorPos;       // Frame cursor position (atomic, written by mixer)
+    ma_uint32 framesProcessed;      // Total frames processed in this buffer (required for play timing) (atomic)
+
+    ma_uint32 state;                // Program state: AUDIO_STATE_* flags and changes sequence (atomic)
+    ma_uint32 mixSequence;          // Program state sequence of the last command applied by the mixer
+    bool underrun;                  // Stream ran out of data on current mix
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
+    MusicDecoder *decoder;          // Music decoder feeding the stream, NULL if not decoded on decoder thread
 
     rAudioBuffer *next;             // Next audio buffer on the list
     rAudioBuffer *prev;             // Previous audio buffer on the list
@@ -375,12 +467,28 @@ struct rAudioProcessor {
 
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+// Audio mixer command
+typedef struct AudioCommand {
+    int type;                       // Command type (AudioCommandType)
+    AudioBuffer *buffer;            // Target audio buffer
+    ma_uint32 sequence;             // Program state sequence (play state commands)
+    float value;                    // Command value (volume, pitch, pan)
+    AudioCallback callback;         // Command callback (AUDIO_COMMAND_CALLBACK)
+} AudioCommand;
+
+// Audio mixer retired object
+typedef struct AudioRetired {
+    void *object;                   // Retired object (AudioBuffer or rAudioProcessor)
+    int type;                       // Retired object type (AudioRetiredType)
+    ma_uint32 epoch;                // Mixer epoch required to free the object
+} AudioRetired;
+
 // Audio data context
 typedef struct AudioData {
     struct {
         ma_context context;         // miniaudio context data
         ma_device device;           // miniaudio device
-        ma_mutex lock;              // miniaudio mutex lock
+        ma_mutex lock;              // miniaudio mutex lock, serializes program side audio calls (never locked by mixer)
         bool isReady;               // Check if audio device is ready
         size_t pcmBufferSize;       // Pre-allocated buffer size
         void *pcmBuffer;            // Pre-allocated buffer to read audio data from file/memory
@@ -390,6 +498,36 @@ typedef struct AudioData {
         AudioBuffer *last;          // Pointer to last AudioBuffer in the list
         int defaultSize;            // Default audio buffer size for audio streams
     } Buffer;
+    struct {
+        AudioCommand commands[AUDIO_COMMAND_QUEUE_SIZE]; // Commands queue (single producer: locked program, single consumer: mixer)
+        ma_uint32 commandWrite;     // Commands queue write position (atomic)
+        ma_uint32 commandRead;      // Commands queue read position (atomic)
+        AudioCommand *overflow;     // Commands pushed while queue was full, applied after queued commands (overflow lock)
+        ma_uint32 overflowCount;    // Overflow commands count (atomic, written with overflow lock)
+        int overflowCapacity;       // Overflow commands capacity (program only)
+        ma_uint32 overflowLock;     // Overflow commands lock, only tried by mixer (atomic, 1 while locked)
+        ma_uint32 epoch;            // Mixer epoch, increased on every mix start and end, odd while mixing (atomic)
+        ma_uint32 xrunCount;        // Mixer dropouts: streams running out of data or mixing slower than real-time (atomic)
+        AudioRetired *retired;      // Objects removed from mixer lists, pending to be freed
+        int retiredCount;           // Retired objects count
+        int retiredCapacity;        // Retired objects capacity
+        ma_uint32 voiceCount;       // Voices mixed on last mix (atomic)
+        ma_uint32 mixTime;          // Time spent on last mix, in microseconds (atomic)
+        float frames[AUDIO_MIXER_BLOCK_FRAMES*AUDIO_DEVICE_CHANNELS];     // Voice frames in mixing format (mixer only)
+        ma_uint8 input[AUDIO_MIXER_BLOCK_FRAMES*AUDIO_DEVICE_CHANNELS*sizeof(float)]; // Voice frames in internal format, to be converted (mixer only)
+    } Mixer;
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+    struct {
+        ma_thread thread;           // Decoder thread
+        ma_mutex lock;              // Decoders list and music contexts lock (program and decoder thread)
+        bool threaded;              // Music streams loaded are decoded on decoder thread (opt-in)
+        bool running;               // Decoder thread started
+        ma_uint32 shutdown;         // Decoder thread exit request (atomic)
+        int readAhead;              // Music decoded ahead per stream, in milliseconds
+        MusicDecoder *first;        // Music decoders list
+        ma_uint32 load;             // Decoder thread load, decoding time over elapsed time (x10000) (atomic)
+    } Decoder;
+#endif
     rAudioProcessor *mixedProcessor;
 } AudioData;
 
@@ -403,6 +541,9 @@ static AudioData AUDIO = {          // Global AUDIO context
     // standard double-buffering system, a 4096 samples buffer has been chosen, it should be enough
     // In case of music-stalls, just increase this number
     .Buffer.defaultSize = 0,
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+    .Decoder.readAhead = MUSIC_DECODER_READAHEAD_MS,
+#endif
     .mixedProcessor = NULL
 };
 
@@ -422,6 +563,26 @@ static bool RLIsAudioBufferPlayingInLockedState(AudioBuffer *buffer);
 static void RLStopAudioBufferInLockedState(AudioBuffer *buffer);
 static void RLUpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount);
 
+static ma_uint32 RLChangeAudioBufferState(AudioBuffer *buffer, ma_uint32 clearFlags, ma_uint32 setFlags); // Change audio buffer program state, returns new sequence
+static void RLPushAudioCommand(int type, AudioBuffer *buffer, ma_uint32 sequence, float value, AudioCallback callback); // Push command to mixer, assuming lock
+static void RLProcessAudioCommands(void);                   // Apply pending commands (mixer)
+static void RLApplyAudioCommand(const AudioCommand *command); // Apply command to audio buffer (mixer)
+static void RLStopAudioBufferInMixer(AudioBuffer *buffer);  // Stop an audio buffer that reached its end (mixer)
+static void RLRetireAudioObject(void *object, int type);    // Free object once mixer can not access it, assuming lock
+static void RLReclaimAudioObjects(bool force);              // Free retired objects not accessible by mixer anymore, assuming lock
+
+static int RLReadMusicFrames(Music music, void *pcm, int frameCount);   // Decode music frames, restarting from beginning at the end
+static void RLRewindMusicContext(Music music);              // Move music context decoding back to the beginning
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+static void RLLoadMusicDecoder(Music music);                // Load music decoder for a music stream, starting decoder thread if required
+static void RLUnloadMusicDecoder(Music music);              // Remove music decoder from decoder thread, freed with stream buffer
+static void RLResetMusicDecoder(MusicDecoder *decoder, unsigned int frame); // Restart decoding from frame, discarding decoded frames, assuming decoders lock
+static void RLDecodeMusicAhead(MusicDecoder *decoder);      // Decode music frames into decoder ring buffer (decoder thread)
+static ma_uint32 RLReadMusicDecoderFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount); // Read decoded frames (mixer)
+static void RLDiscardMusicDecoderFrames(MusicDecoder *decoder);         // Skip frames decoded before seek/stop, releasing them to the decoder (mixer)
+static ma_thread_result MA_THREADCALL RLMusicDecoderThread(void *userData); // Music decoder thread
+#endif
+
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
 static const char *GetFileExtension(const char *fileName);          // Get pointer to extension for a filename string (includes the dot: .png)
@@ -490,8 +651,9 @@ void RLInitAudioDevice(void)
         return;
     }
 
-    // Mixing happens on a separate thread which means we need to synchronize. I'm using a mutex here to make things simple, but may
-    // want to look at something a bit smarter later on to keep everything real-time, if that's necessary
+    // Mixing happens on a separate thread which means we need to synchronize. Mixer never locks: program changes
+    // are sent through a lock-free commands queue and buffers are freed once the mixer can not access them anymore,
+    // this mutex only serializes program side calls (commands queue producer and buffers list updates)
     if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
     {
         TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for mixing");
@@ -526,10 +688,30 @@ void RLCloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
-        ma_mutex_uninit(&AUDIO.System.lock);
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+        if (AUDIO.Decoder.running)
+        {
+            ma_atomic_store_32(&AUDIO.Decoder.shutdown, true);
+            ma_thread_wait(&AUDIO.Decoder.thread);
+            ma_mutex_uninit(&AUDIO.Decoder.lock);
+            AUDIO.Decoder.running = false;
+        }
+#endif
         ma_device_uninit(&AUDIO.System.device);
         ma_context_uninit(&AUDIO.System.context);
 
+        // Mixer is not running anymore, apply pending commands and free all retired objects
+        RLProcessAudioCommands();
+        RLReclaimAudioObjects(true);
+        RL_FREE(AUDIO.Mixer.overflow);
+        AUDIO.Mixer.overflow = NULL;
+        AUDIO.Mixer.overflowCapacity = 0;
+        RL_FREE(AUDIO.Mixer.retired);
+        AUDIO.Mixer.retired = NULL;
+        AUDIO.Mixer.retiredCount = 0;
+        AUDIO.Mixer.retiredCapacity = 0;
+        ma_mutex_uninit(&AUDIO.System.lock);
+
         AUDIO.System.isReady = false;
         RL_FREE(AUDIO.System.pcmBuffer);
         AUDIO.System.pcmBuffer = NULL;
@@ -560,6 +742,30 @@ float RLGetMasterVolume(void)
     return volume;
 }
 
+// Get audio mixer dropouts (xruns) count since device initialization
+// NOTE: Counts playing streams running out of data and mixes taking longer than the audio they produce
+unsigned int RLGetAudioXrunCount(void)
+{
+    return ma_atomic_load_32(&AUDIO.Mixer.xrunCount);
+}
+
+// Get number of voices (playing sounds and streams) mixed on last audio callback
+int RLGetAudioMixerVoiceCount(void)
+{
+    return (int)ma_atomic_load_32(&AUDIO.Mixer.voiceCount);
+}
+
+// Get audio mixer throughput of last audio callback, in voices per millisecond
+float RLGetAudioMixerVoiceRate(void)
+{
+    float rate = 0.0f;
+    ma_uint32 mixTime = ma_atomic_load_32(&AUDIO.Mixer.mixTime);
+
+    if (mixTime > 0) rate = (float)ma_atomic_load_32(&AUDIO.Mixer.voiceCount)*1000.0f/(float)mixTime;
+
+    return rate;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Audio Buffer management
 //----------------------------------------------------------------------------------
@@ -618,25 +824,23 @@ AudioBuffer * RLLoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32
 }
 
 // Delete an audio buffer
+// NOTE: Buffer memory is freed once the mixer can not access it anymore
 void RLUnloadAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
         RLUntrackAudioBuffer(buffer);
-        ma_data_converter_uninit(&buffer->converter, NULL);
-        RL_FREE(buffer->data);
-        RL_FREE(buffer);
+
+        ma_mutex_lock(&AUDIO.System.lock);
+        RLRetireAudioObject(buffer, AUDIO_RETIRED_BUFFER);
+        ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
-// Check if an audio buffer is playing from a program state without lock
+// Check if an audio buffer is playing from a program state
 bool RLIsAudioBufferPlaying(AudioBuffer *buffer)
 {
-    bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = RLIsAudioBufferPlayingInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
-    return result;
+    return RLIsAudioBufferPlayingInLockedState(buffer);
 }
 
 // Play an audio buffer
@@ -647,14 +851,13 @@ void RLPlayAudioBuffer(AudioBuffer *buffer)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        buffer->playing = true;
-        buffer->paused = false;
-        buffer->frameCursorPos = 0;
+        ma_uint32 sequence = RLChangeAudioBufferState(buffer, AUDIO_STATE_PAUSED, AUDIO_STATE_PLAYING);
+        RLPushAudioCommand(AUDIO_COMMAND_PLAY, buffer, sequence, 0.0f, NULL);
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
-// Stop an audio buffer from a program state without lock
+// Stop an audio buffer from a program state
 void RLStopAudioBuffer(AudioBuffer *buffer)
 {
     ma_mutex_lock(&AUDIO.System.lock);
@@ -668,7 +871,8 @@ void RLPauseAudioBuffer(AudioBuffer *buffer)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        buffer->paused = true;
+        ma_uint32 sequence = RLChangeAudioBufferState(buffer, 0, AUDIO_STATE_PAUSED);
+        RLPushAudioCommand(AUDIO_COMMAND_PAUSE, buffer, sequence, 0.0f, NULL);
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -679,7 +883,8 @@ void RLResumeAudioBuffer(AudioBuffer *buffer)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        buffer->paused = false;
+        ma_uint32 sequence = RLChangeAudioBufferState(buffer, AUDIO_STATE_PAUSED, 0);
+        RLPushAudioCommand(AUDIO_COMMAND_RESUME, buffer, sequence, 0.0f, NULL);
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -690,25 +895,22 @@ void RLSetAudioBufferVolume(AudioBuffer *buffer, float volume)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        buffer->volume = volume;
+        RLPushAudioCommand(AUDIO_COMMAND_VOLUME, buffer, 0, volume, NULL);
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
 // Set pitch for an audio buffer
+// NOTE: Pitching is just an adjustment of the sample rate, applied by the mixer
+// Note that this changes the duration of the sound:
+//  - higher pitches will make the sound faster
+//  - lower pitches make it slower
 void RLSetAudioBufferPitch(AudioBuffer *buffer, float pitch)
 {
     if ((buffer != NULL) && (pitch > 0.0f))
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        // Pitching is just an adjustment of the sample rate
-        // Note that this changes the duration of the sound:
-        //  - higher pitches will make the sound faster
-        //  - lower pitches make it slower
-        ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/pitch);
-        ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
-
-        buffer->pitch = pitch;
+        RLPushAudioCommand(AUDIO_COMMAND_PITCH, buffer, 0, pitch, NULL);
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -722,22 +924,24 @@ void RLSetAudioBufferPan(AudioBuffer *buffer, float pan)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        buffer->pan = pan;
+        RLPushAudioCommand(AUDIO_COMMAND_PAN, buffer, 0, pan, NULL);
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
 // Track audio buffer to linked list next position
+// NOTE: Mixer could be traversing the list, buffer is published with atomic stores once initialized
 void RLTrackAudioBuffer(AudioBuffer *buffer)
 {
     ma_mutex_lock(&AUDIO.System.lock);
     {
-        if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
-        else
-        {
-            AUDIO.Buffer.last->next = buffer;
-            buffer->prev = AUDIO.Buffer.last;
-        }
+        RLReclaimAudioObjects(false);
+
+        buffer->next = NULL;
+        buffer->prev = AUDIO.Buffer.last;
+
+        if (AUDIO.Buffer.first == NULL) ma_atomic_store_ptr(&AUDIO.Buffer.first, buffer);
+        else ma_atomic_store_ptr(&AUDIO.Buffer.last->next, buffer);
 
         AUDIO.Buffer.last = buffer;
     }
@@ -745,18 +949,19 @@ void RLTrackAudioBuffer(AudioBuffer *buffer)
 }
 
 // Untrack audio buffer from linked list
+// NOTE: Buffer next pointer is kept, mixer could be traversing the list through this buffer,
+// buffer must be retired with RLRetireAudioObject() instead of freed directly
 void RLUntrackAudioBuffer(AudioBuffer *buffer)
 {
     ma_mutex_lock(&AUDIO.System.lock);
     {
-        if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
-        else buffer->prev->next = buffer->next;
+        if (buffer->prev == NULL) ma_atomic_store_ptr(&AUDIO.Buffer.first, buffer->next);
+        else ma_atomic_store_ptr(&buffer->prev->next, buffer->next);
 
         if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
         else buffer->next->prev = buffer->prev;
 
         buffer->prev = NULL;
-        buffer->next = NULL;
     }
     ma_mutex_unlock(&AUDIO.System.lock);
 }
@@ -770,14 +975,17 @@ Wave RLLoadWave(const char *fileName)
 {
     Wave wave = { 0 };
 
-    // Loading file to memory
-    int dataSize = 0;
-    unsigned char *fileData = RLLoadFileData(fileName, &dataSize);
+    // Mapping file in memory, wave decoded directly from file data
+    MappedFile file = RLLoadMappedFile(fileName);
 
     // Loading wave from memory data
-    if (fileData != NULL) wave = RLLoadWaveFromMemory(RLGetFileExtension(fileName), fileData, dataSize);
+    if (RLIsMappedFileValid(file))
+    {
+        if (file.size <= 2147483647) wave = RLLoadWaveFromMemory(RLGetFileExtension(fileName), file.data, (int)file.size);
+        else TRACELOG(LOG_WARNING, "WAVE: [%s] File is bigger than 2147483647 bytes, not supported", fileName);
+    }
 
-    RLUnloadFileData(fileData);
+    RLUnloadMappedFile(file);
 
     return wave;
 }
@@ -1027,8 +1235,10 @@ void RLUnloadSoundAlias(Sound alias)
     if (alias.stream.buffer != NULL)
     {
         RLUntrackAudioBuffer(alias.stream.buffer);
-        ma_data_converter_uninit(&alias.stream.buffer->converter, NULL);
-        RL_FREE(alias.stream.buffer);
+
+        ma_mutex_lock(&AUDIO.System.lock);
+        RLRetireAudioObject(alias.stream.buffer, AUDIO_RETIRED_BUFFER_ALIAS);
+        ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
@@ -1508,6 +1718,10 @@ Music RLLoadMusicStream(const char *fileName)
         TRACELOG(LOG_INFO, "    > Sample size:   %i bits", music.stream.sampleSize);
         TRACELOG(LOG_INFO, "    > Channels:      %i (%s)", music.stream.channels, (music.stream.channels == 1)? "Mono" : (music.stream.channels == 2)? "Stereo" : "Multi");
         TRACELOG(LOG_INFO, "    > Total frames:  %i", music.frameCount);
+
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+        if (AUDIO.Decoder.threaded && AUDIO.System.isReady) RLLoadMusicDecoder(music);
+#endif
     }
 
     return music;
@@ -1721,6 +1935,10 @@ Music RLLoadMusicStreamFromMemory(const char *fileType, const unsigned char *dat
         TRACELOG(LOG_INFO, "    > Sample size:   %i bits", music.stream.sampleSize);
         TRACELOG(LOG_INFO, "    > Channels:      %i (%s)", music.stream.channels, (music.stream.channels == 1)? "Mono" : (music.stream.channels == 2)? "Stereo" : "Multi");
         TRACELOG(LOG_INFO, "    > Total frames:  %i", music.frameCount);
+
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+        if (AUDIO.Decoder.threaded && AUDIO.System.isReady) RLLoadMusicDecoder(music);
+#endif
     }
 
     return music;
@@ -1739,6 +1957,11 @@ bool RLIsMusicValid(Music music)
 // Unload music stream
 void RLUnloadMusicStream(Music music)
 {
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+    // Decoder thread must not access music context anymore
+    if ((music.stream.buffer != NULL) && (music.stream.buffer->decoder != NULL)) RLUnloadMusicDecoder(music);
+#endif
+
     RLUnloadAudioStream(music.stream);
 
     if (music.ctxData != NULL)
@@ -1791,31 +2014,20 @@ void RLStopMusicStream(Music music)
 {
     RLStopAudioStream(music.stream);
 
-    switch (music.ctxType)
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+    MusicDecoder *decoder = (music.stream.buffer != NULL)? music.stream.buffer->decoder : NULL;
+
+    if (decoder != NULL)
     {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOA)
-        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_XM)
-        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MOD)
-        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
-#endif
-        default: break;
+        if (AUDIO.Decoder.running) ma_mutex_lock(&AUDIO.Decoder.lock);
+        RLRewindMusicContext(music);
+        RLResetMusicDecoder(decoder, 0);
+        if (AUDIO.Decoder.running) ma_mutex_unlock(&AUDIO.Decoder.lock);
+        return;
     }
+#endif
+
+    RLRewindMusicContext(music);
 }
 
 // Seek music to a certain position (in seconds)
@@ -1826,6 +2038,11 @@ void RLSeekMusicStream(Music music, float position)
 
     unsigned int positionInFrames = (unsigned int)(position*music.stream.sampleRate);
 
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+    MusicDecoder *decoder = (music.stream.buffer != NULL)? music.stream.buffer->decoder : NULL;
+    if ((decoder != NULL) && AUDIO.Decoder.running) ma_mutex_lock(&AUDIO.Decoder.lock);
+#endif
+
     switch (music.ctxType)
     {
 #if defined(SUPPORT_FILEFORMAT_WAV)
@@ -1853,9 +2070,15 @@ void RLSeekMusicStream(Music music, float position)
         default: break;
     }
 
-    ma_mutex_lock(&AUDIO.System.lock);
-    music.stream.buffer->framesProcessed = positionInFrames;
-    ma_mutex_unlock(&AUDIO.System.lock);
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+    if (decoder != NULL)
+    {
+        RLResetMusicDecoder(decoder, positionInFrames);
+        if (AUDIO.Decoder.running) ma_mutex_unlock(&AUDIO.Decoder.lock);
+    }
+#endif
+
+    ma_atomic_store_32(&music.stream.buffer->framesProcessed, positionInFrames);
 }
 
 // Update (re-fill) music buffers if data already processed
@@ -1863,6 +2086,21 @@ void RLUpdateMusicStream(Music music)
 {
     if (music.stream.buffer == NULL) return;
 
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+    // Music decoded on decoder thread, only looping is synced and stream end checked
+    MusicDecoder *decoder = music.stream.buffer->decoder;
+
+    if (decoder != NULL)
+    {
+        ma_atomic_store_32(&decoder->looping, music.looping);
+
+        // Streaming ended, all decoded frames played
+        if (ma_atomic_load_32(&decoder->finished)) RLStopMusicStream(music);
+
+        return;
+    }
+#endif
+
     ma_mutex_lock(&AUDIO.System.lock);
 
     unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
@@ -1881,128 +2119,19 @@ void RLUpdateMusicStream(Music music)
     // Check both sub-buffers to check if they require refilling
     for (int i = 0; i < 2; i++)
     {
-        if (!music.stream.buffer->isSubBufferProcessed[i]) continue; // No refilling required, move to next sub-buffer
+        if (!ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[i])) continue; // No refilling required, move to next sub-buffer
 
-        unsigned int framesLeft = music.frameCount - music.stream.buffer->framesProcessed;  // Frames left to be processed
+        unsigned int framesLeft = music.frameCount - ma_atomic_load_32(&music.stream.buffer->framesProcessed);  // Frames left to be processed
         unsigned int framesToStream = 0;                 // Total frames to be streamed
 
         if ((framesLeft >= subBufferSizeInFrames) || music.looping) framesToStream = subBufferSizeInFrames;
         else framesToStream = framesLeft;
 
-        int frameCountStillNeeded = framesToStream;
-        int frameCountReadTotal = 0;
-
-        switch (music.ctxType)
-        {
-        #if defined(SUPPORT_FILEFORMAT_WAV)
-            case MUSIC_AUDIO_WAV:
-            {
-                if (music.stream.sampleSize == 16)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-                else if (music.stream.sampleSize == 32)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_OGG)
-            case MUSIC_AUDIO_OGG:
-            {
-                while (true)
-                {
-                    int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MP3)
-            case MUSIC_AUDIO_MP3:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_QOA)
-            case MUSIC_AUDIO_QOA:
-            {
-                unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                frameCountReadTotal += frameCountRead;
-                /*
-                while (true)
-                {
-                    int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize),  frameCountStillNeeded);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else qoaplay_rewind((qoaplay_desc *)music.ctxData);
-                }
-                */
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_FLAC)
-            case MUSIC_AUDIO_FLAC:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drflac__seek_to_first_frame((drflac *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_XM)
-            case MUSIC_MODULE_XM:
-            {
-                // NOTE: Internally we consider 2 channels generation, so sampleCount/2
-                if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)AUDIO.System.pcmBuffer, framesToStream);
-                //jar_xm_reset((jar_xm_context_t *)music.ctxData);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MOD)
-            case MUSIC_MODULE_MOD:
-            {
-                // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
-                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream, 0);
-                //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
-
-            } break;
-        #endif
-            default: break;
-        }
+        RLReadMusicFrames(music, AUDIO.System.pcmBuffer, framesToStream);
 
         RLUpdateAudioStreamInLockedState(music.stream, AUDIO.System.pcmBuffer, framesToStream);
 
-        music.stream.buffer->framesProcessed = music.stream.buffer->framesProcessed%music.frameCount;
+        ma_atomic_store_32(&music.stream.buffer->framesProcessed, ma_atomic_load_32(&music.stream.buffer->framesProcessed)%music.frameCount);
 
         if (framesLeft <= subBufferSizeInFrames)
         {
@@ -2059,6 +2188,22 @@ float RLGetMusicTimePlayed(Music music)
     float secondsPlayed = 0.0f;
     if (music.stream.buffer != NULL)
     {
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+        // Music decoded on decoder thread, frames played counted from last seek/stop position
+        // NOTE: Music context is not accessed, decoder thread could be using it
+        MusicDecoder *decoder = music.stream.buffer->decoder;
+
+        if (decoder != NULL)
+        {
+            ma_int32 framesSinceStart = (ma_int32)(ma_atomic_load_32(&decoder->readPos) - decoder->startPos);
+            if (framesSinceStart < 0) framesSinceStart = 0;
+
+            ma_uint64 framesPlayed = (ma_uint64)decoder->startFrame + framesSinceStart;
+            if (music.frameCount > 0) framesPlayed %= music.frameCount;
+            secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
+        }
+        else
+#endif
 #if defined(SUPPORT_FILEFORMAT_XM)
         if (music.ctxType == MUSIC_MODULE_XM)
         {
@@ -2070,23 +2215,75 @@ float RLGetMusicTimePlayed(Music music)
         else
 #endif
         {
-            ma_mutex_lock(&AUDIO.System.lock);
             //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
-            int framesProcessed = (int)music.stream.buffer->framesProcessed;
+            int framesProcessed = (int)ma_atomic_load_32(&music.stream.buffer->framesProcessed);
             int subBufferSize = (int)music.stream.buffer->sizeInFrames/2;
-            int framesInFirstBuffer = music.stream.buffer->isSubBufferProcessed[0]? 0 : subBufferSize;
-            int framesInSecondBuffer = music.stream.buffer->isSubBufferProcessed[1]? 0 : subBufferSize;
-            int framesSentToMix = music.stream.buffer->frameCursorPos%subBufferSize;
+            int framesInFirstBuffer = ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[0])? 0 : subBufferSize;
+            int framesInSecondBuffer = ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[1])? 0 : subBufferSize;
+            int framesSentToMix = ma_atomic_load_32(&music.stream.buffer->frameCursorPos)%subBufferSize;
             int framesPlayed = (framesProcessed - framesInFirstBuffer - framesInSecondBuffer + framesSentToMix)%(int)music.frameCount;
             if (framesPlayed < 0) framesPlayed += music.frameCount;
             secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
-            ma_mutex_unlock(&AUDIO.System.lock);
         }
     }
 
     return secondsPlayed;
 }
 
+// Set music streams decoding on a background thread (opt-in), for music streams loaded afterwards
+// NOTE: Threaded music streams are decoded ahead, UpdateMusicStream() only syncs looping and checks music end
+void RLSetMusicDecoderThreaded(bool enabled)
+{
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+    AUDIO.Decoder.threaded = enabled;
+#else
+    if (enabled) TRACELOG(LOG_WARNING, "STREAM: Music decoder thread not supported");
+#endif
+}
+
+// Set music decoded ahead per stream on decoder thread (in milliseconds), for music streams loaded afterwards
+void RLSetMusicDecoderReadAhead(int milliseconds)
+{
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+    AUDIO.Decoder.readAhead = (milliseconds > 0)? milliseconds : MUSIC_DECODER_READAHEAD_MS;
+#endif
+}
+
+// Get music frames decoded ahead, waiting to be played (only music decoded on decoder thread)
+int RLGetMusicFramesBuffered(Music music)
+{
+    int frames = 0;
+
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+    MusicDecoder *decoder = (music.stream.buffer != NULL)? music.stream.buffer->decoder : NULL;
+
+    if (decoder != NULL)
+    {
+        ma_uint32 readPos = ma_atomic_load_32(&decoder->readPos);
+        ma_uint32 discardPos = ma_atomic_load_32(&decoder->discardPos);
+
+        if ((ma_int32)(discardPos - readPos) > 0) readPos = discardPos;
+
+        ma_int32 framesAhead = (ma_int32)(ma_atomic_load_32(&decoder->writePos) - readPos);
+        frames = (framesAhead > 0)? framesAhead : 0;
+    }
+#endif
+
+    return frames;
+}
+
+// Get music decoder thread load: time spent decoding over elapsed time, measured every second
+float RLGetMusicDecoderLoad(void)
+{
+    float load = 0.0f;
+
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+    load = (float)ma_atomic_load_32(&AUDIO.Decoder.load)/10000.0f;
+#endif
+
+    return load;
+}
+
 // Load audio stream (to stream audio pcm data)
 AudioStream RLLoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels)
 {
@@ -2151,10 +2348,8 @@ bool RLIsAudioStreamProcessed(AudioStream stream)
 {
     if (stream.buffer == NULL) return false;
 
-    bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1];
-    ma_mutex_unlock(&AUDIO.System.lock);
+    bool result = ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[0]) || ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[1]);
+
     return result;
 }
 
@@ -2218,7 +2413,7 @@ void RLSetAudioStreamCallback(AudioStream stream, AudioCallback callback)
     if (stream.buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        stream.buffer->callback = callback;
+        RLPushAudioCommand(AUDIO_COMMAND_CALLBACK, stream.buffer, 0, 0.0f, callback);
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -2242,9 +2437,9 @@ void RLAttachAudioStreamProcessor(AudioStream stream, AudioCallback process)
     if (last)
     {
         processor->prev = last;
-        last->next = processor;
+        ma_atomic_store_ptr(&last->next, processor);
     }
-    else stream.buffer->processor = processor;
+    else ma_atomic_store_ptr(&stream.buffer->processor, processor);
 
     ma_mutex_unlock(&AUDIO.System.lock);
 }
@@ -2263,11 +2458,12 @@ void RLDetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 
         if (processor->process == process)
         {
-            if (stream.buffer->processor == processor) stream.buffer->processor = next;
-            if (prev) prev->next = next;
+            if (stream.buffer->processor == processor) ma_atomic_store_ptr(&stream.buffer->processor, next);
+            if (prev) ma_atomic_store_ptr(&prev->next, next);
             if (next) next->prev = prev;
 
-            RL_FREE(processor);
+            // NOTE: Processor next pointer is kept, mixer could be running it
+            RLRetireAudioObject(processor, AUDIO_RETIRED_PROCESSOR);
         }
 
         processor = next;
@@ -2295,9 +2491,9 @@ void RLAttachAudioMixedProcessor(AudioCallback process)
     if (last)
     {
         processor->prev = last;
-        last->next = processor;
+        ma_atomic_store_ptr(&last->next, processor);
     }
-    else AUDIO.mixedProcessor = processor;
+    else ma_atomic_store_ptr(&AUDIO.mixedProcessor, processor);
 
     ma_mutex_unlock(&AUDIO.System.lock);
 }
@@ -2316,11 +2512,12 @@ void RLDetachAudioMixedProcessor(AudioCallback process)
 
         if (processor->process == process)
         {
-            if (AUDIO.mixedProcessor == processor) AUDIO.mixedProcessor = next;
-            if (prev) prev->next = next;
+            if (AUDIO.mixedProcessor == processor) ma_atomic_store_ptr(&AUDIO.mixedProcessor, next);
+            if (prev) ma_atomic_store_ptr(&prev->next, next);
             if (next) next->prev = prev;
 
-            RL_FREE(processor);
+            // NOTE: Processor next pointer is kept, mixer could be running it
+            RLRetireAudioObject(processor, AUDIO_RETIRED_PROCESSOR);
         }
 
         processor = next;
@@ -2347,11 +2544,16 @@ static ma_uint32 RLReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffe
     if (audioBuffer->callback)
     {
         audioBuffer->callback(framesOut, frameCount);
-        audioBuffer->framesProcessed += frameCount;
+        ma_atomic_fetch_add_32(&audioBuffer->framesProcessed, frameCount);
 
         return frameCount;
     }
 
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+    // Using music decoder ring buffer, filled by decoder thread
+    if (audioBuffer->decoder != NULL) return RLReadMusicDecoderFrames(audioBuffer, framesOut, frameCount);
+#endif
+
     ma_uint32 subBufferSizeInFrames = (audioBuffer->sizeInFrames > 1)? audioBuffer->sizeInFrames/2 : audioBuffer->sizeInFrames;
     ma_uint32 currentSubBufferIndex = audioBuffer->frameCursorPos/subBufferSizeInFrames;
 
@@ -2359,9 +2561,10 @@ static ma_uint32 RLReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffe
 
     // Another thread can update the processed state of buffers, so
     // we just take a copy here to try and avoid potential synchronization problems
+    // NOTE: Program writes sub-buffer data before marking it as not processed
     bool isSubBufferProcessed[2] = { 0 };
-    isSubBufferProcessed[0] = audioBuffer->isSubBufferProcessed[0];
-    isSubBufferProcessed[1] = audioBuffer->isSubBufferProcessed[1];
+    isSubBufferProcessed[0] = ma_atomic_load_32(&audioBuffer->isSubBufferProcessed[0]);
+    isSubBufferProcessed[1] = ma_atomic_load_32(&audioBuffer->isSubBufferProcessed[1]);
 
     ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
 
@@ -2400,13 +2603,13 @@ static ma_uint32 RLReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffe
         if (framesToRead > framesRemainingInOutputBuffer) framesToRead = framesRemainingInOutputBuffer;
 
         memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), audioBuffer->data + (audioBuffer->frameCursorPos*frameSizeInBytes), framesToRead*frameSizeInBytes);
-        audioBuffer->frameCursorPos = (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames;
+        ma_atomic_store_32(&audioBuffer->frameCursorPos, (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames);
         framesRead += framesToRead;
 
         // If we've read to the end of the buffer, mark it as processed
         if (framesToRead == framesRemainingInOutputBuffer)
         {
-            audioBuffer->isSubBufferProcessed[currentSubBufferIndex] = true;
+            ma_atomic_store_32(&audioBuffer->isSubBufferProcessed[currentSubBufferIndex], true);
             isSubBufferProcessed[currentSubBufferIndex] = true;
 
             currentSubBufferIndex = (currentSubBufferIndex + 1)%2;
@@ -2414,7 +2617,7 @@ static ma_uint32 RLReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffe
             // We need to break from this loop if we're not looping
             if (!audioBuffer->looping)
             {
-                RLStopAudioBufferInLockedState(audioBuffer);
+                RLStopAudioBufferInMixer(audioBuffer);
                 break;
             }
         }
@@ -2429,7 +2632,13 @@ static ma_uint32 RLReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffe
         // For static buffers we can fill the remaining frames with silence for safety, but we don't want
         // to report those frames as "read". The reason for this is that the caller uses the return value
         // to know whether a non-looping sound has finished playback
-        if (audioBuffer->usage != AUDIO_BUFFER_USAGE_STATIC) framesRead += totalFramesRemaining;
+        if (audioBuffer->usage != AUDIO_BUFFER_USAGE_STATIC)
+        {
+            framesRead += totalFramesRemaining;
+
+            // Stream data was not provided in time
+            if (audioBuffer->playing) audioBuffer->underrun = true;
+        }
     }
 
     return framesRead;
@@ -2442,8 +2651,18 @@ static ma_uint32 RLReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer,
     // should be defined by the output format of the data converter. We do this until frameCount frames have been output. The important
     // detail to remember here is that we never, ever attempt to read more input data than is required for the specified number of output
     // frames. This can be achieved with ma_data_converter_get_required_input_frame_count()
-    ma_uint8 inputBuffer[4096] = { 0 };
-    ma_uint32 inputBufferFrameCap = sizeof(inputBuffer)/ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
+
+    // Data already in mixing format (sounds are converted on loading) and not pitched, conversion can be skipped
+    // NOTE: Converter is reset when pitch changes, so no stale resampler state is used afterwards
+    if ((audioBuffer->pitch == 1.0f) && (audioBuffer->converter.formatIn == ma_format_f32) &&
+        (audioBuffer->converter.channelsIn == audioBuffer->converter.channelsOut) &&
+        (audioBuffer->converter.sampleRateIn == audioBuffer->converter.sampleRateOut))
+    {
+        return RLReadAudioBufferFramesInInternalFormat(audioBuffer, framesOut, frameCount);
+    }
+
+    ma_uint8 *inputBuffer = AUDIO.Mixer.input;
+    ma_uint32 inputBufferFrameCap = sizeof(AUDIO.Mixer.input)/ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
 
     ma_uint32 totalOutputFramesProcessed = 0;
     while (totalOutputFramesProcessed < frameCount)
@@ -2483,101 +2702,128 @@ static ma_uint32 RLReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer,
 
 // Sending audio data to device callback function
 // This function will be called when miniaudio needs more data
-// NOTE: All the mixing takes place here
+// NOTE: All the mixing takes place here, it never locks: program changes are received
+// through the commands queue and buffers/processors lists are traversed with atomic loads
 static void RLOnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount)
 {
     (void)pDevice;
 
+    // Enter mixing epoch, retired objects are not freed while mixing
+    ma_atomic_fetch_add_32(&AUDIO.Mixer.epoch, 1);
+
+    ma_timer timer = { 0 };
+    ma_timer_init(&timer);
+
     // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
     memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
 
-    // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
-    ma_mutex_lock(&AUDIO.System.lock);
+    RLProcessAudioCommands();
+
+    ma_uint32 voiceCount = 0;
+
+    for (AudioBuffer *audioBuffer = (AudioBuffer *)ma_atomic_load_ptr(&AUDIO.Buffer.first); audioBuffer != NULL; audioBuffer = (AudioBuffer *)ma_atomic_load_ptr(&audioBuffer->next))
     {
-        for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+        // Music decoded before seek/stop is skipped even if not playing, so the decoder can refill it
+        if (audioBuffer->decoder != NULL) RLDiscardMusicDecoderFrames(audioBuffer->decoder);
+#endif
+        // Ignore stopped or paused sounds
+        if (!audioBuffer->playing || audioBuffer->paused) continue;
+
+        // Ignore sounds with play state changes not received yet (commands pushed while mixing),
+        // they are mixed on next call, once the state matches the program state
+        if ((ma_atomic_load_32(&audioBuffer->state) >> AUDIO_STATE_SEQUENCE_SHIFT) != audioBuffer->mixSequence) continue;
+
+        ma_uint32 framesRead = 0;
+        voiceCount++;
+
+        while (1)
         {
-            // Ignore stopped or paused sounds
-            if (!audioBuffer->playing || audioBuffer->paused) continue;
+            if (framesRead >= frameCount) break;
 
-            ma_uint32 framesRead = 0;
+            // Just read as much data as we can from the stream
+            ma_uint32 framesToRead = (frameCount - framesRead);
 
-            while (1)
+            while (framesToRead > 0)
             {
-                if (framesRead >= frameCount) break;
-
-                // Just read as much data as we can from the stream
-                ma_uint32 framesToRead = (frameCount - framesRead);
+                // NOTE: Voice frames are read in blocks into mixer buffer, no need to clear it,
+                // only frames read are mixed
+                ma_uint32 framesToReadRightNow = framesToRead;
+                if (framesToReadRightNow > AUDIO_MIXER_BLOCK_FRAMES) framesToReadRightNow = AUDIO_MIXER_BLOCK_FRAMES;
 
-                while (framesToRead > 0)
+                ma_uint32 framesJustRead = RLReadAudioBufferFramesInMixingFormat(audioBuffer, AUDIO.Mixer.frames, framesToReadRightNow);
+                if (framesJustRead > 0)
                 {
-                    float tempBuffer[1024] = { 0 }; // Frames for stereo
+                    float *framesOut = (float *)pFramesOut + (framesRead*AUDIO.System.device.playback.channels);
+                    float *framesIn = AUDIO.Mixer.frames;
 
-                    ma_uint32 framesToReadRightNow = framesToRead;
-                    if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
+                    // Apply processors chain if defined
+                    rAudioProcessor *processor = (rAudioProcessor *)ma_atomic_load_ptr(&audioBuffer->processor);
+                    while (processor)
                     {
-                        framesToReadRightNow = sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS;
+                        processor->process(framesIn, framesJustRead);
+                        processor = (rAudioProcessor *)ma_atomic_load_ptr(&processor->next);
                     }
 
-                    ma_uint32 framesJustRead = RLReadAudioBufferFramesInMixingFormat(audioBuffer, tempBuffer, framesToReadRightNow);
-                    if (framesJustRead > 0)
-                    {
-                        float *framesOut = (float *)pFramesOut + (framesRead*AUDIO.System.device.playback.channels);
-                        float *framesIn = tempBuffer;
-
-                        // Apply processors chain if defined
-                        rAudioProcessor *processor = audioBuffer->processor;
-                        while (processor)
-                        {
-                            processor->process(framesIn, framesJustRead);
-                            processor = processor->next;
-                        }
+                    RLMixAudioFrames(framesOut, framesIn, framesJustRead, audioBuffer);
 
-                        RLMixAudioFrames(framesOut, framesIn, framesJustRead, audioBuffer);
+                    framesToRead -= framesJustRead;
+                    framesRead += framesJustRead;
+                }
 
-                        framesToRead -= framesJustRead;
-                        framesRead += framesJustRead;
-                    }
+                if (!audioBuffer->playing)
+                {
+                    framesRead = frameCount;
+                    break;
+                }
 
-                    if (!audioBuffer->playing)
+                // If we weren't able to read all the frames we requested, break
+                if (framesJustRead < framesToReadRightNow)
+                {
+                    if (!audioBuffer->looping)
                     {
-                        framesRead = frameCount;
+                        RLStopAudioBufferInMixer(audioBuffer);
                         break;
                     }
-
-                    // If we weren't able to read all the frames we requested, break
-                    if (framesJustRead < framesToReadRightNow)
+                    else
                     {
-                        if (!audioBuffer->looping)
-                        {
-                            RLStopAudioBufferInLockedState(audioBuffer);
-                            break;
-                        }
-                        else
-                        {
-                            // Should never get here, but just for safety,
-                            // move the cursor position back to the start and continue the loop
-                            audioBuffer->frameCursorPos = 0;
-                            continue;
-                        }
+                        // Should never get here, but just for safety,
+                        // move the cursor position back to the start and continue the loop
+                        ma_atomic_store_32(&audioBuffer->frameCursorPos, 0);
+                        continue;
                     }
                 }
-
-                // If for some reason we weren't able to read every frame we'll need to break from the loop
-                // Not doing this could theoretically put us into an infinite loop
-                if (framesToRead > 0) break;
             }
+
+            // If for some reason we weren't able to read every frame we'll need to break from the loop
+            // Not doing this could theoretically put us into an infinite loop
+            if (framesToRead > 0) break;
+        }
+
+        if (audioBuffer->underrun)
+        {
+            ma_atomic_fetch_add_32(&AUDIO.Mixer.xrunCount, 1);
+            audioBuffer->underrun = false;
         }
     }
 
-    rAudioProcessor *processor = AUDIO.mixedProcessor;
+    rAudioProcessor *processor = (rAudioProcessor *)ma_atomic_load_ptr(&AUDIO.mixedProcessor);
     while (processor)
     {
         processor->process(pFramesOut, frameCount);
-        processor = processor->next;
+        processor = (rAudioProcessor *)ma_atomic_load_ptr(&processor->next);
     }
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    double mixTime = ma_timer_get_time_in_seconds(&timer);
+
+    ma_atomic_store_32(&AUDIO.Mixer.voiceCount, voiceCount);
+    ma_atomic_store_32(&AUDIO.Mixer.mixTime, (ma_uint32)(mixTime*1000000.0));
+
+    // Mixing took longer than the audio generated, device could run out of data
+    if (mixTime > (double)frameCount/pDevice->sampleRate) ma_atomic_fetch_add_32(&AUDIO.Mixer.xrunCount, 1);
+
+    // Leave mixing epoch
+    ma_atomic_fetch_add_32(&AUDIO.Mixer.epoch, 1);
 }
 
 // Main mixing function, pretty simple in this project, just an accumulation
@@ -2587,65 +2833,89 @@ static void RLMixAudioFrames(float *framesOut, const float *framesIn, ma_uint32
     const float localVolume = buffer->volume;
     const ma_uint32 channels = AUDIO.System.device.playback.channels;
 
+    // Gains applied to every sample, repeated every 4 samples
+    float gains[4] = { localVolume, localVolume, localVolume, localVolume };
+
     if (channels == 2)  // We consider panning
     {
         const float left = buffer->pan;
         const float right = 1.0f - left;
 
         // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
-        const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
+        gains[0] = gains[2] = localVolume*0.5f*left*(3.0f - left*left);
+        gains[1] = gains[3] = localVolume*0.5f*right*(3.0f - right*right);
+    }
+    // NOTE: We do not consider panning for other channel counts, all channels share volume
 
-        float *frameOut = framesOut;
-        const float *frameIn = framesIn;
+    // Output accumulates input multiplied by gains to provided output (usually 0)
+    // NOTE: Frames are interleaved, so mixing is a single accumulation over all samples
+    const ma_uint32 sampleCount = frameCount*channels;
+    ma_uint32 i = 0;
 
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
+#if defined(RL_MIXING_AVX)
+    const __m256 gains8 = _mm256_setr_ps(gains[0], gains[1], gains[2], gains[3], gains[0], gains[1], gains[2], gains[3]);
 
-            frameOut += 2;
-            frameIn += 2;
-        }
+    for (; (i + 16) <= sampleCount; i += 16)
+    {
+        __m256 out0 = _mm256_add_ps(_mm256_loadu_ps(framesOut + i), _mm256_mul_ps(_mm256_loadu_ps(framesIn + i), gains8));
+        __m256 out1 = _mm256_add_ps(_mm256_loadu_ps(framesOut + i + 8), _mm256_mul_ps(_mm256_loadu_ps(framesIn + i + 8), gains8));
+        _mm256_storeu_ps(framesOut + i, out0);
+        _mm256_storeu_ps(framesOut + i + 8, out1);
     }
-    else  // We do not consider panning
+#endif
+#if defined(RL_MIXING_AVX) || defined(RL_MIXING_SSE)
+    const __m128 gains4 = _mm_loadu_ps(gains);
+
+    for (; (i + 4) <= sampleCount; i += 4)
     {
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            for (ma_uint32 c = 0; c < channels; c++)
-            {
-                float *frameOut = framesOut + (frame*channels);
-                const float *frameIn = framesIn + (frame*channels);
+        _mm_storeu_ps(framesOut + i, _mm_add_ps(_mm_loadu_ps(framesOut + i), _mm_mul_ps(_mm_loadu_ps(framesIn + i), gains4)));
+    }
+#elif defined(RL_MIXING_NEON)
+    const float32x4_t gains4 = vld1q_f32(gains);
 
-                // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
-            }
-        }
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        float32x4_t out0 = vmlaq_f32(vld1q_f32(framesOut + i), vld1q_f32(framesIn + i), gains4);
+        float32x4_t out1 = vmlaq_f32(vld1q_f32(framesOut + i + 4), vld1q_f32(framesIn + i + 4), gains4);
+        vst1q_f32(framesOut + i, out0);
+        vst1q_f32(framesOut + i + 4, out1);
+    }
+    for (; (i + 4) <= sampleCount; i += 4)
+    {
+        vst1q_f32(framesOut + i, vmlaq_f32(vld1q_f32(framesOut + i), vld1q_f32(framesIn + i), gains4));
     }
+#endif
+
+    // Remaining samples, gains pattern is kept as SIMD loops process multiples of 4 samples
+    for (; i < sampleCount; i++) framesOut[i] += framesIn[i]*gains[i & 3];
 }
 
-// Check if an audio buffer is playing, assuming the audio system mutex has been locked
+// Check if an audio buffer is playing, from program state
+// NOTE: Program state is atomic, audio system mutex is not required
 static bool RLIsAudioBufferPlayingInLockedState(AudioBuffer *buffer)
 {
     bool result = false;
 
-    if (buffer != NULL) result = (buffer->playing && !buffer->paused);
+    if (buffer != NULL) result = ((ma_atomic_load_32(&buffer->state) & (AUDIO_STATE_PLAYING | AUDIO_STATE_PAUSED)) == AUDIO_STATE_PLAYING);
 
     return result;
 }
 
 // Stop an audio buffer, assuming the audio system mutex has been locked
+// NOTE: Stream sub-buffers are released immediately, so the stream can be refilled before the mixer receives the command
 static void RLStopAudioBufferInLockedState(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
         if (RLIsAudioBufferPlayingInLockedState(buffer))
         {
-            buffer->playing = false;
-            buffer->paused = false;
-            buffer->frameCursorPos = 0;
-            buffer->framesProcessed = 0;
-            buffer->isSubBufferProcessed[0] = true;
-            buffer->isSubBufferProcessed[1] = true;
+            ma_uint32 sequence = RLChangeAudioBufferState(buffer, AUDIO_STATE_PLAYING | AUDIO_STATE_PAUSED, 0);
+
+            ma_atomic_store_32(&buffer->framesProcessed, 0);
+            ma_atomic_store_32(&buffer->isSubBufferProcessed[0], true);
+            ma_atomic_store_32(&buffer->isSubBufferProcessed[1], true);
+
+            RLPushAudioCommand(AUDIO_COMMAND_STOP, buffer, sequence, 0.0f, NULL);
         }
     }
 }
@@ -2655,28 +2925,30 @@ static void RLUpdateAudioStreamInLockedState(AudioStream stream, const void *dat
 {
     if (stream.buffer != NULL)
     {
-        if (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1])
+        if (ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[0]) || ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[1]))
         {
             ma_uint32 subBufferToUpdate = 0;
 
-            if (stream.buffer->isSubBufferProcessed[0] && stream.buffer->isSubBufferProcessed[1])
+            if (ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[0]) && ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[1]))
             {
                 // Both buffers are available for updating
                 // Update the first one and make sure the cursor is moved back to the front
+                // NOTE: State sequence is changed, so mixer does not read the stream until the cursor is moved
                 subBufferToUpdate = 0;
-                stream.buffer->frameCursorPos = 0;
+                ma_uint32 sequence = RLChangeAudioBufferState(stream.buffer, 0, 0);
+                RLPushAudioCommand(AUDIO_COMMAND_REWIND, stream.buffer, sequence, 0.0f, NULL);
             }
             else
             {
                 // Just update whichever sub-buffer is processed
-                subBufferToUpdate = (stream.buffer->isSubBufferProcessed[0])? 0 : 1;
+                subBufferToUpdate = ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[0])? 0 : 1;
             }
 
             ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
             unsigned char *subBuffer = stream.buffer->data + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
 
             // Total frames processed in buffer is always the complete size, filled with 0 if required
-            stream.buffer->framesProcessed += subBufferSizeInFrames;
+            ma_atomic_fetch_add_32(&stream.buffer->framesProcessed, subBufferSizeInFrames);
 
             // Does this API expect a whole buffer to be updated in one go?
             // Assuming so, but if not will need to change this logic
@@ -2692,7 +2964,8 @@ static void RLUpdateAudioStreamInLockedState(AudioStream stream, const void *dat
 
                 if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
 
-                stream.buffer->isSubBufferProcessed[subBufferToUpdate] = false;
+                // Sub-buffer is released to the mixer once data is written
+                ma_atomic_store_32(&stream.buffer->isSubBufferProcessed[subBufferToUpdate], false);
             }
             else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
         }
@@ -2700,6 +2973,626 @@ static void RLUpdateAudioStreamInLockedState(AudioStream stream, const void *dat
     }
 }
 
+// Change audio buffer program state flags, returns the new state sequence
+// NOTE: Mixer can clear the playing flag concurrently (buffer ended), so state is updated atomically,
+// every change increases the sequence, mixer only mixes buffers with all state changes received
+static ma_uint32 RLChangeAudioBufferState(AudioBuffer *buffer, ma_uint32 clearFlags, ma_uint32 setFlags)
+{
+    ma_uint32 state = ma_atomic_load_32(&buffer->state);
+    ma_uint32 newState = 0;
+
+    do
+    {
+        ma_uint32 sequence = (state >> AUDIO_STATE_SEQUENCE_SHIFT) + 1;
+        ma_uint32 flags = (state & (AUDIO_STATE_PLAYING | AUDIO_STATE_PAUSED) & ~clearFlags) | setFlags;
+
+        newState = (sequence << AUDIO_STATE_SEQUENCE_SHIFT) | flags;
+
+    } while (!ma_atomic_compare_exchange_strong_32(&buffer->state, &state, newState));
+
+    return (newState >> AUDIO_STATE_SEQUENCE_SHIFT);
+}
+
+// Push command to mixer commands queue, assuming the audio system mutex has been locked
+// NOTE: When the device is not ready there is no mixer running, command is applied directly,
+// commands are never discarded once the program state changed, queue overflow is kept until the mixer applies it
+static void RLPushAudioCommand(int type, AudioBuffer *buffer, ma_uint32 sequence, float value, AudioCallback callback)
+{
+    AudioCommand command = { type, buffer, sequence, value, callback };
+
+    if (!AUDIO.System.isReady)
+    {
+        RLApplyAudioCommand(&command);
+        return;
+    }
+
+    ma_uint32 write = AUDIO.Mixer.commandWrite;
+
+    // NOTE: Commands are queued while there are no overflow commands pending, so queued commands are always older
+    if ((ma_atomic_load_32(&AUDIO.Mixer.overflowCount) == 0) &&
+        ((write - ma_atomic_load_32(&AUDIO.Mixer.commandRead)) < AUDIO_COMMAND_QUEUE_SIZE))
+    {
+        AUDIO.Mixer.commands[write & (AUDIO_COMMAND_QUEUE_SIZE - 1)] = command;
+        ma_atomic_store_32(&AUDIO.Mixer.commandWrite, write + 1);
+        return;
+    }
+
+    // Queue is full, command is added to overflow commands (growing as required), never waiting for the mixer
+    // NOTE: Mixer only holds overflow lock while applying overflow commands, it never waits for it
+    while (ma_atomic_exchange_32(&AUDIO.Mixer.overflowLock, 1) != 0) { }
+
+    int count = (int)ma_atomic_load_32(&AUDIO.Mixer.overflowCount);
+
+    if (count >= AUDIO.Mixer.overflowCapacity)
+    {
+        int capacity = (AUDIO.Mixer.overflowCapacity > 0)? AUDIO.Mixer.overflowCapacity*2 : AUDIO_COMMAND_QUEUE_SIZE;
+        AudioCommand *overflow = (AudioCommand *)RL_REALLOC(AUDIO.Mixer.overflow, capacity*sizeof(AudioCommand));
+
+        if (overflow != NULL)
+        {
+            AUDIO.Mixer.overflow = overflow;
+            AUDIO.Mixer.overflowCapacity = capacity;
+        }
+    }
+
+    if (count < AUDIO.Mixer.overflowCapacity)
+    {
+        AUDIO.Mixer.overflow[count] = command;
+        ma_atomic_store_32(&AUDIO.Mixer.overflowCount, count + 1);
+    }
+    else TRACELOG(LOG_WARNING, "AUDIO: Mixer commands queue is full, command discarded");
+
+    ma_atomic_store_32(&AUDIO.Mixer.overflowLock, 0);
+}
+
+// Apply pending commands, called by mixer before mixing
+static void RLProcessAudioCommands(void)
+{
+    ma_uint32 read = AUDIO.Mixer.commandRead;
+    ma_uint32 write = ma_atomic_load_32(&AUDIO.Mixer.commandWrite);
+
+    while (read != write)
+    {
+        RLApplyAudioCommand(&AUDIO.Mixer.commands[read & (AUDIO_COMMAND_QUEUE_SIZE - 1)]);
+        read++;
+    }
+
+    ma_atomic_store_32(&AUDIO.Mixer.commandRead, read);
+
+    // Overflow commands are applied after queued ones, if program is adding one they are applied on next mix
+    if ((ma_atomic_load_32(&AUDIO.Mixer.overflowCount) > 0) && (ma_atomic_exchange_32(&AUDIO.Mixer.overflowLock, 1) == 0))
+    {
+        ma_uint32 count = ma_atomic_load_32(&AUDIO.Mixer.overflowCount);
+
+        for (ma_uint32 i = 0; i < count; i++) RLApplyAudioCommand(&AUDIO.Mixer.overflow[i]);
+
+        ma_atomic_store_32(&AUDIO.Mixer.overflowCount, 0);
+        ma_atomic_store_32(&AUDIO.Mixer.overflowLock, 0);
+    }
+}
+
+// Apply command to audio buffer, mixer state
+static void RLApplyAudioCommand(const AudioCommand *command)
+{
+    AudioBuffer *buffer = command->buffer;
+
+    switch (command->type)
+    {
+        case AUDIO_COMMAND_PLAY:
+        {
+            buffer->playing = true;
+            buffer->paused = false;
+            ma_atomic_store_32(&buffer->frameCursorPos, 0);
+        } break;
+        case AUDIO_COMMAND_STOP:
+        {
+            buffer->playing = false;
+            buffer->paused = false;
+            ma_atomic_store_32(&buffer->frameCursorPos, 0);
+        } break;
+        case AUDIO_COMMAND_PAUSE: buffer->paused = true; break;
+        case AUDIO_COMMAND_RESUME: buffer->paused = false; break;
+        case AUDIO_COMMAND_REWIND: ma_atomic_store_32(&buffer->frameCursorPos, 0); break;
+        case AUDIO_COMMAND_VOLUME: buffer->volume = command->value; break;
+        case AUDIO_COMMAND_PITCH:
+        {
+            ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/command->value);
+            if (buffer->pitch == 1.0f) ma_data_converter_reset(&buffer->converter);   // Converter could be skipped while not pitched
+            ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
+
+            buffer->pitch = command->value;
+        } break;
+        case AUDIO_COMMAND_PAN: buffer->pan = command->value; break;
+        case AUDIO_COMMAND_CALLBACK: buffer->callback = command->callback; break;
+        default: break;
+    }
+
+    switch (command->type)
+    {
+        case AUDIO_COMMAND_PLAY:
+        case AUDIO_COMMAND_STOP:
+        case AUDIO_COMMAND_PAUSE:
+        case AUDIO_COMMAND_RESUME:
+        case AUDIO_COMMAND_REWIND: buffer->mixSequence = command->sequence; break;
+        default: break;
+    }
+}
+
+// Stop an audio buffer that reached its end, mixer state
+// NOTE: Program state playing flag is cleared only if program did not change the state meanwhile
+static void RLStopAudioBufferInMixer(AudioBuffer *buffer)
+{
+    buffer->playing = false;
+    buffer->paused = false;
+    ma_atomic_store_32(&buffer->frameCursorPos, 0);
+    ma_atomic_store_32(&buffer->framesProcessed, 0);
+    ma_atomic_store_32(&buffer->isSubBufferProcessed[0], true);
+    ma_atomic_store_32(&buffer->isSubBufferProcessed[1], true);
+
+    ma_uint32 expected = (buffer->mixSequence << AUDIO_STATE_SEQUENCE_SHIFT) | AUDIO_STATE_PLAYING;
+    ma_atomic_compare_exchange_strong_32(&buffer->state, &expected, buffer->mixSequence << AUDIO_STATE_SEQUENCE_SHIFT);
+}
+
+// Free object once mixer can not access it anymore, assuming the audio system mutex has been locked
+// NOTE: Object must be unlinked from mixer lists, it is freed after the current mix (if any) and a complete
+// next mix, which also consumes all commands pushed until now (RCU grace period)
+static void RLRetireAudioObject(void *object, int type)
+{
+    ma_uint32 epoch = ma_atomic_load_32(&AUDIO.Mixer.epoch);
+
+    if (AUDIO.Mixer.retiredCount == AUDIO.Mixer.retiredCapacity)
+    {
+        int capacity = (AUDIO.Mixer.retiredCapacity > 0)? AUDIO.Mixer.retiredCapacity*2 : 32;
+        AudioRetired *retired = (AudioRetired *)RL_REALLOC(AUDIO.Mixer.retired, capacity*sizeof(AudioRetired));
+
+        if (retired == NULL)
+        {
+            TRACELOG(LOG_WARNING, "AUDIO: Failed to allocate memory for retired objects, object leaked");
+            return;
+        }
+
+        AUDIO.Mixer.retired = retired;
+        AUDIO.Mixer.retiredCapacity = capacity;
+    }
+
+    AudioRetired *retired = &AUDIO.Mixer.retired[AUDIO.Mixer.retiredCount++];
+    retired->object = object;
+    retired->type = type;
+    retired->epoch = epoch + ((epoch & 1)? 3 : 2);
+
+    if (!AUDIO.System.isReady) RLReclaimAudioObjects(true);
+    else RLReclaimAudioObjects(false);
+}
+
+// Free retired objects not accessible by mixer anymore, assuming the audio system mutex has been locked
+// NOTE: Overflow commands could still reference retired objects, nothing is freed until mixer applies them
+static void RLReclaimAudioObjects(bool force)
+{
+    if (AUDIO.Mixer.retiredCount == 0) return;
+
+    // Mixer is not running while device is stopped and epoch does not advance,
+    // pending commands are applied here and all retired objects can be freed
+    ma_device_state state = ma_device_get_state(&AUDIO.System.device);
+
+    if (!force && ((state == ma_device_state_stopped) || (state == ma_device_state_uninitialized)))
+    {
+        RLProcessAudioCommands();
+        force = (ma_atomic_load_32(&AUDIO.Mixer.overflowCount) == 0);
+    }
+
+    if (!force && (ma_atomic_load_32(&AUDIO.Mixer.overflowCount) > 0)) return;
+
+    ma_uint32 epoch = ma_atomic_load_32(&AUDIO.Mixer.epoch);
+    int count = 0;
+
+    for (int i = 0; i < AUDIO.Mixer.retiredCount; i++)
+    {
+        AudioRetired retired = AUDIO.Mixer.retired[i];
+
+        if (force || ((int)(epoch - retired.epoch) >= 0))
+        {
+            if (retired.type == AUDIO_RETIRED_PROCESSOR) RL_FREE(retired.object);
+            else
+            {
+                AudioBuffer *buffer = (AudioBuffer *)retired.object;
+
+                ma_data_converter_uninit(&buffer->converter, NULL);
+                if (retired.type == AUDIO_RETIRED_BUFFER) RL_FREE(buffer->data);
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+                if ((retired.type == AUDIO_RETIRED_BUFFER) && (buffer->decoder != NULL))
+                {
+                    RL_FREE(buffer->decoder->ring);
+                    RL_FREE(buffer->decoder);
+                }
+#endif
+                RL_FREE(buffer);
+            }
+        }
+        else AUDIO.Mixer.retired[count++] = retired;
+    }
+
+    AUDIO.Mixer.retiredCount = count;
+}
+
+// Decode music frames, restarting from beginning at the end
+// NOTE: Returns the number of frames decoded, module formats always generate the frames requested
+static int RLReadMusicFrames(Music music, void *pcm, int frameCount)
+{
+    int frameSize = music.stream.channels*music.stream.sampleSize/8;
+
+    int frameCountStillNeeded = frameCount;
+    int frameCountReadTotal = 0;
+
+    switch (music.ctxType)
+    {
+    #if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV:
+        {
+            if (music.stream.sampleSize == 16)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)pcm + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+            else if (music.stream.sampleSize == 32)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)pcm + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG:
+        {
+            while (true)
+            {
+                int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)pcm + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)pcm + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA:
+        {
+            unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)pcm, frameCount);
+            frameCountReadTotal += frameCountRead;
+            /*
+            while (true)
+            {
+                int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)pcm + frameCountReadTotal*frameSize),  frameCountStillNeeded);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else qoaplay_rewind((qoaplay_desc *)music.ctxData);
+            }
+            */
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)pcm + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drflac__seek_to_first_frame((drflac *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM:
+        {
+            // NOTE: Internally we consider 2 channels generation, so sampleCount/2
+            if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)pcm, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)pcm, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)pcm, frameCount);
+            //jar_xm_reset((jar_xm_context_t *)music.ctxData);
+            frameCountReadTotal = frameCount;
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD:
+        {
+            // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
+            jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)pcm, frameCount, 0);
+            //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
+            frameCountReadTotal = frameCount;
+
+        } break;
+    #endif
+        default: break;
+    }
+
+    return frameCountReadTotal;
+}
+
+// Move music context decoding back to the beginning
+static void RLRewindMusicContext(Music music)
+{
+    switch (music.ctxType)
+    {
+#if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
+#endif
+        default: break;
+    }
+}
+
+#if defined(SUPPORT_MUSIC_DECODER_THREAD)
+// Load music decoder for a music stream, starting decoder thread if required
+// NOTE: Ring buffer keeps the read-ahead time requested, rounded up to a power of two frames
+static void RLLoadMusicDecoder(Music music)
+{
+    ma_uint32 frames = (ma_uint32)((ma_uint64)AUDIO.Decoder.readAhead*music.stream.sampleRate/1000);
+    ma_uint32 capacity = MUSIC_DECODER_CHUNK_FRAMES;
+    while (capacity < frames) capacity *= 2;
+
+    MusicDecoder *decoder = (MusicDecoder *)RL_CALLOC(1, sizeof(MusicDecoder));
+    if (decoder != NULL) decoder->ring = (unsigned char *)RL_MALLOC(capacity*music.stream.channels*music.stream.sampleSize/8);
+
+    if ((decoder == NULL) || (decoder->ring == NULL))
+    {
+        RL_FREE(decoder);
+        TRACELOG(LOG_WARNING, "STREAM: Failed to allocate music decoder, music decoded on UpdateMusicStream()");
+        return;
+    }
+
+    decoder->music = music;
+    decoder->capacity = capacity;
+    decoder->looping = music.looping;
+
+    if (!AUDIO.Decoder.running)
+    {
+        if (ma_mutex_init(&AUDIO.Decoder.lock) != MA_SUCCESS)
+        {
+            RL_FREE(decoder->ring);
+            RL_FREE(decoder);
+            TRACELOG(LOG_WARNING, "STREAM: Failed to create mutex for music decoder thread");
+            return;
+        }
+
+        ma_atomic_store_32(&AUDIO.Decoder.shutdown, false);
+
+        if (ma_thread_create(&AUDIO.Decoder.thread, ma_thread_priority_default, 0, RLMusicDecoderThread, NULL, NULL) != MA_SUCCESS)
+        {
+            ma_mutex_uninit(&AUDIO.Decoder.lock);
+            RL_FREE(decoder->ring);
+            RL_FREE(decoder);
+            TRACELOG(LOG_WARNING, "STREAM: Failed to create music decoder thread");
+            return;
+        }
+
+        AUDIO.Decoder.running = true;
+        TRACELOG(LOG_INFO, "STREAM: Music decoder thread initialized successfully");
+    }
+
+    // Decoder is attached before the stream can be played, mixer receives it with the play command
+    music.stream.buffer->decoder = decoder;
+
+    ma_mutex_lock(&AUDIO.Decoder.lock);
+    decoder->next = AUDIO.Decoder.first;
+    AUDIO.Decoder.first = decoder;
+    ma_mutex_unlock(&AUDIO.Decoder.lock);
+}
+
+// Remove music decoder from decoder thread
+// NOTE: Decoder memory is freed with the stream audio buffer, once the mixer can not access it anymore
+static void RLUnloadMusicDecoder(Music music)
+{
+    MusicDecoder *decoder = music.stream.buffer->decoder;
+
+    if (AUDIO.Decoder.running) ma_mutex_lock(&AUDIO.Decoder.lock);
+
+    for (MusicDecoder **link = &AUDIO.Decoder.first; *link != NULL; link = &(*link)->next)
+    {
+        if (*link == decoder)
+        {
+            *link = decoder->next;
+            break;
+        }
+    }
+
+    if (AUDIO.Decoder.running) ma_mutex_unlock(&AUDIO.Decoder.lock);
+}
+
+// Restart decoding from a music frame, discarding frames decoded before, assuming decoders lock
+// NOTE: Music context must be already moved to the requested frame
+static void RLResetMusicDecoder(MusicDecoder *decoder, unsigned int frame)
+{
+    ma_uint32 writePos = ma_atomic_load_32(&decoder->writePos);
+
+    decoder->cursor = frame;
+    decoder->startFrame = frame;
+    decoder->startPos = writePos;
+
+    ma_atomic_store_32(&decoder->discardPos, writePos);
+    ma_atomic_store_32(&decoder->finished, false);
+    ma_atomic_store_32(&decoder->ended, false);
+}
+
+// Decode music frames into decoder ring buffer, until the end of the music (decoder thread)
+// NOTE: Decoding waits for a quarter of the ring buffer to be free, to decode in reasonable chunks
+static void RLDecodeMusicAhead(MusicDecoder *decoder)
+{
+    if (ma_atomic_load_32(&decoder->ended)) return;
+
+    Music music = decoder->music;
+    ma_uint32 frameSize = music.stream.channels*music.stream.sampleSize/8;
+    ma_uint32 writePos = ma_atomic_load_32(&decoder->writePos);
+    ma_uint32 readPos = ma_atomic_load_32(&decoder->readPos);
+
+    // NOTE: Only frames released by the mixer are free, frames discarded on seek/stop are reused
+    // once the mixer skips them (the mixer could be still copying them)
+    ma_uint32 framesFree = decoder->capacity - (writePos - readPos);
+    ma_uint32 framesLeft = music.frameCount - decoder->cursor;
+    ma_uint32 frames = (framesFree < MUSIC_DECODER_CHUNK_FRAMES)? framesFree : MUSIC_DECODER_CHUNK_FRAMES;
+
+    if (frames > framesLeft) frames = framesLeft;
+    if ((frames < decoder->capacity/4) && (frames < framesLeft)) return;
+
+    // Ring buffer region can wrap around, decoded in two parts
+    ma_uint32 offset = writePos & (decoder->capacity - 1);
+    ma_uint32 framesFirst = (frames < decoder->capacity - offset)? frames : decoder->capacity - offset;
+
+    RLReadMusicFrames(music, decoder->ring + offset*frameSize, framesFirst);
+    if (frames > framesFirst) RLReadMusicFrames(music, decoder->ring, frames - framesFirst);
+
+    // Frames are released to the mixer once decoded
+    ma_atomic_store_32(&decoder->writePos, writePos + frames);
+    decoder->cursor += frames;
+
+    if (decoder->cursor >= music.frameCount)
+    {
+        if (ma_atomic_load_32(&decoder->looping))
+        {
+            RLRewindMusicContext(music);
+            decoder->cursor = 0;
+        }
+        else ma_atomic_store_32(&decoder->ended, true);
+    }
+}
+
+// Read decoded frames from music decoder ring buffer (mixer)
+// NOTE: Missing frames are filled with silence (underrun), unless the music decoding ended
+static ma_uint32 RLReadMusicDecoderFrames(AudioBuffer *audioBuffer, void *framesOut, ma_uint32 frameCount)
+{
+    MusicDecoder *decoder = audioBuffer->decoder;
+    ma_uint32 frameSize = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
+
+    // NOTE: Ended flag is checked before write position, so no frames written before the end are missed
+    bool ended = ma_atomic_load_32(&decoder->ended);
+
+    // Frames decoded before a seek or stop are skipped
+    RLDiscardMusicDecoderFrames(decoder);
+    ma_uint32 readPos = ma_atomic_load_32(&decoder->readPos);
+
+    ma_uint32 framesAvailable = ma_atomic_load_32(&decoder->writePos) - readPos;
+    if (framesAvailable > decoder->capacity) framesAvailable = decoder->capacity;
+
+    ma_uint32 framesRead = (framesAvailable < frameCount)? framesAvailable : frameCount;
+    ma_uint32 offset = readPos & (decoder->capacity - 1);
+    ma_uint32 framesFirst = (framesRead < decoder->capacity - offset)? framesRead : decoder->capacity - offset;
+
+    memcpy(framesOut, decoder->ring + offset*frameSize, framesFirst*frameSize);
+    memcpy((unsigned char *)framesOut + framesFirst*frameSize, decoder->ring, (framesRead - framesFirst)*frameSize);
+
+    ma_atomic_store_32(&decoder->readPos, readPos + framesRead);
+
+    if (framesRead < frameCount)
+    {
+        if (ended)
+        {
+            ma_atomic_store_32(&decoder->finished, true);
+            RLStopAudioBufferInMixer(audioBuffer);
+        }
+        else
+        {
+            memset((unsigned char *)framesOut + framesRead*frameSize, 0, (frameCount - framesRead)*frameSize);
+            framesRead = frameCount;
+
+            // Decoder thread did not provide data in time
+            if (audioBuffer->playing) audioBuffer->underrun = true;
+        }
+    }
+
+    return framesRead;
+}
+
+// Skip frames decoded before a seek or stop, releasing their ring buffer space to the decoder thread (mixer)
+// NOTE: Read position is only written by the mixer, decoder thread reuses discarded frames once skipped here
+static void RLDiscardMusicDecoderFrames(MusicDecoder *decoder)
+{
+    ma_uint32 readPos = ma_atomic_load_32(&decoder->readPos);
+    ma_uint32 discardPos = ma_atomic_load_32(&decoder->discardPos);
+
+    if ((ma_int32)(discardPos - readPos) > 0) ma_atomic_store_32(&decoder->readPos, discardPos);
+}
+
+// Music decoder thread, keeps all music streams decoded ahead
+static ma_thread_result MA_THREADCALL RLMusicDecoderThread(void *userData)
+{
+    (void)userData;
+
+    ma_timer timer = { 0 };
+    ma_timer_init(&timer);
+
+    double windowStart = 0.0;
+    double decodeTime = 0.0;
+
+    while (!ma_atomic_load_32(&AUDIO.Decoder.shutdown))
+    {
+        double updateStart = ma_timer_get_time_in_seconds(&timer);
+
+        ma_mutex_lock(&AUDIO.Decoder.lock);
+        for (MusicDecoder *decoder = AUDIO.Decoder.first; decoder != NULL; decoder = decoder->next) RLDecodeMusicAhead(decoder);
+        ma_mutex_unlock(&AUDIO.Decoder.lock);
+
+        double updateEnd = ma_timer_get_time_in_seconds(&timer);
+        decodeTime += (updateEnd - updateStart);
+
+        // Decoder load is measured over (at least) one second windows
+        if ((updateEnd - windowStart) >= 1.0)
+        {
+            ma_atomic_store_32(&AUDIO.Decoder.load, (ma_uint32)(decodeTime*10000.0/(updateEnd - windowStart)));
+            windowStart = updateEnd;
+            decodeTime = 0.0;
+        }
+
+        ma_sleep(MUSIC_DECODER_INTERVAL_MS);
+    }
+
+    return (ma_thread_result)0;
+}
+#endif
+
 // Some required functions for audio standalone module version
 #if defined(RAUDIO_STANDALONE)
 // Check file extension
@@ -312,6 +312,10 @@ typedef struct GlyphInfo {
     Image image;            // Character image data
 } GlyphInfo;
 
+// Opaque struct declaration
+// NOTE: Actual struct is defined internally in rtext module
+typedef struct rGlyphLookup rGlyphLookup;
+
 // Font, font texture and GlyphInfo array data
 typedef struct Font {
     int baseSize;           // Base size (default chars height)
@@ -320,8 +324,23 @@ typedef struct Font {
     Texture2D texture;      // Texture atlas containing the glyphs
     Rectangle *recs;        // Rectangles in texture for the glyphs
     GlyphInfo *glyphs;      // Glyphs info data
+    rGlyphLookup *lookup;   // Glyphs lookup table, codepoint to glyph index (optional)
 } Font;
 
+// TextRun, text laid out once (codepoints decoded, glyphs resolved, positions computed) for repeated drawing
+// NOTE: positions, codepoints and glyphIndices share a single allocation
+typedef struct TextRun {
+    Font font;              // Font used for layout
+    float fontSize;         // Font size used for layout
+    float spacing;          // Characters spacing used for layout
+    int lineSpacing;        // Line spacing used for layout [SetTextLineSpacing()]
+    int glyphCount;         // Number of glyphs positioned (visible characters)
+    Vector2 *positions;     // Glyphs positions, relative to run position
+    int *codepoints;        // Glyphs codepoints
+    int *glyphIndices;      // Glyphs indices in font
+    Vector2 size;           // Run size (same as MeasureTextEx() if not wrapped)
+} TextRun;
+
 // Camera, defines position/orientation in 3d space
 typedef struct Camera3D {
     Vector3 position;       // Camera position
@@ -426,6 +445,16 @@ typedef struct ModelAnimation {
     char name[32];          // Animation name
 } ModelAnimation;
 
+// ModelAnimationCompressed, quantized and keyframe-reduced animation tracks
+typedef struct ModelAnimationCompressed {
+    int boneCount;          // Number of bones
+    int frameCount;         // Number of animation frames
+    BoneInfo *bones;        // Bones information (skeleton)
+    unsigned char *data;    // Compressed tracks data (translation, rotation and scale tracks per bone)
+    int dataSize;           // Compressed tracks data size in bytes
+    char name[32];          // Animation name
+} ModelAnimationCompressed;
+
 // Ray, ray for raycasting
 typedef struct Ray {
     Vector3 position;       // Ray position (origin)
@@ -446,6 +475,48 @@ typedef struct BoundingBox {
     Vector3 max;            // Maximum vertex box-corner
 } BoundingBox;
 
+// Opaque struct declaration
+// NOTE: Actual struct is defined internally in rmodels module
+typedef struct rMeshBVHNode rMeshBVHNode;
+
+// MeshBVH, mesh bounding volume hierarchy for fast ray queries
+typedef struct MeshBVH {
+    int nodeCount;          // Number of hierarchy nodes
+    int triangleCount;      // Number of triangles
+    rMeshBVHNode *nodes;    // Hierarchy nodes (flattened, depth-first)
+    float *triangles;       // Triangles vertex positions, sorted by leaf node (XYZ - 9 components per triangle)
+} MeshBVH;
+
+// InstanceAttribute, custom per-instance shader attribute layout
+typedef struct InstanceAttribute {
+    int location;           // Shader attribute location
+    int type;               // Attribute data type (ShaderAttributeDataType)
+    int offset;             // Attribute offset in instance custom data (bytes)
+} InstanceAttribute;
+
+// InstanceBuffer, per-instance data (transform and custom attributes) stored on GPU for instanced drawing
+typedef struct InstanceBuffer {
+    unsigned int vboId;     // OpenGL vertex buffer object id
+    int mode;               // Buffer update mode (InstanceBufferMode)
+    int capacity;           // Maximum number of instances
+    int instanceCount;      // Number of instances with data
+    int dataSize;           // Instance custom data size (bytes)
+    int stride;             // Instance data size: transform (16 floats) + custom data (bytes)
+    int segment;            // Current buffer segment used for drawing (INSTANCE_BUFFER_RING)
+    int attributeCount;     // Number of custom attributes
+    InstanceAttribute *attributes; // Custom attributes layout
+    unsigned char *data;    // Instances data copy (RAM)
+} InstanceBuffer;
+
+// Opaque structs declaration
+// NOTE: Actual struct is defined internally in rtextures module
+typedef struct rSpriteQueue rSpriteQueue;
+
+// SpriteQueue, textured quads collected for deferred drawing, sorted by layer, blend mode, shader and texture
+typedef struct SpriteQueue {
+    rSpriteQueue *data;     // Pointer to internal queue data (sprites, sort keys and drawing state)
+} SpriteQueue;
+
 // Wave, audio wave data
 typedef struct Wave {
     unsigned int frameCount;    // Total number of frames (considering channels)
@@ -532,6 +603,31 @@ typedef struct AutomationEventList {
     AutomationEvent *events;        // Events entries
 } AutomationEventList;
 
+// Opaque structs declaration
+// NOTE: Actual struct is defined internally in rcore module
+typedef struct rCompressStream rCompressStream;
+
+// CompressStream, DEFLATE data compressed or decompressed in chunks, reusable for multiple streams
+typedef struct CompressStream {
+    rCompressStream *data;          // Pointer to internal stream data (compressor/decompressor state and buffers)
+} CompressStream;
+
+// MappedFile, file data mapped read-only in memory
+typedef struct MappedFile {
+    const unsigned char *data;      // File data (read-only, not '\0' terminated)
+    long long size;                 // File data size in bytes
+    bool mapped;                    // File data is mapped by the system (otherwise loaded with LoadFileData())
+} MappedFile;
+
+// Opaque structs declaration
+// NOTE: Actual struct is defined internally in utils module
+typedef struct rAssetPack rAssetPack;
+
+// AssetPack, files packed in a single archive with a hash index, read by name
+typedef struct AssetPack {
+    rAssetPack *data;               // Pointer to internal pack data (pack file data and index)
+} AssetPack;
+
 //----------------------------------------------------------------------------------
 // Enumerators Definition
 //----------------------------------------------------------------------------------
@@ -828,6 +924,13 @@ typedef enum {
     SHADER_ATTRIB_VEC4              // Shader attribute type: vec4 (4 float)
 } ShaderAttributeDataType;
 
+// Instance buffer update modes
+typedef enum {
+    INSTANCE_BUFFER_STATIC = 0,     // Updated ranges are uploaded in place (GPU could sync), for data rarely updated
+    INSTANCE_BUFFER_ORPHAN,         // Buffer storage orphaned and instances uploaded on every update
+    INSTANCE_BUFFER_RING            // Instances uploaded on every update to next buffer segment (round-robin)
+} InstanceBufferMode;
+
 // Pixel formats
 // NOTE: Support depends on OpenGL version and platform
 typedef enum {
@@ -1092,6 +1195,11 @@ RLAPI void RLUnloadRandomSequence(int *sequence);                   // Unload ra
 
 // Misc. functions
 RLAPI void RLTakeScreenshot(const char *fileName);                  // Takes a screenshot of current screen (filename extension defines format)
+RLAPI bool RLStartScreenRecording(const char *fileName);            // Start screen recording (.gif, .y4m or raw RGBA frames), frames encoded on background thread
+RLAPI void RLStopScreenRecording(void);                             // Stop screen recording, waits for pending frames and saves output
+RLAPI bool RLIsScreenRecording(void);                               // Check if screen recording is active
+RLAPI int RLGetScreenRecordingBacklog(void);                        // Get number of recorded frames waiting to be encoded
+RLAPI int RLGetScreenRecordingDroppedFrames(void);                  // Get number of frames dropped on screen recording (encoder behind)
 RLAPI void RLSetConfigFlags(unsigned int flags);                    // Setup init configuration flags (view FLAGS)
 RLAPI void RLOpenURL(const char *url);                              // Open URL with default system browser (if available)
 
@@ -1114,11 +1222,25 @@ RLAPI void RLSetSaveFileTextCallback(SaveFileTextCallback callback); // Set cust
 // Files management functions
 RLAPI unsigned char * RLLoadFileData(const char *fileName, int *dataSize); // Load file data as byte array (read)
 RLAPI void RLUnloadFileData(unsigned char *data);                   // Unload file data allocated by LoadFileData()
+RLAPI MappedFile RLLoadMappedFile(const char *fileName);             // Load file data mapped read-only in memory, 64bit size (loaded with LoadFileData() if mapping not available)
+RLAPI bool RLIsMappedFileValid(MappedFile file);                    // Check if a mapped file is valid (data available)
+RLAPI void RLUnloadMappedFile(MappedFile file);                     // Unload mapped file data
 RLAPI bool RLSaveFileData(const char *fileName, void *data, int dataSize); // Save data to file from byte array (write), returns true on success
 RLAPI bool RLExportDataAsCode(const unsigned char *data, int dataSize, const char *fileName); // Export data to code (.h), returns true on success
 RLAPI char * RLLoadFileText(const char *fileName);                   // Load text data from file (read), returns a '\0' terminated string
 RLAPI void RLUnloadFileText(char *text);                            // Unload file text data allocated by LoadFileText()
 RLAPI bool RLSaveFileText(const char *fileName, char *text);        // Save text data to file (write), string must be '\0' terminated, returns true on success
+
+// Asset packs management functions
+// NOTE: Mounted packs are read by RLLoadAssetPackFileData()/RLLoadAssetPackFileText(), to be set as file loading callbacks
+RLAPI AssetPack RLLoadAssetPack(const char *fileName);               // Load asset pack (mapped in memory), only index is read
+RLAPI bool RLIsAssetPackValid(AssetPack pack);                      // Check if an asset pack is valid
+RLAPI void RLUnloadAssetPack(AssetPack pack);                       // Unload asset pack (unmounted if required)
+RLAPI bool RLMountAssetPack(AssetPack pack);                        // Mount asset pack, last mounted pack is searched first, returns true on success
+RLAPI void RLUnmountAssetPack(AssetPack pack);                      // Unmount asset pack, files data loaded from pack must be unloaded before
+RLAPI unsigned char * RLLoadAssetPackFileData(const char *fileName, int *dataSize); // Load file data from mounted asset packs or file system if not packed (LoadFileDataCallback)
+RLAPI char * RLLoadAssetPackFileText(const char *fileName);          // Load text data from mounted asset packs or file system if not packed (LoadFileTextCallback)
+RLAPI bool RLExportAssetPack(const char *fileName, FilePathList files, bool compress); // Export files to asset pack, optionally compressed (DEFLATE), returns true on success
 //------------------------------------------------------------------
 
 // File system functions
@@ -1148,6 +1270,12 @@ RLAPI long RLGetFileModTime(const char *fileName);                  // Get file
 // Compression/Encoding functionality
 RLAPI unsigned char * RLCompressData(const unsigned char *data, int dataSize, int *compDataSize);        // Compress data (DEFLATE algorithm), memory must be MemFree()
 RLAPI unsigned char * RLDecompressData(const unsigned char *compData, int compDataSize, int *dataSize);  // Decompress data (DEFLATE algorithm), memory must be MemFree()
+RLAPI CompressStream RLLoadCompressStream(void);                                                       // Load compression stream (DEFLATE algorithm), data compressed in chunks
+RLAPI CompressStream RLLoadDecompressStream(void);                                                     // Load decompression stream (DEFLATE algorithm), data decompressed in chunks
+RLAPI bool RLIsCompressStreamValid(CompressStream stream);                                             // Check if a compression stream is valid
+RLAPI void RLUnloadCompressStream(CompressStream stream);                                              // Unload compression stream
+RLAPI const unsigned char *RLUpdateCompressStream(CompressStream stream, const unsigned char *data, int dataSize, int *outputSize); // Update compression stream with data chunk, returns output available (valid until next stream call)
+RLAPI const unsigned char *RLFinishCompressStream(CompressStream stream, int *outputSize);             // Finish compression stream, returns last output available (NULL on invalid data), stream reusable
 RLAPI char * RLEncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize);               // Encode data to Base64 string, memory must be MemFree()
 RLAPI unsigned char * RLDecodeDataBase64(const unsigned char *data, int *outputSize);                    // Decode Base64 string data, memory must be MemFree()
 RLAPI unsigned int RLComputeCRC32(unsigned char *data, int dataSize);     // Compute CRC32 hash code
@@ -1265,6 +1393,7 @@ RLAPI void RLDrawRingLines(Vector2 center, float innerRadius, float outerRadius,
 RLAPI void RLDrawRectangle(int posX, int posY, int width, int height, Color color);                        // Draw a color-filled rectangle
 RLAPI void RLDrawRectangleV(Vector2 position, Vector2 size, Color color);                                  // Draw a color-filled rectangle (Vector version)
 RLAPI void RLDrawRectangleRec(Rectangle rec, Color color);                                                 // Draw a color-filled rectangle
+RLAPI void RLQueueRectangle(SpriteQueue queue, Rectangle rec, Color color);                                // Queue a color-filled rectangle on sprite queue
 RLAPI void RLDrawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color);                 // Draw a color-filled rectangle with pro parameters
 RLAPI void RLDrawRectangleGradientV(int posX, int posY, int width, int height, Color top, Color bottom);   // Draw a vertical-gradient-filled rectangle
 RLAPI void RLDrawRectangleGradientH(int posX, int posY, int width, int height, Color left, Color right);   // Draw a horizontal-gradient-filled rectangle
@@ -1433,6 +1562,20 @@ RLAPI void RLDrawTextureRec(Texture2D texture, Rectangle source, Vector2 positio
 RLAPI void RLDrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draw a part of a texture defined by a rectangle with 'pro' parameters
 RLAPI void RLDrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle dest, Vector2 origin, float rotation, Color tint); // Draws a texture (or part of it) that stretches or shrinks nicely
 
+// Sprite queue functions (deferred drawing)
+// NOTE: Queued sprites are sorted by layer, then blend mode, shader and texture, so quads sharing
+// state are drawn together; insertion order is only kept for sprites sharing all of them
+RLAPI SpriteQueue RLLoadSpriteQueue(int capacity);                                                         // Load sprite queue, capacity grows as required
+RLAPI bool RLIsSpriteQueueValid(SpriteQueue queue);                                                       // Check if a sprite queue is valid
+RLAPI void RLUnloadSpriteQueue(SpriteQueue queue);                                                        // Unload sprite queue
+RLAPI void RLSetSpriteQueueLayer(SpriteQueue queue, int layer);                                           // Set layer for next queued sprites (lower layers drawn first)
+RLAPI void RLSetSpriteQueueBlendMode(SpriteQueue queue, int mode);                                        // Set blend mode for next queued sprites (BlendMode)
+RLAPI void RLSetSpriteQueueShader(SpriteQueue queue, Shader shader);                                      // Set shader for next queued sprites
+RLAPI void RLQueueTexturePro(SpriteQueue queue, Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint); // Queue a part of a texture with 'pro' parameters
+RLAPI int RLGetSpriteQueueCount(SpriteQueue queue);                                                       // Get number of sprites queued
+RLAPI void RLClearSpriteQueue(SpriteQueue queue);                                                         // Clear queued sprites, without drawing
+RLAPI void RLDrawSpriteQueue(SpriteQueue queue);                                                          // Draw queued sprites (sorted) and clear queue
+
 // Color/pixel related functions
 RLAPI bool RLColorIsEqual(Color col1, Color col2);                            // Check if two colors are equal
 RLAPI Color RLFade(Color color, float alpha);                                 // Get color with alpha applied, alpha goes from 0.0f to 1.0f
@@ -1462,6 +1605,9 @@ RLAPI Font RLLoadFont(const char *fileName);
 RLAPI Font RLLoadFontEx(const char *fileName, int fontSize, int *codepoints, int codepointCount); // Load font from file with extended parameters, use NULL for codepoints and 0 for codepointCount to load the default character set, font size is provided in pixels height
 RLAPI Font RLLoadFontFromImage(Image image, Color key, int firstChar);                        // Load font from Image (XNA style)
 RLAPI Font RLLoadFontFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount); // Load font from memory buffer, fileType refers to extension: i.e. '.ttf'
+RLAPI Font RLLoadFontDynamic(const char *fileName, int fontSize, int glyphCapacity);          // Load font from file with glyphs rasterized on first use, up to glyphCapacity glyphs kept on atlas (least recently used evicted)
+RLAPI Font RLLoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int glyphCapacity); // Load font from memory buffer with glyphs rasterized on first use, fileType refers to extension: i.e. '.ttf'
+RLAPI bool RLIsFontDynamic(Font font);                                                        // Check if font glyphs are rasterized on first use (dynamic font)
 RLAPI bool RLIsFontValid(Font font);                                                          // Check if a font is valid (font data loaded, WARNING: GPU texture not checked)
 RLAPI GlyphInfo * RLLoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type); // Load font data for further use
 RLAPI Image RLGenImageFontAtlas(const GlyphInfo *glyphs, Rectangle **glyphRecs, int glyphCount, int fontSize, int padding, int packMethod); // Generate image font atlas using chars info
@@ -1473,12 +1619,20 @@ RLAPI bool RLExportFontAsCode(Font font, const char *fileName);
 RLAPI void RLDrawFPS(int posX, int posY);                                                     // Draw current FPS
 RLAPI void RLDrawText(const char *text, int posX, int posY, int fontSize, Color color);       // Draw text (using default font)
 RLAPI void RLDrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Draw text using font and additional parameters
+RLAPI void RLQueueTextEx(SpriteQueue queue, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint); // Queue text using font and additional parameters on sprite queue
 RLAPI void RLDrawTextPro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint); // Draw text using Font and pro parameters (rotation)
 RLAPI void RLDrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint); // Draw one character (codepoint)
 RLAPI void RLDrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint); // Draw multiple character (codepoint)
 
+// Text run functions (text laid out once for repeated drawing)
+RLAPI TextRun RLLoadTextRun(Font font, const char *text, float fontSize, float spacing, float wrapWidth); // Load text run, words wrapped to wrapWidth (0 for no wrapping)
+RLAPI bool RLIsTextRunValid(TextRun run);                                                     // Check if a text run is valid
+RLAPI void RLUnloadTextRun(TextRun run);                                                      // Unload text run
+RLAPI void RLDrawTextRun(TextRun run, Vector2 position, Color tint);                          // Draw text run
+
 // Text font info functions
 RLAPI void RLSetTextLineSpacing(int spacing);                                                 // Set vertical line spacing when drawing with line-breaks
+RLAPI int RLGetTextLineSpacing(void);                                                         // Get vertical line spacing when drawing with line-breaks
 RLAPI int RLMeasureText(const char *text, int fontSize);                                      // Measure string width for default font
 RLAPI Vector2 RLMeasureTextEx(Font font, const char *text, float fontSize, float spacing);    // Measure string size for Font
 RLAPI int RLGetGlyphIndex(Font font, int codepoint);                                          // Get glyph index position in font for a codepoint (unicode character), fallback to '?' if not found
@@ -1574,6 +1728,11 @@ RLAPI void RLUpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSi
 RLAPI void RLUnloadMesh(Mesh mesh);                                                           // Unload mesh data from CPU and GPU
 RLAPI void RLDrawMesh(Mesh mesh, Material material, Matrix transform);                        // Draw a 3d mesh with material and transform
 RLAPI void RLDrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
+RLAPI InstanceBuffer RLLoadInstanceBuffer(int capacity, const InstanceAttribute *attributes, int attributeCount, int mode); // Load instance buffer for instanced drawing, custom attributes optional
+RLAPI bool RLIsInstanceBufferValid(InstanceBuffer buffer);                                     // Check if an instance buffer is valid (data loaded in RAM and VRAM)
+RLAPI void RLUnloadInstanceBuffer(InstanceBuffer buffer);                                      // Unload instance buffer from CPU and GPU
+RLAPI void RLUpdateInstanceBuffer(InstanceBuffer *buffer, const Matrix *transforms, const void *data, int offset, int count); // Update instances transforms and/or custom data (NULL to keep), uploaded to GPU
+RLAPI void RLDrawMeshInstancedBuffer(Mesh mesh, Material material, InstanceBuffer buffer, int offset, int count); // Draw multiple mesh instances with material, using instance buffer data
 RLAPI BoundingBox RLGetMeshBoundingBox(Mesh mesh);                                            // Compute mesh bounding box limits
 RLAPI void RLGenMeshTangents(Mesh *mesh);                                                     // Compute mesh tangents
 RLAPI bool RLExportMesh(Mesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
@@ -1604,9 +1763,23 @@ RLAPI void RLSetModelMeshMaterial(Model *model, int meshId, int materialId);
 RLAPI ModelAnimation * RLLoadModelAnimations(const char *fileName, int *animCount);            // Load model animations from file
 RLAPI void RLUpdateModelAnimation(Model model, ModelAnimation anim, int frame);               // Update model animation pose (CPU)
 RLAPI void RLUpdateModelAnimationBones(Model model, ModelAnimation anim, int frame);          // Update model animation mesh bone matrices (GPU skinning)
+RLAPI void RLUpdateModelAnimationPose(Model model, const Transform *pose);                    // Update model animation pose from bone transforms (CPU)
+RLAPI void RLUpdateModelAnimationPoseBones(Model model, const Transform *pose);               // Update model mesh bone matrices from bone transforms (GPU skinning)
+RLAPI void RLSampleModelAnimation(ModelAnimation anim, float frame, Transform *pose);         // Sample animation pose at fractional frame (interpolated), pose requires anim.boneCount transforms
+RLAPI void RLBlendModelAnimations(const ModelAnimation *animations, const float *frames, const float *weights, int count, Transform *pose); // Sample multiple animations and blend them by weight
+RLAPI void RLBlendModelAnimationLayer(ModelAnimation anim, float frame, float weight, const float *boneMask, Transform *pose); // Sample animation and blend it over pose, optional per-bone mask
+RLAPI int RLGetModelAnimationVertexCount(void);                                               // Get number of vertices skinned on last UpdateModelAnimation() call (CPU)
+RLAPI float RLGetModelAnimationVertexRate(void);                                              // Get CPU skinning throughput of last UpdateModelAnimation() call (vertices per second)
 RLAPI void RLUnloadModelAnimation(ModelAnimation anim);                                       // Unload animation data
 RLAPI void RLUnloadModelAnimations(ModelAnimation *animations, int animCount);                // Unload animation array data
 RLAPI bool RLIsModelAnimationValid(Model model, ModelAnimation anim);                         // Check model animation skeleton match
+RLAPI ModelAnimationCompressed RLCompressModelAnimation(ModelAnimation anim, float tolerance); // Compress animation: quantized tracks, constant tracks elision and keyframe reduction within tolerance (quantization error included)
+RLAPI ModelAnimation RLDecompressModelAnimation(ModelAnimationCompressed anim);                // Decompress animation into full sampled frame poses
+RLAPI void RLSampleModelAnimationCompressed(ModelAnimationCompressed anim, float frame, Transform *pose); // Sample compressed animation pose at fractional frame (decompressed on the fly)
+RLAPI ModelAnimationCompressed *RLLoadModelAnimationsCompressed(const char *fileName, int *animCount); // Load compressed model animations from file (.ranim)
+RLAPI bool RLExportModelAnimationsCompressed(const ModelAnimationCompressed *animations, int animCount, const char *fileName); // Export compressed model animations to file (.ranim)
+RLAPI void RLUnloadModelAnimationCompressed(ModelAnimationCompressed anim);                   // Unload compressed animation data
+RLAPI void RLUnloadModelAnimationsCompressed(ModelAnimationCompressed *animations, int animCount); // Unload compressed animation array data
 
 // Collision detection functions
 RLAPI bool RLCheckCollisionSpheres(Vector3 center1, float radius1, Vector3 center2, float radius2);   // Check collision between two spheres
@@ -1615,6 +1788,11 @@ RLAPI bool RLCheckCollisionBoxSphere(BoundingBox box, Vector3 center, float radi
 RLAPI RayCollision RLGetRayCollisionSphere(Ray ray, Vector3 center, float radius);                    // Get collision info between ray and sphere
 RLAPI RayCollision RLGetRayCollisionBox(Ray ray, BoundingBox box);                                    // Get collision info between ray and box
 RLAPI RayCollision RLGetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform);                       // Get collision info between ray and mesh
+RLAPI MeshBVH RLLoadMeshBVH(Mesh mesh);                                                         // Load mesh bounding volume hierarchy for fast ray queries (static meshes)
+RLAPI bool RLIsMeshBVHValid(MeshBVH bvh);                                                       // Check if mesh BVH is valid (loaded)
+RLAPI void RLUnloadMeshBVH(MeshBVH bvh);                                                        // Unload mesh BVH data
+RLAPI RayCollision RLGetRayCollisionMeshBVH(Ray ray, MeshBVH bvh, Matrix transform);            // Get collision info between ray and mesh, using mesh BVH
+RLAPI void RLGetRayCollisionsMeshBVH(const Ray *rays, int rayCount, MeshBVH bvh, Matrix transform, RayCollision *collisions); // Get collision info between multiple rays and mesh, using mesh BVH
 RLAPI RayCollision RLGetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3);            // Get collision info between ray and triangle
 RLAPI RayCollision RLGetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4);    // Get collision info between ray and quad
 
@@ -1629,6 +1807,9 @@ RLAPI void RLCloseAudioDevice(void);                                    // Close
 RLAPI bool RLIsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
 RLAPI void RLSetMasterVolume(float volume);                             // Set master volume (listener)
 RLAPI float RLGetMasterVolume(void);                                    // Get master volume (listener)
+RLAPI unsigned int RLGetAudioXrunCount(void);                          // Get audio mixer dropouts (xruns) count since device initialization
+RLAPI int RLGetAudioMixerVoiceCount(void);                             // Get number of voices (playing sounds and streams) mixed on last audio callback
+RLAPI float RLGetAudioMixerVoiceRate(void);                            // Get audio mixer throughput of last audio callback (voices per millisecond)
 
 // Wave/Sound loading/unloading functions
 RLAPI Wave RLLoadWave(const char *fileName);                            // Load wave data from file
@@ -1677,6 +1858,10 @@ RLAPI void RLSetMusicPitch(Music music, float pitch);                   // Set p
 RLAPI void RLSetMusicPan(Music music, float pan);                       // Set pan for a music (0.5 is center)
 RLAPI float RLGetMusicTimeLength(Music music);                          // Get music time length (in seconds)
 RLAPI float RLGetMusicTimePlayed(Music music);                          // Get current music time played (in seconds)
+RLAPI void RLSetMusicDecoderThreaded(bool enabled);                    // Set music streams decoding on a background thread (opt-in), for music streams loaded afterwards
+RLAPI void RLSetMusicDecoderReadAhead(int milliseconds);               // Set music decoded ahead per stream on background decoding (in milliseconds), for music streams loaded afterwards
+RLAPI int RLGetMusicFramesBuffered(Music music);                       // Get music frames decoded ahead, waiting to be played (background decoding only)
+RLAPI float RLGetMusicDecoderLoad(void);                               // Get music decoder thread load: time spent decoding over elapsed time (0.0f to 1.0f)
 
 // AudioStream management functions
 RLAPI AudioStream RLLoadAudioStream(unsigned int sampleRate, unsigned int sampleSize, unsigned int channels); // Load audio stream (to stream raw audio pcm data)
@@ -19,6 +19,8 @@
 *           - Linux DRM subsystem (KMS mode)
 *       > PLATFORM_ANDROID:
 *           - Android (ARM, ARM64)
+*       > PLATFORM_HEADLESS:
+*           - No window or display required (rlgl null graphics device, GRAPHICS_API_NULL)
 *
 *   CONFIGURATION:
 *       #define SUPPORT_DEFAULT_FONT (default)
@@ -46,11 +48,11 @@
 *
 *       #define SUPPORT_GIF_RECORDING
 *           Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
+*           Screen recording (GIF, Y4M or raw frames) uses asynchronous readback and encodes frames on a background thread
 *
 *       #define SUPPORT_COMPRESSION_API
-*           Support CompressData() and DecompressData() functions, those functions use zlib implementation
-*           provided by stb_image and stb_image_write libraries, so, those libraries must be enabled on textures module
-*           for linkage
+*           Support CompressData() and DecompressData() functions and compression streams, DEFLATE implementation
+*           provided by sdefl and sinfl libraries (external folder)
 *
 *       #define SUPPORT_AUTOMATION_EVENTS
 *           Support automatic events recording and playing, useful for automated testing systems or AI based game playing
@@ -180,6 +182,9 @@ __declspec(dllimport) unsigned int __stdcall timeEndPeriod(unsigned int uPeriod)
 #if !defined(S_ISREG) && defined(S_IFMT) && defined(S_IFREG)
     #define S_ISREG(m) (((m) & S_IFMT) == S_IFREG)
 #endif
+#if !defined(S_ISDIR) && defined(S_IFMT) && defined(S_IFDIR)
+    #define S_ISDIR(m) (((m) & S_IFMT) == S_IFDIR)
+#endif
 
 #if defined(_WIN32) && (defined(_MSC_VER) || defined(__TINYC__))
     #define DIRENT_MALLOC RL_MALLOC
@@ -190,6 +195,13 @@ __declspec(dllimport) unsigned int __stdcall timeEndPeriod(unsigned int uPeriod)
     #include <dirent.h>             // Required for: DIR, opendir(), closedir() [Used in LoadDirectoryFiles()]
 #endif
 
+#if defined(SUPPORT_DIRECTORY_PARALLEL_SCAN) && (!defined(SUPPORT_THREADED_JOBS) || defined(_WIN32))
+    #undef SUPPORT_DIRECTORY_PARALLEL_SCAN  // Requires job workers and POSIX openat()
+#endif
+#if defined(SUPPORT_DIRECTORY_PARALLEL_SCAN)
+    #include <fcntl.h>              // Required for: openat(), O_DIRECTORY [Used in LoadDirectoryFilesEx()]
+#endif
+
 #if defined(_WIN32)
     #include <io.h>                 // Required for: _access() [Used in FileExists()]
     #include <direct.h>             // Required for: _getch(), _chdir(), _mkdir()
@@ -206,9 +218,6 @@ __declspec(dllimport) unsigned int __stdcall timeEndPeriod(unsigned int uPeriod)
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
-#ifndef MAX_FILEPATH_CAPACITY
-    #define MAX_FILEPATH_CAPACITY       8192        // Maximum capacity for filepath
-#endif
 #ifndef MAX_FILEPATH_LENGTH
     #if defined(_WIN32)
         #define MAX_FILEPATH_LENGTH      256        // On Win32, MAX_PATH = 260 (limits.h) but Windows 10, Version 1607 enables long paths...
@@ -245,18 +254,37 @@ __declspec(dllimport) unsigned int __stdcall timeEndPeriod(unsigned int uPeriod)
     #define MAX_CHAR_PRESSED_QUEUE        16        // Maximum number of characters in the char input queue
 #endif
 
-#ifndef MAX_DECOMPRESSION_SIZE
-    #define MAX_DECOMPRESSION_SIZE        64        // Maximum size allocated for decompression in MB
+#ifndef COMPRESSION_PARALLEL_BLOCK_SIZE
+    #define COMPRESSION_PARALLEL_BLOCK_SIZE  1048576  // Data block size compressed independently on job workers, for data of 2 or more blocks
 #endif
 
 #ifndef MAX_AUTOMATION_EVENTS
     #define MAX_AUTOMATION_EVENTS      16384        // Maximum number of automation events to record
 #endif
 
+#ifndef GIF_RECORD_FRAMERATE
+    #define GIF_RECORD_FRAMERATE          10        // GIF recording frames per second
+#endif
+#ifndef GIF_RECORD_BITRATE
+    #define GIF_RECORD_BITRATE            16        // GIF recording max bit depth per pixel
+#endif
+#ifndef SCREEN_RECORD_FRAMERATE
+    #define SCREEN_RECORD_FRAMERATE       60        // Video stream recording framerate, if no target FPS set
+#endif
+#ifndef SCREEN_RECORD_MAX_PENDING_FRAMES
+    #define SCREEN_RECORD_MAX_PENDING_FRAMES   4    // Max frames pending to be encoded, new frames are dropped if reached
+#endif
+
 #ifndef DIRECTORY_FILTER_TAG
     #define DIRECTORY_FILTER_TAG       "DIR"        // Name tag used to request directory inclusion on directory scan
 #endif                                              // NOTE: Used in ScanDirectoryFiles(), ScanDirectoryFilesRecursively() and LoadDirectoryFilesEx()
 
+#define COMPRESSION_QUALITY_DEFLATE     8           // Compression level 8, same as stbiw
+
+#define DIRECTORY_ENTRY_FILE            0           // Directory entry type: regular file
+#define DIRECTORY_ENTRY_DIRECTORY       1           // Directory entry type: directory, scanned on recursive scan
+#define DIRECTORY_ENTRY_OTHER           2           // Directory entry type: other (listed as directory, not scanned)
+
 // Flags operation macros
 #define FLAG_SET(n, f) ((n) |= (f))
 #define FLAG_CLEAR(n, f) ((n) &= ~(f))
@@ -269,6 +297,83 @@ __declspec(dllimport) unsigned int __stdcall timeEndPeriod(unsigned int uPeriod)
 typedef struct { int x; int y; } Point;
 typedef struct { unsigned int width; unsigned int height; } Size;
 
+// File paths list builder, paths are appended to a single growable strings arena
+// NOTE: Paths are referenced by arena offset while scanning, arena can be reallocated
+typedef struct FilePathBuilder {
+    char *arena;                    // Paths strings (NULL terminated)
+    size_t size;                    // Arena used size (registered paths)
+    size_t capacity;                // Arena capacity
+    size_t pending;                 // Size of last path appended, not registered yet
+    size_t *offsets;                // Registered paths offsets on arena
+    unsigned int count;             // Registered paths count
+    unsigned int offsetCapacity;    // Registered paths offsets capacity
+    bool failed;                    // Memory allocation failed, paths list is incomplete
+} FilePathBuilder;
+
+#if defined(SUPPORT_DIRECTORY_PARALLEL_SCAN)
+// Directory scanned by parallel walker
+// NOTE: Entries are kept in readdir() order, subdirectories nodes are consecutive from firstChild
+typedef struct DirectoryScanNode {
+    char *path;                     // Directory path, relative to base directory ("." for base directory)
+    char *names;                    // Entries names (NULL terminated)
+    int namesSize;                  // Entries names used size
+    int namesCapacity;              // Entries names capacity
+    int *entries;                   // Entries name offset and type pairs
+    int entryCount;                 // Entries count
+    int entryCapacity;              // Entries capacity
+    int firstChild;                 // First subdirectory node
+    bool failed;                    // Directory could not be opened
+} DirectoryScanNode;
+
+// Parallel directory walker data, directories of one tree level are scanned by job workers
+typedef struct DirectoryScanJob {
+    int baseFd;                     // Base directory file descriptor, nodes are opened relative to it
+    DirectoryScanNode *nodes;       // Directories nodes, tree levels stored consecutively
+    int levelStart;                 // First node of tree level being scanned
+} DirectoryScanJob;
+#endif
+
+#if defined(SUPPORT_COMPRESSION_API)
+// Compression stream data, DEFLATE data compressed or decompressed in chunks
+// NOTE: Compressor input and decompressor output keep previous SDEFL_WIN_SIZ bytes (history) in front,
+// required for matches, decompressor input only keeps the data of the block not complete yet
+struct rCompressStream {
+    bool decompress;                // Stream decompresses data (inflate), compresses data otherwise (deflate)
+    bool finished;                  // Stream finished, a new stream starts on next update
+    bool failed;                    // Invalid data or memory could not be allocated, until stream is finished
+
+    struct sdefl *state;            // Compressor state (hash chains and block sequences)
+    struct sdefl **workerStates;    // Compressor states for job workers (allocated on first use)
+    int workerCount;                // Compressor states for job workers count
+    unsigned char *window;          // Compressor input window: history + pending input
+    int windowStart;                // Compressor pending input start (history size)
+    int windowSize;                 // Compressor input window used size
+
+    unsigned char *input;           // Decompressor pending input, from block not complete yet
+    int inputSize;                  // Decompressor pending input size
+    int inputCapacity;              // Decompressor pending input capacity
+    int inputBit;                   // Decompressor pending input first bit
+    int inputRetrySize;             // Decompressor pending input size to try block decoding again
+    bool ended;                     // Decompressor last block decoded
+
+    unsigned char *output;          // Output data
+    int outputStart;                // Output data start, not returned yet
+    int outputSize;                 // Output data size
+    int outputCapacity;             // Output data capacity
+};
+
+// Parallel compression data, blocks compressed independently by job workers
+// NOTE: Every block is compressed with previous SDEFL_WIN_SIZ bytes as dictionary and output aligned to byte,
+// so blocks output can be appended in order as a single DEFLATE stream
+typedef struct CompressBlocksJob {
+    rCompressStream *stream;        // Compression stream, provides compressor states
+    const unsigned char *data;      // Data to compress
+    unsigned char *output;          // Blocks output, one slot per block
+    int slotSize;                   // Block output slot size
+    int *blockSizes;                // Blocks compressed size (-1 on failure)
+} CompressBlocksJob;
+#endif
+
 // Core global state context data
 typedef struct CoreData {
     struct {
@@ -382,9 +487,45 @@ static int screenshotCounter = 0;           // Screenshots counter
 #endif
 
 #if defined(SUPPORT_GIF_RECORDING)
-static unsigned int gifFrameCounter = 0;    // GIF frames counter
-static bool gifRecording = false;           // GIF recording state
-static MsfGifState gifState = { 0 };        // MSGIF context state
+// Screen recording output formats
+typedef enum {
+    SCREEN_RECORD_GIF = 0,          // Animated GIF, encoded in memory and saved on recording stop
+    SCREEN_RECORD_Y4M,              // YUV4MPEG2 video stream (YCbCr 4:4:4), written to file while recording
+    SCREEN_RECORD_RAW               // Raw RGBA frames stream (lossless), written to file while recording
+} ScreenRecordFormat;
+
+// Screen recording frame, queued for encoding
+typedef struct ScreenRecordFrame {
+    unsigned char *pixels;          // Frame pixels (RGBA, top-left origin)
+    int delay;                      // Frame delay in centiseconds (GIF only)
+} ScreenRecordFrame;
+
+// Screen recording state
+// NOTE: Frames are captured on main thread and encoded in order on background thread,
+// encoder data (gif, file, buffer, failed) is only accessed by background thread while recording
+typedef struct ScreenRecorder {
+    bool active;                    // Recording state
+    int format;                     // Output format (ScreenRecordFormat)
+    int width;                      // Frames width
+    int height;                     // Frames height
+    char fileName[512];             // Output file name
+    unsigned int frameCounter;      // Time elapsed since last captured frame (milliseconds)
+    unsigned int frameTime;         // Time between captured frames (milliseconds), 0 to capture every frame
+    unsigned int droppedTime;       // Time of dropped frames, added to next frame delay (milliseconds)
+    unsigned int readback[2];       // Readback buffers for asynchronous capture (0 if not supported)
+    unsigned int readbackTime[2];   // Readback frame time (milliseconds)
+    bool readbackPending[2];        // Readback requested and not collected yet
+    int readbackIndex;              // Readback buffer for next request
+    unsigned int queuedFrames;      // Frames queued for encoding
+    unsigned int droppedFrames;     // Frames dropped, encoder was behind
+
+    MsfGifState gif;                // MSGIF context state
+    FILE *file;                     // Output file (video streams)
+    unsigned char *buffer;          // Encoder conversion buffer (Y4M planes)
+    bool failed;                    // Output could not be written
+} ScreenRecorder;
+
+static ScreenRecorder recorder = { 0 };    // Screen recording state
 #endif
 
 #if defined(SUPPORT_AUTOMATION_EVENTS)
@@ -484,6 +625,9 @@ static bool automationEventRecording = false;               // Recording automat
 extern void RLLoadFontDefault(void);      // [Module: text] Loads default font on InitWindow()
 extern void RLUnloadFontDefault(void);    // [Module: text] Unloads default font from GPU memory
 #endif
+#if defined(SUPPORT_MODULE_RMODELS)
+extern void RLUnloadInstanceBufferDefault(void);  // [Module: models] Unloads internal instance buffer used by DrawMeshInstanced()
+#endif
 
 extern int RLInitPlatform(void);          // Initialize platform (graphics, inputs and more)
 extern void RLClosePlatform(void);        // Close platform
@@ -492,13 +636,39 @@ static void RLInitTimer(void);                                // Initialize time
 static void RLSetupFramebuffer(int width, int height);        // Setup main framebuffer (required by InitPlatform())
 static void RLSetupViewport(int width, int height);           // Set viewport for a provided width and height
 
-static void RLScanDirectoryFiles(const char *basePath, FilePathList *list, const char *filter);   // Scan all files and directories in a base path
-static void RLScanDirectoryFilesRecursively(const char *basePath, FilePathList *list, const char *filter);  // Scan all files and directories recursively from a base path
+static char *RLAppendFilePath(FilePathBuilder *builder, const char *basePath, const char *name);   // Append path to file paths list builder (not registered yet)
+static void RLCommitFilePath(FilePathBuilder *builder);       // Register last path appended to file paths list builder
+static FilePathList RLBuildFilePathList(FilePathBuilder *builder);  // Build file paths list from builder (single allocation)
+static int RLGetDirectoryEntryType(DIR *dir, const struct dirent *entry, const char *path);  // Get directory entry type, stat() only if required
+static bool RLScanDirectoryFiles(const char *basePath, FilePathBuilder *builder, const char *filter);   // Scan all files and directories in a base path
+static bool RLScanDirectoryFilesRecursively(const char *basePath, FilePathBuilder *builder, const char *filter);  // Scan all files and directories recursively from a base path
+#if defined(SUPPORT_DIRECTORY_PARALLEL_SCAN)
+static void RLScanDirectoryNodesRange(void *userData, int start, int end, int worker);   // Scan directories of one tree level (job callback)
+static void RLAddDirectoryNodePaths(const DirectoryScanJob *job, int index, const char *dirPath, FilePathBuilder *builder, const char *filter, bool includeDirs);  // Register directory node paths
+static bool RLScanDirectoryFilesParallel(const char *basePath, FilePathBuilder *builder, const char *filter);   // Scan all files and directories recursively from a base path, using job workers
+#endif
+
+#if defined(SUPPORT_COMPRESSION_API)
+static rCompressStream *RLLoadCompressStreamData(bool decompress);    // Load compression stream data
+static void RLUnloadCompressStreamData(rCompressStream *stream);      // Unload compression stream data
+static void RLBeginCompressStreamUpdate(rCompressStream *stream);     // Drop output already returned, start new stream if finished
+static bool RLReserveCompressStreamOutput(rCompressStream *stream, int size);   // Reserve stream output space, grown geometrically
+static void RLDeflateStreamData(rCompressStream *stream, const unsigned char *data, int dataSize, bool last);   // Compress data chunk into stream output
+static int RLDeflateStreamBlocks(rCompressStream *stream, const unsigned char *data, int dataSize);    // Compress data blocks into stream output using job workers, returns data size compressed
+static void RLDeflateBlocksRange(void *userData, int start, int end, int worker);    // Compress data blocks (job callback)
+static void RLInflateStreamData(rCompressStream *stream, const unsigned char *compData, int compDataSize, bool last);  // Decompress data chunk into stream output
+#endif
 
 #if defined(SUPPORT_AUTOMATION_EVENTS)
 static void RLRecordAutomationEvent(void); // Record frame events (to internal events array)
 #endif
 
+#if defined(SUPPORT_GIF_RECORDING)
+static void RLCaptureScreenRecordFrame(unsigned int time);  // Capture current frame for screen recording
+static void RLQueueScreenRecordFrame(int readback, unsigned int time);  // Queue captured frame for encoding
+static void RLEncodeScreenRecordFrame(void *userData);      // Encode frame to recording output (background thread)
+#endif
+
 #if defined(_WIN32) && !defined(PLATFORM_DESKTOP_RGFW)
 // NOTE: We declare Sleep() function symbol to avoid including windows.h (kernel32.lib linkage required)
 void __stdcall Sleep(unsigned long msTimeout);              // Required for: WaitTime()
@@ -548,6 +718,8 @@ const char *TextFormat(const char *text, ...);              // Formatting of tex
     #include "platforms/rcore_drm.c"
 #elif defined(PLATFORM_ANDROID)
     #include "platforms/rcore_android.c"
+#elif defined(PLATFORM_HEADLESS)
+    #include "platforms/rcore_headless.c"
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -617,6 +789,8 @@ void RLInitWindow(int width, int height, const char *title)
     TRACELOG(LOG_INFO, "Platform backend: NATIVE DRM");
 #elif defined(PLATFORM_ANDROID)
     TRACELOG(LOG_INFO, "Platform backend: ANDROID");
+#elif defined(PLATFORM_HEADLESS)
+    TRACELOG(LOG_INFO, "Platform backend: HEADLESS (null graphics device)");
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -722,20 +896,21 @@ void RLInitWindow(int width, int height, const char *title)
 void RLCloseWindow(void)
 {
 #if defined(SUPPORT_GIF_RECORDING)
-    if (gifRecording)
-    {
-        MsfGifResult result = msf_gif_end(&gifState);
-        msf_gif_free(result);
-        gifRecording = false;
-    }
+    if (recorder.active) RLStopScreenRecording();
 #endif
 
 #if defined(SUPPORT_MODULE_RTEXT) && defined(SUPPORT_DEFAULT_FONT)
     RLUnloadFontDefault();        // WARNING: Module required: rtext
 #endif
 
+#if defined(SUPPORT_MODULE_RMODELS)
+    RLUnloadInstanceBufferDefault();  // WARNING: Module required: rmodels
+#endif
+
     rlglClose();                // De-init rlgl
 
+    RLCloseJobWorkers();        // Stop worker threads, if any
+
     // De-initialize platform
     //--------------------------------------------------------------
     RLClosePlatform();
@@ -890,30 +1065,21 @@ void RLEndDrawing(void)
 
 #if defined(SUPPORT_GIF_RECORDING)
     // Draw record indicator
-    if (gifRecording)
+    if (recorder.active)
     {
-        #ifndef GIF_RECORD_FRAMERATE
-        #define GIF_RECORD_FRAMERATE    10
-        #endif
-        gifFrameCounter += (unsigned int)(RLGetFrameTime()*1000);
+        recorder.frameCounter += (unsigned int)(RLGetFrameTime()*1000);
 
-        // NOTE: We record one gif frame depending on the desired gif framerate
-        if (gifFrameCounter > 1000/GIF_RECORD_FRAMERATE)
+        // NOTE: We record one frame depending on the desired recording framerate,
+        // frame is read back and encoded asynchronously, render loop never waits for the encoder
+        if (recorder.frameTime == 0)
         {
-            // Get image data for the current frame (from backbuffer)
-            // NOTE: This process is quite slow... :(
-            Vector2 scale = RLGetWindowScaleDPI();
-            unsigned char *screenData = rlReadScreenPixels((int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
-
-            #ifndef GIF_RECORD_BITRATE
-            #define GIF_RECORD_BITRATE 16
-            #endif
-
-            // Add the frame to the gif recording, given how many frames have passed in centiseconds
-            msf_gif_frame(&gifState, screenData, gifFrameCounter/10, GIF_RECORD_BITRATE, (int)((float)CORE.Window.render.width*scale.x)*4);
-            gifFrameCounter -= 1000/GIF_RECORD_FRAMERATE;
-
-            RL_FREE(screenData);    // Free image data
+            RLCaptureScreenRecordFrame(recorder.frameCounter);
+            recorder.frameCounter = 0;
+        }
+        else if (recorder.frameCounter > recorder.frameTime)
+        {
+            RLCaptureScreenRecordFrame(recorder.frameCounter);
+            recorder.frameCounter -= recorder.frameTime;
         }
 
     #if defined(SUPPORT_MODULE_RSHAPES) && defined(SUPPORT_MODULE_RTEXT)
@@ -921,7 +1087,7 @@ void RLEndDrawing(void)
         if ((int)(RLGetTime()/0.5)%2 == 1)
         {
             RLDrawCircle(30, CORE.Window.screen.height - 20, 10, MAROON);                 // WARNING: Module required: rshapes
-            RLDrawText("GIF RECORDING", 50, CORE.Window.screen.height - 25, 10, RED);     // WARNING: Module required: rtext
+            RLDrawText((recorder.format == SCREEN_RECORD_GIF)? "GIF RECORDING" : "RECORDING", 50, CORE.Window.screen.height - 25, 10, RED);     // WARNING: Module required: rtext
         }
     #endif
 
@@ -964,27 +1130,20 @@ void RLEndDrawing(void)
 #if defined(SUPPORT_GIF_RECORDING)
         if (RLIsKeyDown(KEY_LEFT_CONTROL))
         {
-            if (gifRecording)
+            if (recorder.active)
             {
-                gifRecording = false;
-
-                MsfGifResult result = msf_gif_end(&gifState);
-
-                RLSaveFileData(RLTextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter), result.data, (unsigned int)result.dataSize);
-                msf_gif_free(result);
+                RLStopScreenRecording();
 
                 TRACELOG(LOG_INFO, "SYSTEM: Finish animated GIF recording");
             }
             else
             {
-                gifRecording = true;
-                gifFrameCounter = 0;
-
-                Vector2 scale = RLGetWindowScaleDPI();
-                msf_gif_begin(&gifState, (int)((float)CORE.Window.render.width*scale.x), (int)((float)CORE.Window.render.height*scale.y));
                 screenshotCounter++;
 
-                TRACELOG(LOG_INFO, "SYSTEM: Start animated GIF recording: %s", RLTextFormat("screenrec%03i.gif", screenshotCounter));
+                if (RLStartScreenRecording(RLTextFormat("%s/screenrec%03i.gif", CORE.Storage.basePath, screenshotCounter)))
+                {
+                    TRACELOG(LOG_INFO, "SYSTEM: Start animated GIF recording: %s", RLTextFormat("screenrec%03i.gif", screenshotCounter));
+                }
             }
         }
         else
@@ -1873,6 +2032,170 @@ void RLTakeScreenshot(const char *fileName)
 #endif
 }
 
+// Start screen recording, output format defined by fileName extension: .gif, .y4m or raw RGBA frames (any other)
+// NOTE: Frames are read back asynchronously and encoded on a background thread, if the encoder
+// falls behind, new frames are dropped instead of stalling the render loop
+bool RLStartScreenRecording(const char *fileName)
+{
+    bool result = false;
+
+#if defined(SUPPORT_GIF_RECORDING)
+    if (recorder.active)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Screen recording already started");
+        return false;
+    }
+
+    Vector2 scale = RLGetWindowScaleDPI();
+    int width = (int)((float)CORE.Window.render.width*scale.x);
+    int height = (int)((float)CORE.Window.render.height*scale.y);
+    int framerate = (CORE.Time.target > 0.0)? (int)(1.0/CORE.Time.target + 0.5) : SCREEN_RECORD_FRAMERATE;
+
+    if (RLIsFileExtension(fileName, ".gif")) recorder.format = SCREEN_RECORD_GIF;
+    else if (RLIsFileExtension(fileName, ".y4m")) recorder.format = SCREEN_RECORD_Y4M;
+    else recorder.format = SCREEN_RECORD_RAW;
+
+    recorder.width = width;
+    recorder.height = height;
+    recorder.file = NULL;
+    recorder.buffer = NULL;
+    recorder.failed = false;
+
+    if (recorder.format == SCREEN_RECORD_GIF)
+    {
+        recorder.frameTime = 1000/GIF_RECORD_FRAMERATE;
+        result = (msf_gif_begin(&recorder.gif, width, height) != 0);
+    }
+    else
+    {
+        recorder.frameTime = 0;     // Video streams record every frame
+        recorder.file = fopen(fileName, "wb");
+
+        if (recorder.file != NULL)
+        {
+            result = true;
+
+            if (recorder.format == SCREEN_RECORD_Y4M)
+            {
+                recorder.buffer = (unsigned char *)RL_MALLOC(width*height*3);
+                result = (recorder.buffer != NULL) && (fprintf(recorder.file, "YUV4MPEG2 W%i H%i F%i:1 Ip A1:1 C444\n", width, height, framerate) > 0);
+            }
+
+            if (!result)
+            {
+                fclose(recorder.file);
+                remove(fileName);
+                RL_FREE(recorder.buffer);
+                recorder.file = NULL;
+                recorder.buffer = NULL;
+            }
+        }
+    }
+
+    if (!result)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: [%s] Failed to start screen recording", fileName);
+        return false;
+    }
+
+    strncpy(recorder.fileName, fileName, sizeof(recorder.fileName) - 1);
+    recorder.fileName[sizeof(recorder.fileName) - 1] = '\0';
+    recorder.frameCounter = 0;
+    recorder.droppedTime = 0;
+    recorder.queuedFrames = 0;
+    recorder.droppedFrames = 0;
+
+    // Asynchronous readback requires pixel pack buffers, if not available, frames are read synchronously
+    recorder.readback[0] = rlLoadReadbackBuffer(width, height);
+    recorder.readback[1] = (recorder.readback[0] != 0)? rlLoadReadbackBuffer(width, height) : 0;
+    recorder.readbackPending[0] = false;
+    recorder.readbackPending[1] = false;
+    recorder.readbackIndex = 0;
+
+    recorder.active = true;
+
+    TRACELOG(LOG_INFO, "SYSTEM: [%s] Screen recording started (%i x %i, %s readback)", fileName, width, height, (recorder.readback[0] != 0)? "async" : "sync");
+#else
+    TRACELOG(LOG_WARNING, "SYSTEM: Screen recording not supported, SUPPORT_GIF_RECORDING required");
+#endif
+
+    return result;
+}
+
+// Stop screen recording
+// NOTE: It waits for pending frames to be encoded, GIF output is saved at this point
+void RLStopScreenRecording(void)
+{
+#if defined(SUPPORT_GIF_RECORDING)
+    if (!recorder.active) return;
+
+    // Collect last requested readback, if any
+    int last = (recorder.readbackIndex + 1)%2;
+    if (recorder.readbackPending[last]) RLQueueScreenRecordFrame(last, recorder.readbackTime[last]);
+
+    recorder.active = false;
+    RLWaitBackgroundJobs();
+
+    if (recorder.readback[0] != 0) rlUnloadReadbackBuffer(recorder.readback[0]);
+    if (recorder.readback[1] != 0) rlUnloadReadbackBuffer(recorder.readback[1]);
+    recorder.readback[0] = 0;
+    recorder.readback[1] = 0;
+
+    if (recorder.format == SCREEN_RECORD_GIF)
+    {
+        MsfGifResult result = msf_gif_end(&recorder.gif);
+
+        if (result.data != NULL) RLSaveFileData(recorder.fileName, result.data, (unsigned int)result.dataSize);
+        else recorder.failed = true;
+
+        msf_gif_free(result);
+    }
+    else
+    {
+        if (fclose(recorder.file) != 0) recorder.failed = true;
+        RL_FREE(recorder.buffer);
+        recorder.file = NULL;
+        recorder.buffer = NULL;
+    }
+
+    if (recorder.failed) TRACELOG(LOG_WARNING, "SYSTEM: [%s] Screen recording could not be written", recorder.fileName);
+    else TRACELOG(LOG_INFO, "SYSTEM: [%s] Screen recording finished (%u frames, %u frames dropped)", recorder.fileName, recorder.queuedFrames, recorder.droppedFrames);
+#endif
+}
+
+// Check if screen recording is active
+bool RLIsScreenRecording(void)
+{
+#if defined(SUPPORT_GIF_RECORDING)
+    return recorder.active;
+#else
+    return false;
+#endif
+}
+
+// Get number of recorded frames waiting to be encoded
+// NOTE: Only recorder frames are counted, other background jobs are not considered
+int RLGetScreenRecordingBacklog(void)
+{
+    int backlog = 0;
+
+#if defined(SUPPORT_GIF_RECORDING)
+    if (recorder.active) backlog = RLGetBackgroundJobCount(RLEncodeScreenRecordFrame);
+#endif
+
+    return backlog;
+}
+
+// Get number of frames dropped on current (or last) screen recording, encoder was behind
+int RLGetScreenRecordingDroppedFrames(void)
+{
+#if defined(SUPPORT_GIF_RECORDING)
+    return (int)recorder.droppedFrames;
+#else
+    return 0;
+#endif
+}
+
 // Setup window configuration flags (view FLAGS)
 // NOTE: This function is expected to be called before window creation,
 // because it sets up some flags for the window creation process
@@ -2226,68 +2549,49 @@ const char * RLGetApplicationDirectory(void)
 }
 
 // Load directory filepaths
-// NOTE: Base path is prepended to the scanned filepaths
-// WARNING: Directory is scanned twice, first time to get files count
+// NOTE: Base path is prepended to the scanned filepaths, directory is scanned in a single pass
 // No recursive scanning is done!
 FilePathList RLLoadDirectoryFiles(const char *dirPath)
 {
-    FilePathList files = { 0 };
-    unsigned int fileCounter = 0;
-
-    struct dirent *entity;
-    DIR *dir = opendir(dirPath);
-
-    if (dir != NULL) // It's a directory
-    {
-        // SCAN 1: Count files
-        while ((entity = readdir(dir)) != NULL)
-        {
-            // NOTE: We skip '.' (current dir) and '..' (parent dir) filepaths
-            if ((strcmp(entity->d_name, ".") != 0) && (strcmp(entity->d_name, "..") != 0)) fileCounter++;
-        }
-
-        // Memory allocation for dirFileCount
-        files.capacity = fileCounter;
-        files.paths = (char **)RL_MALLOC(files.capacity*sizeof(char *));
-        for (unsigned int i = 0; i < files.capacity; i++) files.paths[i] = (char *)RL_MALLOC(MAX_FILEPATH_LENGTH*sizeof(char));
-
-        closedir(dir);
-
-        // SCAN 2: Read filepaths
-        // NOTE: Directory paths are also registered
-        RLScanDirectoryFiles(dirPath, &files, NULL);
+    FilePathBuilder builder = { 0 };
 
-        // Security check: read files.count should match fileCounter
-        if (files.count != files.capacity) TRACELOG(LOG_WARNING, "FILEIO: Read files count do not match capacity allocated");
-    }
-    else TRACELOG(LOG_WARNING, "FILEIO: Failed to open requested directory");  // Maybe it's a file...
+    // NOTE: Directory paths are also registered
+    if (!RLScanDirectoryFiles(dirPath, &builder, NULL)) TRACELOG(LOG_WARNING, "FILEIO: Failed to open requested directory");  // Maybe it's a file...
+    if (builder.failed) TRACELOG(LOG_WARNING, "FILEIO: Failed to allocate memory for directory file paths, list is incomplete (%s)", dirPath);
 
-    return files;
+    return RLBuildFilePathList(&builder);
 }
 
 // Load directory filepaths with extension filtering and recursive directory scan
-// NOTE: On recursive loading we do not pre-scan for file count, we use MAX_FILEPATH_CAPACITY
+// NOTE: List grows as required while scanning, there is no limit on scanned paths
 FilePathList RLLoadDirectoryFilesEx(const char *basePath, const char *filter, bool scanSubdirs)
 {
-    FilePathList files = { 0 };
-
-    files.capacity = MAX_FILEPATH_CAPACITY;
-    files.paths = (char **)RL_CALLOC(files.capacity, sizeof(char *));
-    for (unsigned int i = 0; i < files.capacity; i++) files.paths[i] = (char *)RL_CALLOC(MAX_FILEPATH_LENGTH, sizeof(char));
+    FilePathBuilder builder = { 0 };
+    bool success = false;
 
     // WARNING: basePath is always prepended to scanned paths
-    if (scanSubdirs) RLScanDirectoryFilesRecursively(basePath, &files, filter);
-    else RLScanDirectoryFiles(basePath, &files, filter);
+    if (scanSubdirs)
+    {
+#if defined(SUPPORT_DIRECTORY_PARALLEL_SCAN)
+        // NOTE: Parallel walker scans directories level by level, not worth it with a single worker
+        if (RLGetJobWorkerCount() > 1) success = RLScanDirectoryFilesParallel(basePath, &builder, filter);
+        else
+#endif
+        success = RLScanDirectoryFilesRecursively(basePath, &builder, filter);
+    }
+    else success = RLScanDirectoryFiles(basePath, &builder, filter);
 
-    return files;
+    if (!success) TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
+    if (builder.failed) TRACELOG(LOG_WARNING, "FILEIO: Failed to allocate memory for directory file paths, list is incomplete (%s)", basePath);
+
+    return RLBuildFilePathList(&builder);
 }
 
 // Unload directory filepaths
+// NOTE: Paths pointers and strings are stored in a single allocation
 // WARNING: files.count is not reseted to 0 after unloading
 void RLUnloadDirectoryFiles(FilePathList files)
 {
-    for (unsigned int i = 0; i < files.capacity; i++) RL_FREE(files.paths[i]);
-
     RL_FREE(files.paths);
 }
 
@@ -2460,20 +2764,33 @@ long RLGetFileModTime(const char *fileName)
 //----------------------------------------------------------------------------------
 
 // Compress data (DEFLATE algorithm)
+// NOTE: Data of 2 or more COMPRESSION_PARALLEL_BLOCK_SIZE blocks is compressed in independent blocks using job workers,
+// output does not depend on the number of workers
 unsigned char * RLCompressData(const unsigned char *data, int dataSize, int *compDataSize)
 {
-    #define COMPRESSION_QUALITY_DEFLATE  8
-
     unsigned char *compData = NULL;
+    *compDataSize = 0;
 
 #if defined(SUPPORT_COMPRESSION_API)
-    // Compress data and generate a valid DEFLATE stream
-    struct sdefl *sdefl = RL_CALLOC(1, sizeof(struct sdefl));   // WARNING: Possible stack overflow, struct sdefl is almost 1MB
-    int bounds = sdefl_bound(dataSize);
-    compData = (unsigned char *)RL_CALLOC(bounds, 1);
+    rCompressStream *stream = RLLoadCompressStreamData(false);
+
+    if (stream != NULL)
+    {
+        // Output reserved for all data (blocks stored uncompressed in worst case), so it is not reallocated
+        int blockCount = dataSize/COMPRESSION_PARALLEL_BLOCK_SIZE;
+        int blockOverhead = sdefl_bound(COMPRESSION_PARALLEL_BLOCK_SIZE) - COMPRESSION_PARALLEL_BLOCK_SIZE + 8;
+        RLReserveCompressStreamOutput(stream, sdefl_bound(dataSize) + blockCount*blockOverhead + 8);
+        RLDeflateStreamData(stream, data, dataSize, true);
+
+        if (!stream->failed)
+        {
+            compData = stream->output;
+            *compDataSize = stream->outputSize;
+            stream->output = NULL;
+        }
 
-    *compDataSize = sdeflate(sdefl, compData, data, dataSize, COMPRESSION_QUALITY_DEFLATE);   // Compression level 8, same as stbiw
-    RL_FREE(sdefl);
+        RLUnloadCompressStreamData(stream);
+    }
 
     TRACELOG(LOG_INFO, "SYSTEM: Compress data: Original size: %i -> Comp. size: %i", dataSize, *compDataSize);
 #endif
@@ -2485,20 +2802,34 @@ unsigned char * RLCompressData(const unsigned char *data, int dataSize, int *com
 unsigned char * RLDecompressData(const unsigned char *compData, int compDataSize, int *dataSize)
 {
     unsigned char *data = NULL;
+    *dataSize = 0;
 
 #if defined(SUPPORT_COMPRESSION_API)
-    // Decompress data from a valid DEFLATE stream
-    data = (unsigned char *)RL_CALLOC(MAX_DECOMPRESSION_SIZE*1024*1024, 1);
-    int length = sinflate(data, MAX_DECOMPRESSION_SIZE*1024*1024, compData, compDataSize);
+    rCompressStream *stream = RLLoadCompressStreamData(true);
+
+    if (stream != NULL)
+    {
+        // NOTE: DEFLATE data does not store decompressed size, output is reserved for an estimated compression ratio
+        // and grown as required, a block not fitting in output is decoded again
+        if ((compDataSize < INT_MAX/8) && !RLReserveCompressStreamOutput(stream, compDataSize*8)) stream->failed = false;
+        RLInflateStreamData(stream, compData, compDataSize, true);
+
+        if (!stream->failed)
+        {
+            data = stream->output;
+            *dataSize = stream->outputSize;
+            stream->output = NULL;
 
-    // WARNING: RL_REALLOC can make (and leave) data copies in memory, be careful with sensitive compressed data!
-    // TODO: Use a different approach, create another buffer, copy data manually to it and wipe original buffer memory
-    unsigned char *temp = (unsigned char *)RL_REALLOC(data, length);
+            // WARNING: RL_REALLOC can make (and leave) data copies in memory, be careful with sensitive compressed data!
+            // TODO: Use a different approach, create another buffer, copy data manually to it and wipe original buffer memory
+            unsigned char *temp = (unsigned char *)RL_REALLOC(data, (*dataSize > 0)? *dataSize : 1);
 
-    if (temp != NULL) data = temp;
-    else TRACELOG(LOG_WARNING, "SYSTEM: Failed to re-allocate required decompression memory");
+            if (temp != NULL) data = temp;
+            else TRACELOG(LOG_WARNING, "SYSTEM: Failed to re-allocate required decompression memory");
+        }
 
-    *dataSize = length;
+        RLUnloadCompressStreamData(stream);
+    }
 
     TRACELOG(LOG_INFO, "SYSTEM: Decompress data: Comp. size: %i -> Original size: %i", compDataSize, *dataSize);
 #endif
@@ -2506,6 +2837,98 @@ unsigned char * RLDecompressData(const unsigned char *compData, int compDataSize
     return data;
 }
 
+// Load compression stream (DEFLATE algorithm), data compressed in chunks
+CompressStream RLLoadCompressStream(void)
+{
+    CompressStream stream = { 0 };
+
+#if defined(SUPPORT_COMPRESSION_API)
+    stream.data = RLLoadCompressStreamData(false);
+#endif
+
+    return stream;
+}
+
+// Load decompression stream (DEFLATE algorithm), data decompressed in chunks
+CompressStream RLLoadDecompressStream(void)
+{
+    CompressStream stream = { 0 };
+
+#if defined(SUPPORT_COMPRESSION_API)
+    stream.data = RLLoadCompressStreamData(true);
+#endif
+
+    return stream;
+}
+
+// Check if a compression stream is valid
+bool RLIsCompressStreamValid(CompressStream stream)
+{
+    return (stream.data != NULL);
+}
+
+// Unload compression stream
+void RLUnloadCompressStream(CompressStream stream)
+{
+#if defined(SUPPORT_COMPRESSION_API)
+    if (stream.data != NULL) RLUnloadCompressStreamData(stream.data);
+#endif
+}
+
+// Update compression stream with a data chunk, returns output data available
+// NOTE: Returned data is owned by stream, valid until next stream update or finish, NULL on failure
+const unsigned char *RLUpdateCompressStream(CompressStream stream, const unsigned char *data, int dataSize, int *outputSize)
+{
+    const unsigned char *output = NULL;
+    *outputSize = 0;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if (stream.data != NULL)
+    {
+        RLBeginCompressStreamUpdate(stream.data);
+
+        if (stream.data->decompress) RLInflateStreamData(stream.data, data, dataSize, false);
+        else RLDeflateStreamData(stream.data, data, dataSize, false);
+
+        if (!stream.data->failed)
+        {
+            output = stream.data->output + stream.data->outputStart;
+            *outputSize = stream.data->outputSize - stream.data->outputStart;
+        }
+    }
+#endif
+
+    return output;
+}
+
+// Finish compression stream, returns last output data available, stream can be reused for a new stream
+// NOTE: Returned data is owned by stream, valid until next stream update or finish, NULL on failure (i.e. incomplete compressed data)
+const unsigned char *RLFinishCompressStream(CompressStream stream, int *outputSize)
+{
+    const unsigned char *output = NULL;
+    *outputSize = 0;
+
+#if defined(SUPPORT_COMPRESSION_API)
+    if (stream.data != NULL)
+    {
+        RLBeginCompressStreamUpdate(stream.data);
+
+        if (stream.data->decompress) RLInflateStreamData(stream.data, NULL, 0, true);
+        else RLDeflateStreamData(stream.data, NULL, 0, true);
+
+        if (!stream.data->failed)
+        {
+            output = stream.data->output + stream.data->outputStart;
+            *outputSize = stream.data->outputSize - stream.data->outputStart;
+        }
+
+        stream.data->finished = true;
+    }
+#endif
+
+    return output;
+}
+
 // Encode data to Base64 string
 char * RLEncodeDataBase64(const unsigned char *data, int dataSize, int *outputSize)
 {
@@ -3638,130 +4061,901 @@ void RLSetupFramebuffer(int width, int height)
     }
 }
 
-// Scan all files and directories in a base path
-// WARNING: files.paths[] must be previously allocated and
-// contain enough space to store all required paths
-static void RLScanDirectoryFiles(const char *basePath, FilePathList *files, const char *filter)
+// Append path to file paths list builder: basePath + separator + name
+// NOTE: Path is not registered until RLCommitFilePath() is called, returned pointer is valid until next append
+static char *RLAppendFilePath(FilePathBuilder *builder, const char *basePath, const char *name)
 {
-    static char path[MAX_FILEPATH_LENGTH] = { 0 };
-    memset(path, 0, MAX_FILEPATH_LENGTH);
+    size_t baseLength = strlen(basePath);
+    size_t nameLength = strlen(name);
+    size_t required = builder->size + baseLength + nameLength + 2;
 
-    struct dirent *dp = NULL;
-    DIR *dir = opendir(basePath);
-
-    if (dir != NULL)
+    if (required > builder->capacity)
     {
-        while ((dp = readdir(dir)) != NULL)
-        {
-            if ((strcmp(dp->d_name, ".") != 0) &&
-                (strcmp(dp->d_name, "..") != 0))
-            {
-            #if defined(_WIN32)
-                sprintf(path, "%s\\%s", basePath, dp->d_name);
-            #else
-                sprintf(path, "%s/%s", basePath, dp->d_name);
-            #endif
+        size_t capacity = (builder->capacity > 0)? 2*builder->capacity : 4096;
+        while (capacity < required) capacity *= 2;
 
-                if (filter != NULL)
-                {
-                    if (RLIsPathFile(path))
-                    {
-                        if (RLIsFileExtension(path, filter))
-                        {
-                            strcpy(files->paths[files->count], path);
-                            files->count++;
-                        }
-                    }
-                    else
-                    {
-                        if (RLTextFindIndex(filter, DIRECTORY_FILTER_TAG) >= 0)
-                        {
-                            strcpy(files->paths[files->count], path);
-                            files->count++;
-                        }
-                    }
-                }
-                else
-                {
-                    strcpy(files->paths[files->count], path);
-                    files->count++;
-                }
-            }
+        char *arena = (char *)RL_REALLOC(builder->arena, capacity);
+        if (arena == NULL)
+        {
+            builder->failed = true;
+            return NULL;
         }
 
-        closedir(dir);
+        builder->arena = arena;
+        builder->capacity = capacity;
     }
-    else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
+
+    char *path = builder->arena + builder->size;
+
+    memcpy(path, basePath, baseLength);
+#if defined(_WIN32)
+    path[baseLength] = '\\';
+#else
+    path[baseLength] = '/';
+#endif
+    memcpy(path + baseLength + 1, name, nameLength + 1);
+    builder->pending = baseLength + nameLength + 2;
+
+    return path;
 }
 
-// Scan all files and directories recursively from a base path
-static void RLScanDirectoryFilesRecursively(const char *basePath, FilePathList *files, const char *filter)
+// Register last path appended to file paths list builder
+// NOTE: On allocation failure builder is marked as failed, scanning stops and list is built with paths registered so far
+static void RLCommitFilePath(FilePathBuilder *builder)
 {
-    char path[MAX_FILEPATH_LENGTH] = { 0 };
-    memset(path, 0, MAX_FILEPATH_LENGTH);
+    if (builder->count >= builder->offsetCapacity)
+    {
+        unsigned int capacity = (builder->offsetCapacity > 0)? 2*builder->offsetCapacity : 64;
+        size_t *offsets = (size_t *)RL_REALLOC(builder->offsets, capacity*sizeof(size_t));
+        if (offsets == NULL)
+        {
+            builder->pending = 0;
+            builder->failed = true;
+            return;
+        }
 
-    struct dirent *dp = NULL;
-    DIR *dir = opendir(basePath);
+        builder->offsets = offsets;
+        builder->offsetCapacity = capacity;
+    }
 
-    if (dir != NULL)
+    builder->offsets[builder->count] = builder->size;
+    builder->count++;
+    builder->size += builder->pending;
+    builder->pending = 0;
+}
+
+// Build file paths list from builder, builder memory is released
+// NOTE: Paths pointers and strings are stored in a single allocation, released by UnloadDirectoryFiles()
+static FilePathList RLBuildFilePathList(FilePathBuilder *builder)
+{
+    FilePathList files = { 0 };
+
+    if (builder->count > 0)
     {
-        while (((dp = readdir(dir)) != NULL) && (files->count < files->capacity))
+        char **paths = (char **)RL_MALLOC(builder->count*sizeof(char *) + builder->size);
+
+        if (paths != NULL)
         {
-            if ((strcmp(dp->d_name, ".") != 0) && (strcmp(dp->d_name, "..") != 0))
-            {
-                // Construct new path from our base path
-            #if defined(_WIN32)
-                sprintf(path, "%s\\%s", basePath, dp->d_name);
-            #else
-                sprintf(path, "%s/%s", basePath, dp->d_name);
-            #endif
-
-                if (RLIsPathFile(path))
-                {
-                    if (filter != NULL)
-                    {
-                        if (RLIsFileExtension(path, filter))
-                        {
-                            strcpy(files->paths[files->count], path);
-                            files->count++;
-                        }
-                    }
-                    else
-                    {
-                        strcpy(files->paths[files->count], path);
-                        files->count++;
-                    }
+            char *strings = (char *)(paths + builder->count);
+            memcpy(strings, builder->arena, builder->size);
 
-                    if (files->count >= files->capacity)
-                    {
-                        TRACELOG(LOG_WARNING, "FILEIO: Maximum filepath scan capacity reached (%i files)", files->capacity);
-                        break;
-                    }
-                }
-                else
+            for (unsigned int i = 0; i < builder->count; i++) paths[i] = strings + builder->offsets[i];
+
+            files.capacity = builder->count;
+            files.count = builder->count;
+            files.paths = paths;
+        }
+    }
+
+    RL_FREE(builder->arena);
+    RL_FREE(builder->offsets);
+    *builder = (FilePathBuilder){ 0 };
+
+    return files;
+}
+
+// Get directory entry type, symbolic links to directories are not followed (listed as other, never scanned)
+// NOTE: Entry type reported by readdir() is used when available, avoiding a stat() call per entry
+static int RLGetDirectoryEntryType(DIR *dir, const struct dirent *entry, const char *path)
+{
+#if defined(DT_DIR)
+    if (entry->d_type == DT_REG) return DIRECTORY_ENTRY_FILE;
+    if (entry->d_type == DT_DIR) return DIRECTORY_ENTRY_DIRECTORY;
+#endif
+
+    struct stat result = { 0 };
+
+#if defined(_WIN32)
+    if (stat(path, &result) != 0) return DIRECTORY_ENTRY_OTHER;
+#else
+    if (fstatat(dirfd(dir), entry->d_name, &result, AT_SYMLINK_NOFOLLOW) != 0) return DIRECTORY_ENTRY_OTHER;
+
+    // NOTE: Links to regular files are listed as files, links to directories are not scanned,
+    // avoiding endless recursion on links pointing to a parent directory
+    if (S_ISLNK(result.st_mode))
+    {
+        if ((fstatat(dirfd(dir), entry->d_name, &result, 0) == 0) && S_ISREG(result.st_mode)) return DIRECTORY_ENTRY_FILE;
+        return DIRECTORY_ENTRY_OTHER;
+    }
+#endif
+
+    if (S_ISREG(result.st_mode)) return DIRECTORY_ENTRY_FILE;
+    if (S_ISDIR(result.st_mode)) return DIRECTORY_ENTRY_DIRECTORY;
+
+    return DIRECTORY_ENTRY_OTHER;
+}
+
+// Scan all files and directories in a base path, returns false if directory can not be opened
+static bool RLScanDirectoryFiles(const char *basePath, FilePathBuilder *builder, const char *filter)
+{
+    DIR *dir = opendir(basePath);
+
+    if (dir == NULL) return false;
+
+    bool includeDirs = (filter != NULL) && (RLTextFindIndex(filter, DIRECTORY_FILTER_TAG) >= 0);
+    struct dirent *dp = NULL;
+
+    while (!builder->failed && ((dp = readdir(dir)) != NULL))
+    {
+        if ((strcmp(dp->d_name, ".") != 0) && (strcmp(dp->d_name, "..") != 0))
+        {
+            char *path = RLAppendFilePath(builder, basePath, dp->d_name);
+            if (path == NULL) break;
+
+            // NOTE: Entry type is only required for filtering
+            if (filter != NULL)
+            {
+                if (RLGetDirectoryEntryType(dir, dp, path) == DIRECTORY_ENTRY_FILE)
                 {
-                    if ((filter != NULL) && (RLTextFindIndex(filter, DIRECTORY_FILTER_TAG) >= 0))
+                    if (RLIsFileExtension(path, filter)) RLCommitFilePath(builder);
+                }
+                else if (includeDirs) RLCommitFilePath(builder);
+            }
+            else RLCommitFilePath(builder);
+        }
+    }
+
+    closedir(dir);
+
+    return true;
+}
+
+// Scan all files and directories recursively from a base path, returns false if directory can not be opened
+static bool RLScanDirectoryFilesRecursively(const char *basePath, FilePathBuilder *builder, const char *filter)
+{
+    DIR *dir = opendir(basePath);
+
+    if (dir == NULL) return false;
+
+    bool includeDirs = (filter != NULL) && (RLTextFindIndex(filter, DIRECTORY_FILTER_TAG) >= 0);
+    struct dirent *dp = NULL;
+
+    while (!builder->failed && ((dp = readdir(dir)) != NULL))
+    {
+        if ((strcmp(dp->d_name, ".") != 0) && (strcmp(dp->d_name, "..") != 0))
+        {
+            char *path = RLAppendFilePath(builder, basePath, dp->d_name);
+            if (path == NULL) break;
+
+            int type = RLGetDirectoryEntryType(dir, dp, path);
+
+            if (type == DIRECTORY_ENTRY_FILE)
+            {
+                if ((filter == NULL) || RLIsFileExtension(path, filter)) RLCommitFilePath(builder);
+            }
+            else
+            {
+                if (includeDirs) RLCommitFilePath(builder);
+
+                if (type == DIRECTORY_ENTRY_DIRECTORY)
+                {
+                    // NOTE: Path is copied, builder memory can be reallocated while scanning subdirectory
+                    size_t length = strlen(path) + 1;
+                    char *subPath = (char *)RL_MALLOC(length);
+                    if (subPath == NULL)
                     {
-                        strcpy(files->paths[files->count], path);
-                        files->count++;
+                        builder->failed = true;
+                        break;
                     }
+                    memcpy(subPath, path, length);
+
+                    if (!RLScanDirectoryFilesRecursively(subPath, builder, filter)) TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", subPath);
+
+                    RL_FREE(subPath);
+                }
+            }
+        }
+    }
+
+    closedir(dir);
+
+    return true;
+}
+
+#if defined(SUPPORT_DIRECTORY_PARALLEL_SCAN)
+// Scan directories nodes of one tree level (job callback)
+// NOTE: Directories are opened relative to base directory and entries types requested relative
+// to every directory (openat(), fstatat()), no path is resolved from the root again
+static void RLScanDirectoryNodesRange(void *userData, int start, int end, int worker)
+{
+    DirectoryScanJob *job = (DirectoryScanJob *)userData;
+
+    for (int i = start; i < end; i++)
+    {
+        DirectoryScanNode *node = &job->nodes[job->levelStart + i];
+
+        int fd = openat(job->baseFd, node->path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        DIR *dir = (fd >= 0)? fdopendir(fd) : NULL;
+
+        if (dir == NULL)
+        {
+            if (fd >= 0) close(fd);
+            node->failed = true;
+            continue;
+        }
+
+        struct dirent *dp = NULL;
+
+        while ((dp = readdir(dir)) != NULL)
+        {
+            if ((strcmp(dp->d_name, ".") == 0) || (strcmp(dp->d_name, "..") == 0)) continue;
+
+            int length = (int)strlen(dp->d_name) + 1;
+
+            if (node->namesSize + length > node->namesCapacity)
+            {
+                int capacity = (node->namesCapacity > 0)? 2*node->namesCapacity : 1024;
+                while (capacity < node->namesSize + length) capacity *= 2;
+
+                char *names = (char *)RL_REALLOC(node->names, capacity);
+                if (names == NULL) break;
+
+                node->names = names;
+                node->namesCapacity = capacity;
+            }
 
-                    if (files->count >= files->capacity)
+            if (node->entryCount >= node->entryCapacity)
+            {
+                int capacity = (node->entryCapacity > 0)? 2*node->entryCapacity : 32;
+
+                int *entries = (int *)RL_REALLOC(node->entries, 2*capacity*sizeof(int));
+                if (entries == NULL) break;
+
+                node->entries = entries;
+                node->entryCapacity = capacity;
+            }
+
+            memcpy(node->names + node->namesSize, dp->d_name, length);
+            node->entries[2*node->entryCount] = node->namesSize;
+            node->entries[2*node->entryCount + 1] = RLGetDirectoryEntryType(dir, dp, NULL);
+            node->entryCount++;
+            node->namesSize += length;
+        }
+
+        closedir(dir);  // NOTE: Directory file descriptor is closed with it
+    }
+}
+
+// Register directory node paths on list builder, subdirectories are registered depth first
+// NOTE: Paths are registered in the same order as RLScanDirectoryFilesRecursively()
+static void RLAddDirectoryNodePaths(const DirectoryScanJob *job, int index, const char *dirPath, FilePathBuilder *builder, const char *filter, bool includeDirs)
+{
+    const DirectoryScanNode *node = &job->nodes[index];
+    int child = node->firstChild;
+
+    if (node->failed) TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", dirPath);
+
+    for (int i = 0; (i < node->entryCount) && !builder->failed; i++)
+    {
+        const char *name = node->names + node->entries[2*i];
+        int type = node->entries[2*i + 1];
+
+        char *path = RLAppendFilePath(builder, dirPath, name);
+        if (path == NULL) return;
+
+        if (type == DIRECTORY_ENTRY_FILE)
+        {
+            if ((filter == NULL) || RLIsFileExtension(path, filter)) RLCommitFilePath(builder);
+        }
+        else
+        {
+            if (includeDirs) RLCommitFilePath(builder);
+
+            if (type == DIRECTORY_ENTRY_DIRECTORY)
+            {
+                // NOTE: Path is copied, builder memory can be reallocated while adding subdirectory paths
+                size_t length = strlen(path) + 1;
+                char *subPath = (char *)RL_MALLOC(length);
+                if (subPath == NULL)
+                {
+                    builder->failed = true;
+                    return;
+                }
+                memcpy(subPath, path, length);
+
+                RLAddDirectoryNodePaths(job, child, subPath, builder, filter, includeDirs);
+                child++;
+
+                RL_FREE(subPath);
+            }
+        }
+    }
+}
+
+// Scan all files and directories recursively from a base path using job workers, returns false if directory can not be opened
+// NOTE: Directories tree is scanned level by level, every level directories are scanned in parallel
+static bool RLScanDirectoryFilesParallel(const char *basePath, FilePathBuilder *builder, const char *filter)
+{
+    DirectoryScanJob job = { 0 };
+
+    job.baseFd = open(basePath, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (job.baseFd < 0) return false;
+
+    int nodeCount = 1;
+    int nodeCapacity = 64;
+    int levelEnd = 1;
+
+    job.nodes = (DirectoryScanNode *)RL_CALLOC(nodeCapacity, sizeof(DirectoryScanNode));
+    if (job.nodes != NULL) job.nodes[0].path = (char *)RL_CALLOC(2, 1);
+
+    if ((job.nodes == NULL) || (job.nodes[0].path == NULL))
+    {
+        RL_FREE(job.nodes);
+        close(job.baseFd);
+        return false;
+    }
+
+    job.nodes[0].path[0] = '.';
+
+    while (job.levelStart < levelEnd)
+    {
+        RLParallelFor(levelEnd - job.levelStart, 1, RLScanDirectoryNodesRange, &job);
+
+        // Add next level nodes, subdirectories of every node are consecutive (entries order)
+        for (int n = job.levelStart; n < levelEnd; n++)
+        {
+            job.nodes[n].firstChild = nodeCount;
+
+            for (int i = 0; i < job.nodes[n].entryCount; i++)
+            {
+                if (job.nodes[n].entries[2*i + 1] != DIRECTORY_ENTRY_DIRECTORY) continue;
+
+                if (nodeCount >= nodeCapacity)
+                {
+                    DirectoryScanNode *nodes = (DirectoryScanNode *)RL_REALLOC(job.nodes, 2*nodeCapacity*sizeof(DirectoryScanNode));
+
+                    if (nodes != NULL)
                     {
-                        TRACELOG(LOG_WARNING, "FILEIO: Maximum filepath scan capacity reached (%i files)", files->capacity);
-                        break;
+                        job.nodes = nodes;
+                        nodeCapacity *= 2;
                     }
+                }
+
+                const char *parentPath = job.nodes[n].path;
+                const char *name = job.nodes[n].names + job.nodes[n].entries[2*i];
 
-                    RLScanDirectoryFilesRecursively(path, files, filter);
+                // Path relative to base directory
+                int parentLength = (strcmp(parentPath, ".") == 0)? 0 : (int)strlen(parentPath);
+                int nameLength = (int)strlen(name);
+                char *path = (nodeCount < nodeCapacity)? (char *)RL_MALLOC(parentLength + nameLength + 2) : NULL;
+
+                if (path == NULL)
+                {
+                    // NOTE: Subdirectory is not scanned on allocation failure
+                    job.nodes[n].entries[2*i + 1] = DIRECTORY_ENTRY_OTHER;
+                    continue;
                 }
+
+                if (parentLength > 0)
+                {
+                    memcpy(path, parentPath, parentLength);
+                    path[parentLength] = '/';
+                    parentLength++;
+                }
+                memcpy(path + parentLength, name, nameLength + 1);
+
+                job.nodes[nodeCount] = (DirectoryScanNode){ 0 };
+                job.nodes[nodeCount].path = path;
+                nodeCount++;
             }
         }
 
-        closedir(dir);
+        job.levelStart = levelEnd;
+        levelEnd = nodeCount;
+    }
+
+    close(job.baseFd);
+
+    bool includeDirs = (filter != NULL) && (RLTextFindIndex(filter, DIRECTORY_FILTER_TAG) >= 0);
+    RLAddDirectoryNodePaths(&job, 0, basePath, builder, filter, includeDirs);
+
+    for (int i = 0; i < nodeCount; i++)
+    {
+        RL_FREE(job.nodes[i].path);
+        RL_FREE(job.nodes[i].names);
+        RL_FREE(job.nodes[i].entries);
+    }
+
+    RL_FREE(job.nodes);
+
+    return true;
+}
+#endif
+
+#if defined(SUPPORT_GIF_RECORDING)
+// Capture current frame for screen recording, time elapsed since previous frame in milliseconds
+// NOTE: When supported, readback is requested asynchronously and collected on next capture,
+// by then the GPU copy has completed and mapping the buffer does not stall
+static void RLCaptureScreenRecordFrame(unsigned int time)
+{
+    if (recorder.readback[0] != 0)
+    {
+        int index = recorder.readbackIndex;
+
+        rlReadScreenPixelsAsync(recorder.readback[index], recorder.width, recorder.height);
+        recorder.readbackTime[index] = time;
+        recorder.readbackPending[index] = true;
+
+        // Collect previous request, issued at least one frame ago
+        recorder.readbackIndex = (index + 1)%2;
+        if (recorder.readbackPending[recorder.readbackIndex]) RLQueueScreenRecordFrame(recorder.readbackIndex, recorder.readbackTime[recorder.readbackIndex]);
+    }
+    else RLQueueScreenRecordFrame(-1, time);
+}
+
+// Queue captured frame for encoding, from readback buffer index or read synchronously (-1)
+// NOTE: If too many recorder frames are pending, frame is dropped and its time added to next frame delay,
+// other background jobs pending do not count against recorder limit
+static void RLQueueScreenRecordFrame(int readback, unsigned int time)
+{
+    if (readback >= 0) recorder.readbackPending[readback] = false;
+
+    time += recorder.droppedTime;
+
+    if (RLGetBackgroundJobCount(RLEncodeScreenRecordFrame) >= SCREEN_RECORD_MAX_PENDING_FRAMES)
+    {
+        recorder.droppedTime = time;
+        recorder.droppedFrames++;
+        return;
+    }
+
+    ScreenRecordFrame *frame = (ScreenRecordFrame *)RL_MALLOC(sizeof(ScreenRecordFrame));
+    if (frame == NULL)
+    {
+        recorder.droppedTime = time;
+        recorder.droppedFrames++;
+        return;
+    }
+
+    frame->delay = (int)(time/10);
+
+    if (readback >= 0)
+    {
+        frame->pixels = (unsigned char *)RL_MALLOC(recorder.width*recorder.height*4);
+
+        if ((frame->pixels == NULL) || !rlGetReadbackBufferPixels(recorder.readback[readback], recorder.width, recorder.height, frame->pixels))
+        {
+            RL_FREE(frame->pixels);
+            RL_FREE(frame);
+            recorder.droppedTime = time;
+            recorder.droppedFrames++;
+            return;
+        }
+    }
+    else frame->pixels = rlReadScreenPixels(recorder.width, recorder.height);
+
+    if ((frame->pixels != NULL) && RLRunBackgroundJob(RLEncodeScreenRecordFrame, frame, 0))
+    {
+        recorder.droppedTime = 0;
+        recorder.queuedFrames++;
+    }
+    else
+    {
+        RL_FREE(frame->pixels);
+        RL_FREE(frame);
+        recorder.droppedTime = time;
+        recorder.droppedFrames++;
     }
-    else TRACELOG(LOG_WARNING, "FILEIO: Directory cannot be opened (%s)", basePath);
 }
 
+// Encode frame to recording output
+// NOTE: Called on background thread, frames are processed in capture order
+static void RLEncodeScreenRecordFrame(void *userData)
+{
+    ScreenRecordFrame *frame = (ScreenRecordFrame *)userData;
+    int pixelCount = recorder.width*recorder.height;
+    unsigned char *pixels = frame->pixels;
+
+    if (!recorder.failed)
+    {
+        switch (recorder.format)
+        {
+            case SCREEN_RECORD_GIF:
+            {
+                // Add the frame to the gif recording, given how many frames have passed in centiseconds
+                msf_gif_frame(&recorder.gif, pixels, frame->delay, GIF_RECORD_BITRATE, recorder.width*4);
+            } break;
+            case SCREEN_RECORD_Y4M:
+            {
+                // Convert to planar YCbCr 4:4:4, BT.601 limited range
+                unsigned char *y = recorder.buffer;
+                unsigned char *cb = y + pixelCount;
+                unsigned char *cr = cb + pixelCount;
+
+                for (int i = 0; i < pixelCount; i++)
+                {
+                    int r = pixels[i*4];
+                    int g = pixels[i*4 + 1];
+                    int b = pixels[i*4 + 2];
+
+                    y[i] = (unsigned char)(((66*r + 129*g + 25*b + 128) >> 8) + 16);
+                    cb[i] = (unsigned char)(((-38*r - 74*g + 112*b + 128) >> 8) + 128);
+                    cr[i] = (unsigned char)(((112*r - 94*g - 18*b + 128) >> 8) + 128);
+                }
+
+                if ((fwrite("FRAME\n", 1, 6, recorder.file) != 6) ||
+                    (fwrite(recorder.buffer, 1, pixelCount*3, recorder.file) != (size_t)pixelCount*3)) recorder.failed = true;
+            } break;
+            case SCREEN_RECORD_RAW:
+            {
+                // NOTE: Alpha value has already been applied to RGB in framebuffer, we don't need it!
+                for (int i = 0; i < pixelCount; i++) pixels[i*4 + 3] = 255;
+
+                if (fwrite(pixels, 1, pixelCount*4, recorder.file) != (size_t)pixelCount*4) recorder.failed = true;
+            } break;
+            default: break;
+        }
+    }
+
+    RL_FREE(frame->pixels);
+    RL_FREE(frame);
+}
+#endif
+
+#if defined(SUPPORT_COMPRESSION_API)
+// Load compression stream data
+static rCompressStream *RLLoadCompressStreamData(bool decompress)
+{
+    rCompressStream *stream = (rCompressStream *)RL_CALLOC(1, sizeof(rCompressStream));
+    if (stream == NULL) return NULL;
+
+    stream->decompress = decompress;
+    stream->outputCapacity = 2*SDEFL_WIN_SIZ;
+    stream->output = (unsigned char *)RL_MALLOC(stream->outputCapacity);
+
+    if (!decompress)
+    {
+        // NOTE: Compressor state is not cleared on allocation, sdefl_begin() initializes required data
+        stream->state = (struct sdefl *)RL_MALLOC(sizeof(struct sdefl));   // WARNING: struct sdefl is almost 1MB
+        stream->window = (unsigned char *)RL_MALLOC(SDEFL_WIN_SIZ + SDEFL_BLK_MAX);
+        if (stream->state != NULL) sdefl_begin(stream->state);
+    }
+
+    if ((stream->output == NULL) || (!decompress && ((stream->state == NULL) || (stream->window == NULL))))
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Failed to allocate compression stream memory");
+        RLUnloadCompressStreamData(stream);
+        stream = NULL;
+    }
+
+    return stream;
+}
+
+// Unload compression stream data
+static void RLUnloadCompressStreamData(rCompressStream *stream)
+{
+    for (int i = 0; i < stream->workerCount; i++) RL_FREE(stream->workerStates[i]);
+    RL_FREE(stream->workerStates);
+    RL_FREE(stream->state);
+    RL_FREE(stream->window);
+    RL_FREE(stream->input);
+    RL_FREE(stream->output);
+    RL_FREE(stream);
+}
+
+// Drop stream output already returned, start a new stream if previous one finished
+static void RLBeginCompressStreamUpdate(rCompressStream *stream)
+{
+    if (stream->finished)
+    {
+        stream->finished = false;
+        stream->failed = false;
+        stream->ended = false;
+        stream->windowStart = 0;
+        stream->windowSize = 0;
+        stream->inputSize = 0;
+        stream->inputBit = 0;
+        stream->inputRetrySize = 0;
+        stream->outputSize = 0;
+        if (stream->state != NULL) sdefl_begin(stream->state);
+    }
+    else if (!stream->decompress) stream->outputSize = 0;
+    else if (stream->outputSize > SDEFL_WIN_SIZ)
+    {
+        // Keep decompressed data history, referenced by next blocks matches
+        memmove(stream->output, stream->output + stream->outputSize - SDEFL_WIN_SIZ, SDEFL_WIN_SIZ);
+        stream->outputSize = SDEFL_WIN_SIZ;
+    }
+
+    stream->outputStart = stream->outputSize;
+}
+
+// Reserve stream output space, capacity grows geometrically
+static bool RLReserveCompressStreamOutput(rCompressStream *stream, int size)
+{
+    if (size <= (stream->outputCapacity - stream->outputSize)) return true;
+
+    bool result = false;
+
+    if (size <= (INT_MAX - stream->outputSize))
+    {
+        int capacity = (stream->outputCapacity <= INT_MAX/2)? 2*stream->outputCapacity : INT_MAX;
+        if (capacity < (stream->outputSize + size)) capacity = stream->outputSize + size;
+
+        unsigned char *output = (unsigned char *)RL_REALLOC(stream->output, capacity);
+
+        if (output != NULL)
+        {
+            stream->output = output;
+            stream->outputCapacity = capacity;
+            result = true;
+        }
+    }
+
+    if (!result)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Failed to allocate compression stream memory");
+        stream->failed = true;
+    }
+
+    return result;
+}
+
+// Compress data chunk into stream output
+// NOTE: Input is compressed by SDEFL_BLK_MAX blocks (same blocks as compressing all data at once),
+// pending input is kept in window until a block is complete
+static void RLDeflateStreamData(rCompressStream *stream, const unsigned char *data, int dataSize, bool last)
+{
+    while ((dataSize > 0) && !stream->failed)
+    {
+        if (dataSize >= 2*COMPRESSION_PARALLEL_BLOCK_SIZE)
+        {
+            // Pending input is compressed and output aligned to byte, so blocks output can be appended
+            if (!RLReserveCompressStreamOutput(stream, sdefl_bound(stream->windowSize - stream->windowStart) + 8)) break;
+            stream->outputSize += sdeflate_range(stream->state, stream->output + stream->outputSize, stream->window, stream->windowStart, stream->windowSize, 0, COMPRESSION_QUALITY_DEFLATE);
+            if (stream->state->bitcnt > 0) stream->outputSize += sdefl_sync(stream->state, stream->output + stream->outputSize);
+
+            int size = RLDeflateStreamBlocks(stream, data, dataSize);
+            if (size == 0) break;
+
+            // Last data compressed is history for next input
+            memcpy(stream->window, data + size - SDEFL_WIN_SIZ, SDEFL_WIN_SIZ);
+            sdefl_begin(stream->state);
+            sdefl_prime(stream->state, stream->window, 0, SDEFL_WIN_SIZ);
+            stream->windowStart = SDEFL_WIN_SIZ;
+            stream->windowSize = SDEFL_WIN_SIZ;
+
+            data += size;
+            dataSize -= size;
+            continue;
+        }
+
+        int size = SDEFL_BLK_MAX - (stream->windowSize - stream->windowStart);
+        if (size > dataSize) size = dataSize;
+
+        memcpy(stream->window + stream->windowSize, data, size);
+        stream->windowSize += size;
+        data += size;
+        dataSize -= size;
+
+        if ((stream->windowSize - stream->windowStart) == SDEFL_BLK_MAX)
+        {
+            if (!RLReserveCompressStreamOutput(stream, sdefl_bound(stream->windowSize - stream->windowStart) + 8)) break;
+            stream->outputSize += sdeflate_range(stream->state, stream->output + stream->outputSize, stream->window, stream->windowStart, stream->windowSize, 0, COMPRESSION_QUALITY_DEFLATE);
+
+            // Slide window, keep last SDEFL_WIN_SIZ bytes as history
+            // NOTE: Window shift is a multiple of SDEFL_WIN_SIZ, required by sdefl_shift()
+            int shift = stream->windowSize - SDEFL_WIN_SIZ;
+            memmove(stream->window, stream->window + shift, SDEFL_WIN_SIZ);
+            sdefl_shift(stream->state, shift);
+            stream->windowStart = SDEFL_WIN_SIZ;
+            stream->windowSize = SDEFL_WIN_SIZ;
+        }
+    }
+
+    if (last && !stream->failed && RLReserveCompressStreamOutput(stream, sdefl_bound(stream->windowSize - stream->windowStart) + 8))
+    {
+        stream->outputSize += sdeflate_range(stream->state, stream->output + stream->outputSize, stream->window, stream->windowStart, stream->windowSize, 1, COMPRESSION_QUALITY_DEFLATE);
+        stream->windowStart = stream->windowSize;
+    }
+}
+
+// Compress data blocks into stream output using job workers, returns data size compressed
+// NOTE: Only complete blocks are compressed, remaining data is compressed by caller
+static int RLDeflateStreamBlocks(rCompressStream *stream, const unsigned char *data, int dataSize)
+{
+    int blockCount = dataSize/COMPRESSION_PARALLEL_BLOCK_SIZE;
+    int workerCount = RLGetJobWorkerCount();
+
+    if (workerCount > stream->workerCount)
+    {
+        struct sdefl **workerStates = (struct sdefl **)RL_REALLOC(stream->workerStates, workerCount*sizeof(struct sdefl *));
+        if (workerStates == NULL) { stream->failed = true; return 0; }
+
+        for (int i = stream->workerCount; i < workerCount; i++) workerStates[i] = NULL;
+        stream->workerStates = workerStates;
+        stream->workerCount = workerCount;
+    }
+
+    CompressBlocksJob job = {
+        .stream = stream,
+        .data = data,
+        .slotSize = sdefl_bound(COMPRESSION_PARALLEL_BLOCK_SIZE) + 8,
+        .blockSizes = (int *)RL_MALLOC(blockCount*sizeof(int))
+    };
+
+    if ((job.blockSizes == NULL) || !RLReserveCompressStreamOutput(stream, blockCount*job.slotSize))
+    {
+        RL_FREE(job.blockSizes);
+        stream->failed = true;
+        return 0;
+    }
+
+    job.output = stream->output + stream->outputSize;
+    RLParallelFor(blockCount, 1, RLDeflateBlocksRange, &job);
+
+    // Blocks output moved together, in order
+    for (int i = 0; i < blockCount; i++)
+    {
+        if (job.blockSizes[i] < 0) { stream->failed = true; break; }
+
+        memmove(stream->output + stream->outputSize, job.output + (size_t)i*job.slotSize, job.blockSizes[i]);
+        stream->outputSize += job.blockSizes[i];
+    }
+
+    RL_FREE(job.blockSizes);
+
+    return stream->failed? 0 : blockCount*COMPRESSION_PARALLEL_BLOCK_SIZE;
+}
+
+// Compress data blocks (job callback)
+// NOTE: Compressor state for worker 0 is stream compressor state, it is started again after blocks compression
+static void RLDeflateBlocksRange(void *userData, int start, int end, int worker)
+{
+    CompressBlocksJob *job = (CompressBlocksJob *)userData;
+    struct sdefl *state = (worker == 0)? job->stream->state : job->stream->workerStates[worker];
+
+    if (state == NULL)
+    {
+        state = (struct sdefl *)RL_MALLOC(sizeof(struct sdefl));
+        job->stream->workerStates[worker] = state;
+    }
+
+    for (int i = start; i < end; i++)
+    {
+        int begin = i*COMPRESSION_PARALLEL_BLOCK_SIZE;
+        unsigned char *output = job->output + (size_t)i*job->slotSize;
+
+        if (state == NULL) { job->blockSizes[i] = -1; continue; }
+
+        // Previous data used as dictionary, compression ratio is close to compressing all data at once
+        sdefl_begin(state);
+        if (i > 0) sdefl_prime(state, job->data, begin - SDEFL_WIN_SIZ, begin);
+
+        int size = sdeflate_range(state, output, job->data, begin, begin + COMPRESSION_PARALLEL_BLOCK_SIZE, 0, COMPRESSION_QUALITY_DEFLATE);
+        if (state->bitcnt > 0) size += sdefl_sync(state, output + size);
+
+        job->blockSizes[i] = size;
+    }
+}
+
+// Decompress data chunk into stream output
+// NOTE: Only complete DEFLATE blocks are decompressed, input of block not complete yet is kept pending,
+// decoding is tried again when pending input doubles, to avoid decoding a big block again for every small chunk
+static void RLInflateStreamData(rCompressStream *stream, const unsigned char *compData, int compDataSize, bool last)
+{
+    if (stream->ended || stream->failed) return;    // NOTE: Data after last block is ignored
+
+    const unsigned char *input = compData;
+    int inputSize = compDataSize;
+    int bitPosition = 0;
+
+    if (stream->inputSize > 0)
+    {
+        if ((stream->inputSize + compDataSize) > stream->inputCapacity)
+        {
+            int capacity = 2*stream->inputCapacity;
+            if (capacity < (stream->inputSize + compDataSize)) capacity = stream->inputSize + compDataSize;
+
+            unsigned char *pending = (unsigned char *)RL_REALLOC(stream->input, capacity);
+            if (pending == NULL)
+            {
+                TRACELOG(LOG_WARNING, "SYSTEM: Failed to allocate compression stream memory");
+                stream->failed = true;
+                return;
+            }
+
+            stream->input = pending;
+            stream->inputCapacity = capacity;
+        }
+
+        if (compDataSize > 0) memcpy(stream->input + stream->inputSize, compData, compDataSize);
+        stream->inputSize += compDataSize;
+
+        if (!last && (stream->inputSize < stream->inputRetrySize)) return;
+
+        input = stream->input;
+        inputSize = stream->inputSize;
+        bitPosition = stream->inputBit;
+    }
+
+    // NOTE: Input position is tracked in bits (int), bigger input would resume decoding from a wrong position
+    if (inputSize >= INT_MAX/8)
+    {
+        TRACELOG(LOG_WARNING, "SYSTEM: Decompress data: Compressed data too big (%i bytes), maximum supported is %i bytes", inputSize, INT_MAX/8 - 1);
+        stream->failed = true;
+        return;
+    }
+
+    int status = SINFL_STREAM_INPUT;
+
+    if (inputSize > 0)
+    {
+        status = sinflate_stream(stream->output, &stream->outputSize, stream->outputCapacity, input, &bitPosition, inputSize);
+
+        // Output grown until next block fits, block is decoded again from start
+        while ((status == SINFL_STREAM_OUTPUT) && RLReserveCompressStreamOutput(stream, stream->outputCapacity - stream->outputSize + 1))
+        {
+            status = sinflate_stream(stream->output, &stream->outputSize, stream->outputCapacity, input, &bitPosition, inputSize);
+        }
+    }
+
+    if (stream->failed) return;
+
+    if (status == SINFL_STREAM_END)
+    {
+        stream->ended = true;
+        stream->inputSize = 0;
+    }
+    else if ((status == SINFL_STREAM_INPUT) && !last)
+    {
+        // Keep input of block not complete yet
+        int offset = bitPosition/8;
+        int size = inputSize - offset;
+
+        if (input == stream->input) memmove(stream->input, stream->input + offset, size);
+        else if (size > 0)
+        {
+            if (size > stream->inputCapacity)
+            {
+                unsigned char *pending = (unsigned char *)RL_REALLOC(stream->input, size);
+                if (pending == NULL)
+                {
+                    TRACELOG(LOG_WARNING, "SYSTEM: Failed to allocate compression stream memory");
+                    stream->failed = true;
+                    return;
+                }
+
+                stream->input = pending;
+                stream->inputCapacity = size;
+            }
+
+            memcpy(stream->input, input + offset, size);
+        }
+
+        stream->inputSize = size;
+        stream->inputBit = bitPosition%8;
+        stream->inputRetrySize = 2*size;
+    }
+    else
+    {
+        if (status == SINFL_STREAM_INPUT) TRACELOG(LOG_WARNING, "SYSTEM: Decompress data: Compressed data is incomplete");
+        else TRACELOG(LOG_WARNING, "SYSTEM: Decompress data: Compressed data is not valid");
+        stream->failed = true;
+    }
+}
+#endif
+
 #if defined(SUPPORT_AUTOMATION_EVENTS)
 // Automation event recording
 // NOTE: Recording is by default done at EndDrawing(), before PollInputEvents()
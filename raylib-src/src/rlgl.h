@@ -31,6 +31,12 @@
 *           Those preprocessor defines are only used on rlgl module, if OpenGL version is
 *           required by any other module, use rlGetVersion() to check it
 *
+*       #define GRAPHICS_API_NULL
+*           Use a null graphics device, no GPU or OpenGL library required. OpenGL 3.3 Core commands
+*           are recorded instead of executed: objects bookkeeping and commands statistics are kept,
+*           commands log can be enabled with rlEnableCommandLog(). Useful for CPU-only benchmarking
+*           and testing on headless environments, rlLoadExtensions() does not require a loader
+*
 *       #define RLGL_IMPLEMENTATION
 *           Generates the implementation of the library into the included file
 *           If not defined, the library is in header only mode and can be included in other headers
@@ -46,6 +52,11 @@
 *       #define RLGL_ENABLE_OPENGL_DEBUG_CONTEXT
 *           Enable debug context (only available on OpenGL 4.3)
 *
+*       #define RLGL_ENABLE_BATCH_INTERLEAVED
+*           Use an interleaved vertex layout (rlBatchVertex) for render batches, one buffer upload per draw
+*           If GL_ARB_buffer_storage is supported (OpenGL 4.3 drivers), batch buffers are persistently
+*           mapped and written directly by rlVertex3f(), buffers are used as a fenced ring (no implicit sync)
+*
 *       rlgl capabilities could be customized just defining some internal
 *       values before library inclusion (default values listed):
 *
@@ -53,6 +64,8 @@
 *       #define RL_DEFAULT_BATCH_BUFFERS              1    // Default number of batch buffers (multi-buffering)
 *       #define RL_DEFAULT_BATCH_DRAWCALLS          256    // Default number of batch draw calls (by state changes: mode, texture)
 *       #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS    4    // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
+*       #define RL_DEFAULT_BATCH_TEXTURE_SLOTS        8    // Maximum number of textures sampled by one batch draw call with default shader (1 to disable, max 8)
+*       #define RL_DEFAULT_BATCH_MAPPED_BUFFERS       3    // Minimum number of batch buffers if persistently mapped (RLGL_ENABLE_BATCH_INTERLEAVED)
 *
 *       #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
 *       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
@@ -70,6 +83,7 @@
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2    "vertexTexCoord2"   // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS      "vertexBoneIds"     // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS
 *       #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS
+*       #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXTURESLOT  "vertexTextureSlot" // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXTURESLOT
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_VIEW        "matView"           // view matrix
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_PROJECTION  "matProjection"     // projection matrix
@@ -148,6 +162,16 @@
     #define RL_FREE(p)        free(p)
 #endif
 
+// Null graphics device records OpenGL 3.3 Core commands
+#if defined(GRAPHICS_API_NULL)
+    #undef GRAPHICS_API_OPENGL_11
+    #undef GRAPHICS_API_OPENGL_ES2
+    #undef GRAPHICS_API_OPENGL_ES3
+    #if !defined(GRAPHICS_API_OPENGL_33)
+        #define GRAPHICS_API_OPENGL_33
+    #endif
+#endif
+
 // Security check in case no GRAPHICS_API_OPENGL_* defined
 #if !defined(GRAPHICS_API_OPENGL_11) && \
     !defined(GRAPHICS_API_OPENGL_21) && \
@@ -221,6 +245,12 @@
 #ifndef RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS
     #define RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS       4      // Maximum number of textures units that can be activated on batch drawing (SetShaderValueTexture())
 #endif
+#ifndef RL_DEFAULT_BATCH_TEXTURE_SLOTS
+    #define RL_DEFAULT_BATCH_TEXTURE_SLOTS           8      // Maximum number of textures sampled by one batch draw call with default shader (1 to disable, max 8)
+#endif
+#ifndef RL_DEFAULT_BATCH_MAPPED_BUFFERS
+    #define RL_DEFAULT_BATCH_MAPPED_BUFFERS          3      // Minimum number of batch buffers if persistently mapped (RLGL_ENABLE_BATCH_INTERLEAVED)
+#endif
 
 // Internal Matrix stack
 #ifndef RL_MAX_MATRIX_STACK_SIZE
@@ -347,6 +377,9 @@
 #ifndef RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES
     #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES     6
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXTURESLOT
+    #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXTURESLOT 6     // NOTE: Indices are not an attribute, location only used by render batch texture slots
+#endif
 #ifdef RL_SUPPORT_MESH_GPU_SKINNING
 #ifndef RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS
     #define RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS     7
@@ -377,6 +410,16 @@ typedef struct Matrix {
 #define RL_MATRIX_TYPE
 #endif
 
+// Interleaved batch vertex (40 bytes), used by render batches with RLGL_ENABLE_BATCH_INTERLEAVED
+typedef struct rlBatchVertex {
+    float position[3];          // Vertex position (XYZ) (shader-location = 0)
+    float texcoord[2];          // Vertex texture coordinates (UV) (shader-location = 1)
+    float normal[3];            // Vertex normal (XYZ) (shader-location = 2)
+    unsigned char color[4];     // Vertex color (RGBA) (shader-location = 3)
+    unsigned char textureSlot;  // Vertex texture slot (shader-location = 6)
+    unsigned char padding[3];   // Padding to keep vertex size 4 bytes aligned
+} rlBatchVertex;
+
 // Dynamic vertex buffers (position + texcoords + colors + indices arrays)
 typedef struct rlVertexBuffer {
     int elementCount;           // Number of elements in the buffer (QUADS)
@@ -391,8 +434,12 @@ typedef struct rlVertexBuffer {
 #if defined(GRAPHICS_API_OPENGL_ES2)
     unsigned short *indices;    // Vertex indices (in case vertex data comes indexed) (6 indices per quad)
 #endif
+    unsigned char *textureSlots; // Vertex texture slot (1 component per vertex) (shader-location = 6)
+    rlBatchVertex *interleaved; // Interleaved vertex data (RLGL_ENABLE_BATCH_INTERLEAVED), replaces previous arrays if not NULL
+    bool mapped;                // Interleaved vertex data is persistently mapped GPU memory
+    void *fence;                // Sync object signaled when GPU finished reading mapped vertex data
     unsigned int vaoId;         // OpenGL Vertex Array Object id
-    unsigned int vboId[5];      // OpenGL Vertex Buffer Objects id (5 types of vertex data)
+    unsigned int vboId[6];      // OpenGL Vertex Buffer Objects id (6 types of vertex data)
 } rlVertexBuffer;
 
 // Draw call type
@@ -406,6 +453,8 @@ typedef struct rlDrawCall {
     //unsigned int vaoId;       // Vertex array id to be used on the draw -> Using RLGL.currentBatch->vertexBuffer.vaoId
     //unsigned int shaderId;    // Shader id to be used on the draw -> Using RLGL.currentShaderId
     unsigned int textureId;     // Texture id to be used on the draw -> Use to create new draw call if changes
+    int textureCount;           // Number of textures sampled by the draw (texture slots, default shader only)
+    unsigned int textures[RL_DEFAULT_BATCH_TEXTURE_SLOTS]; // Texture ids bound to every texture slot of the draw
 
     //Matrix projection;        // Projection matrix for this draw -> Using RLGL.projection by default
     //Matrix modelview;         // Modelview matrix for this draw -> Using RLGL.modelview by default
@@ -422,6 +471,34 @@ typedef struct rlRenderBatch {
     float currentDepth;         // Current depth value for next draw
 } rlRenderBatch;
 
+// rlCommandStats type, commands recorded by null graphics device (GRAPHICS_API_NULL)
+typedef struct rlCommandStats {
+    unsigned int commands;      // Number of OpenGL commands issued
+    unsigned int drawCalls;     // Number of draw calls (glDrawArrays*(), glDrawElements*())
+    unsigned int vertices;      // Number of vertices (or indices) drawn, including instances
+    unsigned int instances;     // Number of instances drawn
+    unsigned int stateChanges;  // Number of state changes (binding, blending, viewport...)
+    unsigned int uniformUpdates; // Number of shader uniform updates
+    unsigned int bufferUploads; // Number of buffer data uploads (or write mappings)
+    unsigned int textureUploads; // Number of texture data uploads
+    unsigned long long uploadBytes; // Bytes uploaded (buffers and textures)
+    unsigned long long readbackBytes; // Bytes read back (pixels and read mappings)
+    int textureCount;           // Number of textures currently loaded
+    int bufferCount;            // Number of buffers currently loaded
+    int shaderCount;            // Number of shader programs currently loaded
+    unsigned long long textureMemory; // Textures (and renderbuffers) memory currently allocated
+    unsigned long long bufferMemory; // Buffers memory currently allocated
+} rlCommandStats;
+
+// rlBatchStats type, render batch statistics (texture slots batching)
+typedef struct rlBatchStats {
+    unsigned int flushes;       // Number of render batch flushes with vertex data
+    unsigned int drawCalls;     // Number of draw calls issued by render batches
+    unsigned int textureSwitches; // Number of texture changes requested by rlSetTexture()
+    unsigned int textureSlotHits; // Number of texture changes resolved by a texture slot (no new draw call)
+    unsigned int bufferWaits;   // Number of waits for GPU to release a mapped batch buffer (RLGL_ENABLE_BATCH_INTERLEAVED)
+} rlBatchStats;
+
 // OpenGL version
 typedef enum {
     RL_OPENGL_11 = 1,           // OpenGL 1.1
@@ -696,6 +773,7 @@ RLAPI void rlClearColor(unsigned char r, unsigned char g, unsigned char b, unsig
 RLAPI void rlClearScreenBuffers(void);                  // Clear used screen buffers (color and depth)
 RLAPI void rlCheckErrors(void);                         // Check and log OpenGL error codes
 RLAPI void rlSetBlendMode(int mode);                    // Set blending mode
+RLAPI int rlGetBlendMode(void);                         // Get blending mode active
 RLAPI void rlSetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation); // Set blending mode factor and equation (using OpenGL factors)
 RLAPI void rlSetBlendFactorsSeparate(int glSrcRGB, int glDstRGB, int glSrcAlpha, int glDstAlpha, int glEqRGB, int glEqAlpha); // Set blending mode factors and equations separately (using OpenGL factors)
 
@@ -711,10 +789,21 @@ RLAPI void rlSetFramebufferWidth(int width);            // Set current framebuff
 RLAPI int rlGetFramebufferWidth(void);                  // Get default framebuffer width
 RLAPI void rlSetFramebufferHeight(int height);          // Set current framebuffer height
 RLAPI int rlGetFramebufferHeight(void);                 // Get default framebuffer height
+RLAPI int rlGetTextureMaxSize(void);                    // Get maximum texture size supported (width and height)
 
 RLAPI unsigned int rlGetTextureIdDefault(void);         // Get default texture id
 RLAPI unsigned int rlGetShaderIdDefault(void);          // Get default shader id
 RLAPI int *rlGetShaderLocsDefault(void);                // Get default shader locations
+RLAPI unsigned int rlGetShaderIdCurrent(void);          // Get current shader id
+RLAPI int *rlGetShaderLocsCurrent(void);                // Get current shader locations
+
+// Commands recording (only available with GRAPHICS_API_NULL)
+RLAPI rlCommandStats rlGetCommandStats(void);           // Get commands statistics recorded
+RLAPI void rlResetCommandStats(void);                   // Reset commands statistics (loaded objects statistics are kept)
+RLAPI void rlEnableCommandLog(void);                    // Enable commands log recording
+RLAPI void rlDisableCommandLog(void);                   // Disable commands log recording
+RLAPI const char *rlGetCommandLog(void);                // Get commands log recorded (one command per line)
+RLAPI void rlClearCommandLog(void);                     // Clear commands log recorded
 
 // Render batch management
 // NOTE: rlgl provides a default render batch to behave like OpenGL 1.1 immediate mode
@@ -725,6 +814,11 @@ RLAPI void rlDrawRenderBatch(rlRenderBatch *batch);     // Draw render batch dat
 RLAPI void rlSetRenderBatchActive(rlRenderBatch *batch); // Set the active render batch for rlgl (NULL for default internal)
 RLAPI void rlDrawRenderBatchActive(void);               // Update and draw internal render batch
 RLAPI bool rlCheckRenderBatchLimit(int vCount);         // Check internal buffer overflow for a given number of vertex
+RLAPI void rlEnableTextureSlots(void);                  // Enable texture slots batching (default shader samples several textures per draw call)
+RLAPI void rlDisableTextureSlots(void);                 // Disable texture slots batching (one draw call per texture change)
+RLAPI bool rlIsTextureSlotsEnabled(void);               // Check if texture slots batching is enabled and supported
+RLAPI rlBatchStats rlGetRenderBatchStats(void);         // Get render batch statistics
+RLAPI void rlResetRenderBatchStats(void);               // Reset render batch statistics
 
 RLAPI void rlSetTexture(unsigned int id);               // Set current texture for render batch and check buffers limits
 
@@ -736,6 +830,7 @@ RLAPI unsigned int rlLoadVertexBuffer(const void *buffer, int size, bool dynamic
 RLAPI unsigned int rlLoadVertexBufferElement(const void *buffer, int size, bool dynamic); // Load vertex buffer elements object
 RLAPI void rlUpdateVertexBuffer(unsigned int bufferId, const void *data, int dataSize, int offset); // Update vertex buffer object data on GPU buffer
 RLAPI void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset); // Update vertex buffer elements data on GPU buffer
+RLAPI void rlOrphanVertexBuffer(unsigned int id, int size, bool dynamic); // Orphan vertex buffer object data storage (new storage provided, no GPU sync)
 RLAPI void rlUnloadVertexArray(unsigned int vaoId);     // Unload vertex array (vao)
 RLAPI void rlUnloadVertexBuffer(unsigned int vboId);    // Unload vertex buffer object
 RLAPI void rlSetVertexAttribute(unsigned int index, int compSize, int type, bool normalized, int stride, int offset); // Set vertex attribute data configuration
@@ -757,6 +852,10 @@ RLAPI void rlUnloadTexture(unsigned int id);                              // Unl
 RLAPI void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps); // Generate mipmap data for selected texture
 RLAPI void *rlReadTexturePixels(unsigned int id, int width, int height, int format); // Read texture pixel data
 RLAPI unsigned char *rlReadScreenPixels(int width, int height);           // Read screen pixel data (color buffer)
+RLAPI unsigned int rlLoadReadbackBuffer(int width, int height);           // Load pixel pack buffer for asynchronous screen readback (0 if not supported)
+RLAPI void rlReadScreenPixelsAsync(unsigned int id, int width, int height); // Request screen pixel data (color buffer) into readback buffer, no CPU sync
+RLAPI bool rlGetReadbackBufferPixels(unsigned int id, int width, int height, unsigned char *pixels); // Get requested screen pixel data from readback buffer (RGBA, top-left origin)
+RLAPI void rlUnloadReadbackBuffer(unsigned int id);                       // Unload readback buffer
 
 // Framebuffer management (fbo)
 RLAPI unsigned int rlLoadFramebuffer(void);                               // Load an empty framebuffer
@@ -885,9 +984,14 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #endif
 
 #include <stdlib.h>                     // Required for: malloc(), free()
-#include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading]
+#include <string.h>                     // Required for: strcmp(), strlen() [Used in rlglInit(), on extensions loading], memcpy()
 #include <math.h>                       // Required for: sqrtf(), sinf(), cosf(), floor(), log()
 
+#if defined(GRAPHICS_API_NULL)
+    #include <stdio.h>                  // Required for: vsnprintf() [Used in rlNullLog()]
+    #include <stdarg.h>                 // Required for: va_list, va_start(), va_end() [Used in rlNullLog()]
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
@@ -998,6 +1102,9 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS
     #define RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS  "vertexBoneWeights" // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_NAME_BONEWEIGHTS
 #endif
+#ifndef RL_DEFAULT_SHADER_ATTRIB_NAME_TEXTURESLOT
+    #define RL_DEFAULT_SHADER_ATTRIB_NAME_TEXTURESLOT  "vertexTextureSlot" // Bound by default to shader location: RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXTURESLOT
+#endif
 
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_MVP
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_MVP         "mvp"               // model-view-projection matrix
@@ -1055,8 +1162,13 @@ typedef struct rlglData {
 
         unsigned int defaultTextureId;      // Default texture used on shapes/poly drawing (required by shader)
         unsigned int activeTextureId[RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS];    // Active texture ids to be enabled on batch drawing (0 active by default)
+        int textureSlotCount;               // Texture slots available for batch drawing with default shader (1 if not supported)
+        bool textureSlotsEnabled;           // Texture slots batching enabled flag
+        unsigned char textureSlot;          // Current texture slot for next vertex (index into current draw textures)
+        rlBatchStats batchStats;            // Render batch statistics
         unsigned int defaultVShaderId;      // Default vertex shader id (used by default shader program)
-        unsigned int defaultFShaderId;      // Default fragment shader id (used by default shader program)
+        unsigned int defaultFShaderId;      // Default fragment shader id (used on custom shaders loading)
+        unsigned int defaultSlotsFShaderId; // Default fragment shader id with texture slots (used by default shader program)
         unsigned int defaultShaderId;       // Default shader program id, supports vertex color and diffuse texture
         int *defaultShaderLocs;             // Default shader locations pointer to be used on rendering
         unsigned int currentShaderId;       // Current shader id to be used on rendering (by default, defaultShaderId)
@@ -1100,9 +1212,11 @@ typedef struct rlglData {
         bool texAnisoFilter;                // Anisotropic texture filtering support (GL_EXT_texture_filter_anisotropic)
         bool computeShader;                 // Compute shaders support (GL_ARB_compute_shader)
         bool ssbo;                          // Shader storage buffer object support (GL_ARB_shader_storage_buffer_object)
+        bool bufferStorage;                 // Persistently mapped buffers support (GL_ARB_buffer_storage + fences)
 
         float maxAnisotropyLevel;           // Maximum anisotropy level supported (minimum is 2.0f)
         int maxDepthBits;                   // Maximum bits for depth component
+        int maxTextureSize;                 // Maximum texture width and height (GL_MAX_TEXTURE_SIZE)
 
     } ExtSupported;     // Extensions supported flags
 } rlglData;
@@ -1111,6 +1225,73 @@ typedef void *(*rlglLoadProc)(const char *name);   // OpenGL extension functions
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+#if defined(GRAPHICS_API_NULL)
+#define RL_NULL_MAX_TEXTURE_UNITS      16       // Null device texture units available
+#define RL_NULL_BUFFER_TARGETS          6       // Null device buffer binding points (array, element, pack, unpack, uniform, other)
+
+// Null device object types
+typedef enum {
+    RL_NULL_NONE = 0,
+    RL_NULL_TEXTURE,
+    RL_NULL_BUFFER,
+    RL_NULL_VERTEX_ARRAY,
+    RL_NULL_FRAMEBUFFER,
+    RL_NULL_RENDERBUFFER,
+    RL_NULL_SHADER,
+    RL_NULL_PROGRAM
+} rlNullObjectType;
+
+// Null device shader variable (attribute or uniform)
+typedef struct rlNullVariable {
+    char name[64];                      // Variable name
+    int location;                       // Variable location (-1 if not assigned)
+    bool uniform;                       // Variable is an uniform (or an attribute)
+    bool bound;                         // Attribute location requested by glBindAttribLocation()
+    bool active;                        // Variable declared by program shaders
+} rlNullVariable;
+
+// Null device object
+typedef struct rlNullObject {
+    int type;                           // Object type (rlNullObjectType)
+    int width;                          // Texture/renderbuffer width
+    int height;                         // Texture/renderbuffer height
+    bool mipmaps;                       // Texture mipmaps generated
+    unsigned int size;                  // Memory size in bytes (textures, renderbuffers, buffers)
+    unsigned char *storage;             // Buffer storage, allocated on first mapping
+    unsigned int elementBuffer;         // Vertex array element buffer binding
+    unsigned int depthAttachment;       // Framebuffer depth attachment id
+    int depthAttachmentType;            // Framebuffer depth attachment type (GL_TEXTURE, GL_RENDERBUFFER)
+    int shaderType;                     // Shader type (GL_VERTEX_SHADER, GL_FRAGMENT_SHADER)
+    unsigned int shaders[2];            // Program attached shaders
+    rlNullVariable *variables;          // Shader/program variables
+    int variableCount;                  // Shader/program variables count
+} rlNullObject;
+
+// Null device data
+typedef struct rlNullData {
+    rlNullObject *objects;              // Objects, indexed by id
+    unsigned int objectCount;           // Objects count (including deleted ones)
+    unsigned int objectCapacity;        // Objects capacity
+    unsigned int *freeIds;              // Deleted objects ids, to be reused
+    unsigned int freeIdCount;           // Deleted objects ids count
+
+    int activeTexture;                  // Active texture unit
+    unsigned int textures[RL_NULL_MAX_TEXTURE_UNITS]; // Texture bound to every unit
+    unsigned int buffers[RL_NULL_BUFFER_TARGETS]; // Buffer bound to every target
+    unsigned int vertexArray;           // Vertex array bound
+    unsigned int framebuffer;           // Framebuffer bound
+    unsigned int renderbuffer;          // Renderbuffer bound
+    int viewport[4];                    // Viewport
+    float lineWidth;                    // Line width
+
+    rlCommandStats stats;               // Commands statistics
+    bool logEnabled;                    // Commands log enabled
+    char *log;                          // Commands log, one command per line
+    unsigned int logSize;               // Commands log size (without NULL terminator)
+    unsigned int logCapacity;           // Commands log capacity
+} rlNullData;
+#endif  // GRAPHICS_API_NULL
+
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
@@ -1121,6 +1302,10 @@ static double rlCullDistanceFar = RL_CULL_DISTANCE_FAR;
 static rlglData RLGL = { 0 };
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+#if defined(GRAPHICS_API_NULL)
+static rlNullData RLNULL = { .lineWidth = 1.0f };
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_ES2) && !defined(GRAPHICS_API_OPENGL_ES3)
 // NOTE: VAO functionality is exposed through extensions (OES)
 static PFNGLGENVERTEXARRAYSOESPROC glGenVertexArrays = NULL;
@@ -1139,11 +1324,17 @@ static PFNGLVERTEXATTRIBDIVISOREXTPROC glVertexAttribDivisor = NULL;
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 static void rlLoadShaderDefault(void);      // Load default shader
 static void rlUnloadShaderDefault(void);    // Unload default shader
+static void rlSetBatchVertexAttribs(void);  // Set render batch interleaved vertex attributes (RLGL_ENABLE_BATCH_INTERLEAVED)
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
 static const char *rlGetCompressedFormatName(int format); // Get compressed format official GL identifier name
 #endif  // RLGL_SHOW_GL_DETAILS_INFO
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+#if defined(GRAPHICS_API_NULL)
+static GLADapiproc rlNullGetProcAddress(const char *name); // Null device OpenGL functions loader
+static void rlNullUnload(void);             // Unload null device objects
+#endif
+
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
 
 // Auxiliar matrix math functions
@@ -1475,6 +1666,9 @@ void rlBegin(int mode)
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = mode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = RLGL.State.defaultTextureId;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureCount = 1;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textures[0] = RLGL.State.defaultTextureId;
+        RLGL.State.textureSlot = 0;
     }
 }
 
@@ -1528,6 +1722,25 @@ void rlVertex3f(float x, float y, float z)
         }
     }
 
+    if (RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].interleaved != NULL)
+    {
+        // Add vertex with current texcoord, normal, color and texture slot
+        // NOTE: Vertex is written at once, interleaved data could be write-combined mapped GPU memory
+        rlBatchVertex vertex = {
+            { tx, ty, tz },
+            { RLGL.State.texcoordx, RLGL.State.texcoordy },
+            { RLGL.State.normalx, RLGL.State.normaly, RLGL.State.normalz },
+            { RLGL.State.colorr, RLGL.State.colorg, RLGL.State.colorb, RLGL.State.colora },
+            RLGL.State.textureSlot, { 0 }
+        };
+
+        RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].interleaved[RLGL.State.vertexCounter] = vertex;
+
+        RLGL.State.vertexCounter++;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
+        return;
+    }
+
     // Add vertices
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter] = tx;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].vertices[3*RLGL.State.vertexCounter + 1] = ty;
@@ -1548,6 +1761,9 @@ void rlVertex3f(float x, float y, float z)
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 2] = RLGL.State.colorb;
     RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].colors[4*RLGL.State.vertexCounter + 3] = RLGL.State.colora;
 
+    // Add current texture slot
+    RLGL.currentBatch->vertexBuffer[RLGL.currentBatch->currentBuffer].textureSlots[RLGL.State.vertexCounter] = RLGL.State.textureSlot;
+
     RLGL.State.vertexCounter++;
     RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount++;
 }
@@ -1648,6 +1864,32 @@ void rlSetTexture(unsigned int id)
 #else
         if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId != id)
         {
+            rlDrawCall *draw = &RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1];
+            RLGL.State.batchStats.textureSwitches++;
+
+            // Try to keep the current draw call, sampling the new texture from another texture slot
+            // NOTE: Only default shader selects texture by vertex slot, custom shaders just sample texture0
+            if (RLGL.State.textureSlotsEnabled && (RLGL.State.textureSlotCount > 1) &&
+                (RLGL.State.currentShaderId == RLGL.State.defaultShaderId) && (draw->vertexCount > 0))
+            {
+                int slot = 0;
+                while ((slot < draw->textureCount) && (draw->textures[slot] != id)) slot++;
+
+                if ((slot == draw->textureCount) && (draw->textureCount < RLGL.State.textureSlotCount))
+                {
+                    draw->textures[slot] = id;
+                    draw->textureCount++;
+                }
+
+                if (slot < draw->textureCount)
+                {
+                    draw->textureId = id;
+                    RLGL.State.textureSlot = (unsigned char)slot;
+                    RLGL.State.batchStats.textureSlotHits++;
+                    return;
+                }
+            }
+
             if (RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount > 0)
             {
                 // Make sure current RLGL.currentBatch->draws[i].vertexCount is aligned a multiple of 4,
@@ -1671,6 +1913,9 @@ void rlSetTexture(unsigned int id)
 
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = id;
             RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].vertexCount = 0;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureCount = 1;
+            RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textures[0] = id;
+            RLGL.State.textureSlot = 0;
         }
 #endif
     }
@@ -2129,6 +2374,16 @@ void rlSetBlendMode(int mode)
 #endif
 }
 
+// Get blending mode active
+int rlGetBlendMode(void)
+{
+    int mode = RL_BLEND_ALPHA;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    mode = RLGL.State.currentBlendMode;
+#endif
+    return mode;
+}
+
 // Set blending mode factor and equation
 void rlSetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation)
 {
@@ -2265,6 +2520,17 @@ void rlglInit(int width, int height)
     RLGL.State.currentShaderId = RLGL.State.defaultShaderId;
     RLGL.State.currentShaderLocs = RLGL.State.defaultShaderLocs;
 
+    // Init texture slots available for batch drawing, default shader samples up to 8 textures
+    // NOTE: OpenGL ES 2.0 guarantees 8 fragment texture units, OpenGL 3.3 guarantees 16
+    int maxTextureUnits = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &maxTextureUnits);
+    RLGL.State.textureSlotCount = RL_DEFAULT_BATCH_TEXTURE_SLOTS;
+    if (RLGL.State.textureSlotCount > 8) RLGL.State.textureSlotCount = 8;
+    if (RLGL.State.textureSlotCount > maxTextureUnits) RLGL.State.textureSlotCount = maxTextureUnits;
+    if (RLGL.State.textureSlotCount < 1) RLGL.State.textureSlotCount = 1;
+    RLGL.State.textureSlotsEnabled = true;
+    RLGL.State.textureSlot = 0;
+
     // Init default vertex arrays buffers
     // Simulate that the default shader has the location RL_SHADER_LOC_VERTEX_NORMAL to bind the normal buffer for the default render batch
     RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL] = RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL;
@@ -2335,6 +2601,9 @@ void rlglClose(void)
     glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
 #endif
+#if defined(GRAPHICS_API_NULL)
+    rlNullUnload();
+#endif
 }
 
 // Load OpenGL extensions
@@ -2342,6 +2611,10 @@ void rlglClose(void)
 void rlLoadExtensions(void *loader)
 {
 #if defined(GRAPHICS_API_OPENGL_33)     // Also defined for GRAPHICS_API_OPENGL_21
+#if defined(GRAPHICS_API_NULL)
+    // NOTE: Null device provides its own functions, loader is ignored
+    loader = (void *)rlNullGetProcAddress;
+#endif
     // NOTE: glad is generated and contains only required OpenGL 3.3 Core extensions (and lower versions)
     if (gladLoadGL((GLADloadfunc)loader) == 0) TRACELOG(RL_LOG_WARNING, "GLAD: Cannot load OpenGL extensions");
     else TRACELOG(RL_LOG_INFO, "GLAD: OpenGL extensions loaded successfully");
@@ -2388,6 +2661,7 @@ void rlLoadExtensions(void *loader)
     RLGL.ExtSupported.texCompASTC = GLAD_GL_KHR_texture_compression_astc_hdr && GLAD_GL_KHR_texture_compression_astc_ldr;
     RLGL.ExtSupported.texCompDXT = GLAD_GL_EXT_texture_compression_s3tc;  // Texture compression: DXT
     RLGL.ExtSupported.texCompETC2 = GLAD_GL_ARB_ES3_compatibility;        // Texture compression: ETC2/EAC
+    RLGL.ExtSupported.bufferStorage = GLAD_GL_ARB_buffer_storage && (glFenceSync != NULL);
     #if defined(GRAPHICS_API_OPENGL_43)
     RLGL.ExtSupported.computeShader = GLAD_GL_ARB_compute_shader;
     RLGL.ExtSupported.ssbo = GLAD_GL_ARB_shader_storage_buffer_object;
@@ -2577,6 +2851,9 @@ void rlLoadExtensions(void *loader)
     #endif
     glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT, &RLGL.ExtSupported.maxAnisotropyLevel);
 
+    // Maximum texture size, required to fit generated textures (i.e. font atlas)
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &RLGL.ExtSupported.maxTextureSize);
+
 #if defined(RLGL_SHOW_GL_DETAILS_INFO)
     // Show some OpenGL GPU capabilities
     TRACELOG(RL_LOG_INFO, "GL: OpenGL capabilities:");
@@ -2687,6 +2964,18 @@ int rlGetFramebufferHeight(void)
     return height;
 }
 
+// Get maximum texture size supported (width and height)
+int rlGetTextureMaxSize(void)
+{
+    int maxSize = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    maxSize = RLGL.ExtSupported.maxTextureSize;
+#elif defined(GRAPHICS_API_OPENGL_11)
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize);
+#endif
+    return maxSize;
+}
+
 // Get default internal texture (white texture)
 // NOTE: Default texture is a 1x1 pixel UNCOMPRESSED_R8G8B8A8
 unsigned int rlGetTextureIdDefault(void)
@@ -2718,6 +3007,26 @@ int *rlGetShaderLocsDefault(void)
     return locs;
 }
 
+// Get current shader id
+unsigned int rlGetShaderIdCurrent(void)
+{
+    unsigned int id = 0;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    id = RLGL.State.currentShaderId;
+#endif
+    return id;
+}
+
+// Get current shader locs
+int *rlGetShaderLocsCurrent(void)
+{
+    int *locs = NULL;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    locs = RLGL.State.currentShaderLocs;
+#endif
+    return locs;
+}
+
 // Render batch management
 //------------------------------------------------------------------------------------------------
 // Load render batch
@@ -2726,18 +3035,43 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     rlRenderBatch batch = { 0 };
 
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    bool interleaved = false;
+    bool mapped = false;
+#if defined(RLGL_ENABLE_BATCH_INTERLEAVED)
+    interleaved = true;
+    mapped = RLGL.ExtSupported.bufferStorage;
+
+    // Mapped buffers are used as a ring, a buffer is only written again once GPU finished reading it
+    if (mapped && (numBuffers < RL_DEFAULT_BATCH_MAPPED_BUFFERS)) numBuffers = RL_DEFAULT_BATCH_MAPPED_BUFFERS;
+#endif
+
     // Initialize CPU (RAM) vertex buffers (position, texcoord, color data and indexes)
     //--------------------------------------------------------------------------------------------
-    batch.vertexBuffer = (rlVertexBuffer *)RL_MALLOC(numBuffers*sizeof(rlVertexBuffer));
+    batch.vertexBuffer = (rlVertexBuffer *)RL_CALLOC(numBuffers, sizeof(rlVertexBuffer));
 
     for (int i = 0; i < numBuffers; i++)
     {
         batch.vertexBuffer[i].elementCount = bufferElements;
 
-        batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
-        batch.vertexBuffer[i].normals = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
-        batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+        if (interleaved)
+        {
+            // Interleaved vertex data is only allocated in RAM (CPU) if not mapped from GPU
+            if (!mapped) batch.vertexBuffer[i].interleaved = (rlBatchVertex *)RL_CALLOC(bufferElements*4, sizeof(rlBatchVertex));
+        }
+        else
+        {
+            batch.vertexBuffer[i].vertices = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
+            batch.vertexBuffer[i].texcoords = (float *)RL_MALLOC(bufferElements*2*4*sizeof(float));       // 2 float by texcoord, 4 texcoord by quad
+            batch.vertexBuffer[i].normals = (float *)RL_MALLOC(bufferElements*3*4*sizeof(float));        // 3 float by vertex, 4 vertex by quad
+            batch.vertexBuffer[i].colors = (unsigned char *)RL_MALLOC(bufferElements*4*4*sizeof(unsigned char));   // 4 float by color, 4 colors by quad
+            batch.vertexBuffer[i].textureSlots = (unsigned char *)RL_CALLOC(bufferElements*4, sizeof(unsigned char)); // 1 slot by vertex, 4 vertex by quad
+
+            for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
+            for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
+            for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].normals[j] = 0.0f;
+            for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
+        }
+
 #if defined(GRAPHICS_API_OPENGL_33)
         batch.vertexBuffer[i].indices = (unsigned int *)RL_MALLOC(bufferElements*6*sizeof(unsigned int));      // 6 int by quad (indices)
 #endif
@@ -2745,11 +3079,6 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         batch.vertexBuffer[i].indices = (unsigned short *)RL_MALLOC(bufferElements*6*sizeof(unsigned short));  // 6 int by quad (indices)
 #endif
 
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].vertices[j] = 0.0f;
-        for (int j = 0; j < (2*4*bufferElements); j++) batch.vertexBuffer[i].texcoords[j] = 0.0f;
-        for (int j = 0; j < (3*4*bufferElements); j++) batch.vertexBuffer[i].normals[j] = 0.0f;
-        for (int j = 0; j < (4*4*bufferElements); j++) batch.vertexBuffer[i].colors[j] = 0;
-
         int k = 0;
 
         // Indices can be initialized right now
@@ -2782,34 +3111,76 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
             glBindVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
-        // Quads - Vertex buffers binding and attributes enable
-        // Vertex position buffer (shader-location = 0)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-
-        // Vertex texcoord buffer (shader-location = 1)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-
-        // Vertex normal buffer (shader-location = 2)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].normals, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
-
-        // Vertex color buffer (shader-location = 3)
-        glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
-        glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
-        glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
-        glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
-        glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+        if (interleaved)
+        {
+            // Quads - Interleaved vertex buffer binding and attributes enable
+            // Vertex position, texcoord, normal, color and texture slot (shader-location = 0, 1, 2, 3, 6)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+#if defined(GRAPHICS_API_OPENGL_33)
+            if (mapped)
+            {
+                // Immutable storage, mapped once and kept mapped while the batch is loaded
+                // NOTE: Coherent mapping makes CPU writes visible to following draw calls without flushing
+                GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+                glBufferStorage(GL_ARRAY_BUFFER, bufferElements*4*sizeof(rlBatchVertex), NULL, flags | GL_DYNAMIC_STORAGE_BIT);
+                batch.vertexBuffer[i].interleaved = (rlBatchVertex *)glMapBufferRange(GL_ARRAY_BUFFER, 0, bufferElements*4*sizeof(rlBatchVertex), flags);
+                batch.vertexBuffer[i].mapped = (batch.vertexBuffer[i].interleaved != NULL);
+
+                if (!batch.vertexBuffer[i].mapped)
+                {
+                    // Mapping failed, vertex data is kept in RAM (CPU) and uploaded on draw (GL_DYNAMIC_STORAGE_BIT)
+                    TRACELOG(RL_LOG_WARNING, "RLGL: Failed to map render batch vertex buffer, using RAM (CPU) buffer");
+                    batch.vertexBuffer[i].interleaved = (rlBatchVertex *)RL_CALLOC(bufferElements*4, sizeof(rlBatchVertex));
+                }
+            }
+            else
+#endif
+            {
+                glBufferData(GL_ARRAY_BUFFER, bufferElements*4*sizeof(rlBatchVertex), batch.vertexBuffer[i].interleaved, GL_DYNAMIC_DRAW);
+            }
+
+            rlSetBatchVertexAttribs();
+        }
+        else
+        {
+            // Quads - Vertex buffers binding and attributes enable
+            // Vertex position buffer (shader-location = 0)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[0]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].vertices, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+
+            // Vertex texcoord buffer (shader-location = 1)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[1]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[1]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*2*4*sizeof(float), batch.vertexBuffer[i].texcoords, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+
+            // Vertex normal buffer (shader-location = 2)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[2]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[2]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*3*4*sizeof(float), batch.vertexBuffer[i].normals, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
+
+            // Vertex color buffer (shader-location = 3)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[3]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[3]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*4*4*sizeof(unsigned char), batch.vertexBuffer[i].colors, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+            glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+
+            // Vertex texture slot buffer (shader-location = 6)
+            glGenBuffers(1, &batch.vertexBuffer[i].vboId[5]);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[5]);
+            glBufferData(GL_ARRAY_BUFFER, bufferElements*4*sizeof(unsigned char), batch.vertexBuffer[i].textureSlots, GL_DYNAMIC_DRAW);
+            glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXTURESLOT);
+            glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXTURESLOT, 1, GL_UNSIGNED_BYTE, GL_FALSE, 0, 0);
+
+        }
 
         // Fill index buffer
         glGenBuffers(1, &batch.vertexBuffer[i].vboId[4]);
@@ -2822,7 +3193,8 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
 #endif
     }
 
-    TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
+    if (mapped) TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers mapped successfully, interleaved ring of %i buffers", numBuffers);
+    else TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
 
     // Unbind the current VAO
     if (RLGL.ExtSupported.vao) glBindVertexArray(0);
@@ -2840,6 +3212,8 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         //batch.draws[i].vaoId = 0;
         //batch.draws[i].shaderId = 0;
         batch.draws[i].textureId = RLGL.State.defaultTextureId;
+        batch.draws[i].textureCount = 1;
+        batch.draws[i].textures[0] = RLGL.State.defaultTextureId;
         //batch.draws[i].RLGL.State.projection = rlMatrixIdentity();
         //batch.draws[i].RLGL.State.modelview = rlMatrixIdentity();
     }
@@ -2872,15 +3246,29 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+            glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXTURESLOT);
             glBindVertexArray(0);
         }
 
+#if defined(GRAPHICS_API_OPENGL_33)
+        // Unmap persistently mapped vertex data, GPU could still be using it
+        if (batch.vertexBuffer[i].fence != NULL) glDeleteSync((GLsync)batch.vertexBuffer[i].fence);
+        if (batch.vertexBuffer[i].mapped)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, batch.vertexBuffer[i].vboId[0]);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            batch.vertexBuffer[i].interleaved = NULL;
+        }
+#endif
+
         // Delete VBOs from GPU (VRAM)
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[0]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[1]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[2]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[3]);
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[4]);
+        glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[5]);
 
         // Delete VAOs from GPU (VRAM)
         if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
@@ -2891,6 +3279,8 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         RL_FREE(batch.vertexBuffer[i].normals);
         RL_FREE(batch.vertexBuffer[i].colors);
         RL_FREE(batch.vertexBuffer[i].indices);
+        RL_FREE(batch.vertexBuffer[i].textureSlots);
+        RL_FREE(batch.vertexBuffer[i].interleaved);
     }
 
     // Unload arrays
@@ -2913,25 +3303,41 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         // Activate elements VAO
         if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
 
-        // Vertex positions buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
-
-        // Texture coordinates buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
-
-        // Normals buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].normals);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].normals, GL_DYNAMIC_DRAW); // Update all buffer
-
-        // Colors buffer
-        glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
-        //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+        if (batch->vertexBuffer[batch->currentBuffer].interleaved != NULL)
+        {
+            // Interleaved vertex buffer, mapped vertex data is written directly by rlVertex3f(), no upload required
+            if (!batch->vertexBuffer[batch->currentBuffer].mapped)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+                glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*sizeof(rlBatchVertex), batch->vertexBuffer[batch->currentBuffer].interleaved);
+            }
+        }
+        else
+        {
+            // Vertex positions buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].vertices);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].vertices, GL_DYNAMIC_DRAW);  // Update all buffer
+
+            // Texture coordinates buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*2*sizeof(float), batch->vertexBuffer[batch->currentBuffer].texcoords);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*2*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].texcoords, GL_DYNAMIC_DRAW); // Update all buffer
+
+            // Normals buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*3*sizeof(float), batch->vertexBuffer[batch->currentBuffer].normals);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*3*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].normals, GL_DYNAMIC_DRAW); // Update all buffer
+
+            // Colors buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*4*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].colors);
+            //glBufferData(GL_ARRAY_BUFFER, sizeof(float)*4*4*batch->vertexBuffer[batch->currentBuffer].elementCount, batch->vertexBuffer[batch->currentBuffer].colors, GL_DYNAMIC_DRAW);    // Update all buffer
+
+            // Texture slots buffer
+            glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[5]);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, RLGL.State.vertexCounter*sizeof(unsigned char), batch->vertexBuffer[batch->currentBuffer].textureSlots);
+        }
 
         // NOTE: glMapBuffer() causes sync issue
         // If GPU is working with this buffer, glMapBuffer() will wait(stall) until GPU to finish its job
@@ -3010,25 +3416,39 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
             else
             {
-                // Bind vertex attrib: position (shader-location = 0)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
-
-                // Bind vertex attrib: texcoord (shader-location = 1)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
-
-                // Bind vertex attrib: normal (shader-location = 2)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
-
-                // Bind vertex attrib: color (shader-location = 3)
-                glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
-                glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
-                glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+                if (batch->vertexBuffer[batch->currentBuffer].interleaved != NULL)
+                {
+                    // Bind vertex attribs: position, texcoord, normal, color and texture slot (shader-location = 0, 1, 2, 3, 6)
+                    glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+                    rlSetBatchVertexAttribs();
+                }
+                else
+                {
+                    // Bind vertex attrib: position (shader-location = 0)
+                    glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
+                    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, 0, 0);
+                    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+
+                    // Bind vertex attrib: texcoord (shader-location = 1)
+                    glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[1]);
+                    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, 0, 0);
+                    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+
+                    // Bind vertex attrib: normal (shader-location = 2)
+                    glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[2]);
+                    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, 0, 0);
+                    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
+
+                    // Bind vertex attrib: color (shader-location = 3)
+                    glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[3]);
+                    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, 0);
+                    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+
+                    // Bind vertex attrib: texture slot (shader-location = 6)
+                    glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[5]);
+                    glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXTURESLOT, 1, GL_UNSIGNED_BYTE, GL_FALSE, 0, 0);
+                    glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXTURESLOT);
+                }
 
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[4]);
             }
@@ -3052,10 +3472,27 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
             glActiveTexture(GL_TEXTURE0);
 
+            RLGL.State.batchStats.flushes++;
+
             for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
             {
-                // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                if (batch->draws[i].textureCount > 1)
+                {
+                    // Bind all draw call textures to their texture slots, default shader selects them by vertex
+                    // NOTE: Texture slots are bound in reverse order to finish with GL_TEXTURE0 active
+                    for (int j = batch->draws[i].textureCount - 1; j >= 0; j--)
+                    {
+                        glActiveTexture(GL_TEXTURE0 + j);
+                        glBindTexture(GL_TEXTURE_2D, batch->draws[i].textures[j]);
+                    }
+                }
+                else
+                {
+                    // Bind current draw call texture, activated as GL_TEXTURE0 and Bound to sampler2D texture0 by default
+                    glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                }
+
+                RLGL.State.batchStats.drawCalls++;
 
                 if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
                 else
@@ -3076,6 +3513,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
             if (!RLGL.ExtSupported.vao)
             {
+                glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXTURESLOT);
                 glBindBuffer(GL_ARRAY_BUFFER, 0);
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             }
@@ -3090,6 +3528,14 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
     // Restore viewport to default measures
     if (eyeCount == 2) rlViewport(0, 0, RLGL.State.framebufferWidth, RLGL.State.framebufferHeight);
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Fence mapped vertex data, buffer can not be written again until GPU finished reading it
+    if (batch->vertexBuffer[batch->currentBuffer].mapped && (RLGL.State.vertexCounter > 0))
+    {
+        batch->vertexBuffer[batch->currentBuffer].fence = (void *)glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+#endif
     //------------------------------------------------------------------------------------------------------------
 
     // Reset batch buffers
@@ -3110,8 +3556,13 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         batch->draws[i].mode = RL_QUADS;
         batch->draws[i].vertexCount = 0;
         batch->draws[i].textureId = RLGL.State.defaultTextureId;
+        batch->draws[i].textureCount = 1;
+        batch->draws[i].textures[0] = RLGL.State.defaultTextureId;
     }
 
+    // Reset texture slot for next vertex
+    RLGL.State.textureSlot = 0;
+
     // Reset active texture units for next batch
     for (int i = 0; i < RL_DEFAULT_BATCH_MAX_TEXTURE_UNITS; i++) RLGL.State.activeTextureId[i] = 0;
 
@@ -3122,6 +3573,25 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     // Change to next buffer in the list (in case of multi-buffering)
     batch->currentBuffer++;
     if (batch->currentBuffer >= batch->bufferCount) batch->currentBuffer = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33)
+    // Wait for GPU to finish reading next mapped buffer before writing new vertex data on it
+    // NOTE: Buffers ring (RL_DEFAULT_BATCH_MAPPED_BUFFERS) should keep GPU far enough to not wait
+    if (batch->vertexBuffer[batch->currentBuffer].fence != NULL)
+    {
+        GLsync fence = (GLsync)batch->vertexBuffer[batch->currentBuffer].fence;
+        GLenum result = glClientWaitSync(fence, 0, 0);
+
+        if (result == GL_TIMEOUT_EXPIRED)
+        {
+            RLGL.State.batchStats.bufferWaits++;
+            while (result == GL_TIMEOUT_EXPIRED) result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);  // 1 ms timeout
+        }
+
+        glDeleteSync(fence);
+        batch->vertexBuffer[batch->currentBuffer].fence = NULL;
+    }
+#endif
 #endif
 }
 
@@ -3165,12 +3635,68 @@ bool rlCheckRenderBatchLimit(int vCount)
         // Restore state of last batch so we can continue adding vertices
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].mode = currentMode;
         RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textureId = currentTexture;
+        RLGL.currentBatch->draws[RLGL.currentBatch->drawCounter - 1].textures[0] = currentTexture;
     }
 #endif
 
     return overflow;
 }
 
+// Enable texture slots batching
+// NOTE: Default shader samples the texture selected by vertex slot, so texture
+// changes on the batch do not require a new draw call while slots are available
+void rlEnableTextureSlots(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (!RLGL.State.textureSlotsEnabled)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.textureSlotsEnabled = true;
+    }
+#endif
+}
+
+// Disable texture slots batching
+void rlDisableTextureSlots(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if (RLGL.State.textureSlotsEnabled)
+    {
+        rlDrawRenderBatch(RLGL.currentBatch);
+        RLGL.State.textureSlotsEnabled = false;
+    }
+#endif
+}
+
+// Check if texture slots batching is enabled and supported
+bool rlIsTextureSlotsEnabled(void)
+{
+    bool result = false;
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    result = RLGL.State.textureSlotsEnabled && (RLGL.State.textureSlotCount > 1);
+#endif
+    return result;
+}
+
+// Get render batch statistics
+rlBatchStats rlGetRenderBatchStats(void)
+{
+    rlBatchStats stats = { 0 };
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    stats = RLGL.State.batchStats;
+#endif
+    return stats;
+}
+
+// Reset render batch statistics
+void rlResetRenderBatchStats(void)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    rlBatchStats stats = { 0 };
+    RLGL.State.batchStats = stats;
+#endif
+}
+
 // Textures data management
 //-----------------------------------------------------------------------------------------
 // Convert image data to OpenGL texture (returns OpenGL valid Id)
@@ -3700,6 +4226,141 @@ unsigned char *rlReadScreenPixels(int width, int height)
     return imgData;     // NOTE: image data should be freed
 }
 
+// Load pixel pack buffer to read screen pixels asynchronously
+// NOTE: Returns 0 if not supported (OpenGL 1.1, OpenGL ES 2.0), rlReadScreenPixels() must be used instead
+unsigned int rlLoadReadbackBuffer(int width, int height)
+{
+    unsigned int id = 0;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glBufferData(GL_PIXEL_PACK_BUFFER, width*height*4, NULL, GL_STREAM_READ);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+
+    return id;
+}
+
+// Request screen pixel data (color buffer) into readback buffer
+// NOTE: glReadPixels() returns immediately when a pixel pack buffer is bound, copy is done by the GPU
+// once previous commands complete, data should be retrieved some frames later to avoid stalling
+void rlReadScreenPixelsAsync(unsigned int id, int width, int height)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+}
+
+// Get requested screen pixel data from readback buffer, flipped vertically
+// NOTE: Alpha channel is copied as is, if the request has not been completed yet by the GPU, it waits (stall)
+bool rlGetReadbackBufferPixels(unsigned int id, int width, int height, unsigned char *pixels)
+{
+    bool result = false;
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, id);
+
+#if defined(GRAPHICS_API_OPENGL_ES3)
+    const unsigned char *data = (const unsigned char *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, width*height*4, GL_MAP_READ_BIT);
+#else
+    const unsigned char *data = (const unsigned char *)glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+#endif
+
+    if (data != NULL)
+    {
+        // NOTE: glReadPixels() returns image flipped vertically -> (0,0) is the bottom left corner of the framebuffer
+        for (int y = 0; y < height; y++) memcpy(pixels + (height - 1 - y)*width*4, data + y*width*4, width*4);
+
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        result = true;
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+#endif
+
+    return result;
+}
+
+// Unload readback buffer
+void rlUnloadReadbackBuffer(unsigned int id)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES3)
+    glDeleteBuffers(1, &id);
+#endif
+}
+
+// Commands recording
+//-----------------------------------------------------------------------------------------
+// Get commands statistics recorded
+rlCommandStats rlGetCommandStats(void)
+{
+    rlCommandStats stats = { 0 };
+
+#if defined(GRAPHICS_API_NULL)
+    stats = RLNULL.stats;
+#endif
+
+    return stats;
+}
+
+// Reset commands statistics
+// NOTE: Loaded objects count and memory are kept
+void rlResetCommandStats(void)
+{
+#if defined(GRAPHICS_API_NULL)
+    rlCommandStats stats = { 0 };
+
+    stats.textureCount = RLNULL.stats.textureCount;
+    stats.bufferCount = RLNULL.stats.bufferCount;
+    stats.shaderCount = RLNULL.stats.shaderCount;
+    stats.textureMemory = RLNULL.stats.textureMemory;
+    stats.bufferMemory = RLNULL.stats.bufferMemory;
+
+    RLNULL.stats = stats;
+#endif
+}
+
+// Enable commands log recording
+void rlEnableCommandLog(void)
+{
+#if defined(GRAPHICS_API_NULL)
+    RLNULL.logEnabled = true;
+#endif
+}
+
+// Disable commands log recording
+void rlDisableCommandLog(void)
+{
+#if defined(GRAPHICS_API_NULL)
+    RLNULL.logEnabled = false;
+#endif
+}
+
+// Get commands log recorded
+// NOTE: Returned string is owned by rlgl, it is valid until log is cleared or a new command is recorded
+const char *rlGetCommandLog(void)
+{
+#if defined(GRAPHICS_API_NULL)
+    if (RLNULL.log != NULL) return RLNULL.log;
+#endif
+
+    return "";
+}
+
+// Clear commands log recorded
+void rlClearCommandLog(void)
+{
+#if defined(GRAPHICS_API_NULL)
+    RL_FREE(RLNULL.log);
+    RLNULL.log = NULL;
+    RLNULL.logSize = 0;
+    RLNULL.logCapacity = 0;
+#endif
+}
+
 // Framebuffer management (fbo)
 //-----------------------------------------------------------------------------------------
 // Load a framebuffer to be used for rendering
@@ -3901,6 +4562,17 @@ void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSiz
 #endif
 }
 
+// Orphan vertex buffer object data storage
+// NOTE: Previous data is discarded and new storage of same size is provided, GPU can keep
+// using previous storage while new data is uploaded (no sync), size must be provided in bytes
+void rlOrphanVertexBuffer(unsigned int id, int size, bool dynamic)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    glBindBuffer(GL_ARRAY_BUFFER, id);
+    glBufferData(GL_ARRAY_BUFFER, size, NULL, dynamic? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+#endif
+}
+
 // Enable vertex array object (VAO)
 bool rlEnableVertexArray(unsigned int vaoId)
 {
@@ -4216,6 +4888,7 @@ unsigned int rlLoadShaderProgram(unsigned int vShaderId, unsigned int fShaderId)
     glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
     glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, RL_DEFAULT_SHADER_ATTRIB_NAME_TANGENT);
     glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD2);
+    glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXTURESLOT, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXTURESLOT);
 
 #ifdef RL_SUPPORT_MESH_GPU_SKINNING
     glBindAttribLocation(program, RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS, RL_DEFAULT_SHADER_ATTRIB_NAME_BONEIDS);
@@ -4843,6 +5516,45 @@ const char *rlGetPixelFormatName(unsigned int format)
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Set render batch interleaved vertex attributes (rlBatchVertex), vertex buffer must be bound
+// NOTE: Vertex attributes locations are the default shader ones (texture slot fixed location)
+static void rlSetBatchVertexAttribs(void)
+{
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)0);
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_POSITION]);
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01], 2, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)(3*sizeof(float)));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01]);
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL], 3, GL_FLOAT, 0, sizeof(rlBatchVertex), (void *)(5*sizeof(float)));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_NORMAL]);
+    glVertexAttribPointer(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR], 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(rlBatchVertex), (void *)(8*sizeof(float)));
+    glEnableVertexAttribArray(RLGL.State.currentShaderLocs[RL_SHADER_LOC_VERTEX_COLOR]);
+    glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXTURESLOT, 1, GL_UNSIGNED_BYTE, GL_FALSE, sizeof(rlBatchVertex), (void *)(8*sizeof(float) + 4));
+    glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXTURESLOT);
+}
+
+// Default shader texture slots sampling code, sampler2D texture0..texture7 selected by vertex texture slot
+// NOTE: Samplers can only be indexed by constant expressions on GLSL 100/120/330, so an if/else chain is used
+#define RL_DEFAULT_SHADER_TEXTURE_SLOTS_CODE(sample) \
+    "uniform sampler2D texture0;        \n" \
+    "uniform sampler2D texture1;        \n" \
+    "uniform sampler2D texture2;        \n" \
+    "uniform sampler2D texture3;        \n" \
+    "uniform sampler2D texture4;        \n" \
+    "uniform sampler2D texture5;        \n" \
+    "uniform sampler2D texture6;        \n" \
+    "uniform sampler2D texture7;        \n" \
+    "vec4 textureSlot(float slot, vec2 texCoord) \n" \
+    "{                                  \n" \
+    "    if (slot < 0.5) return " sample "(texture0, texCoord); \n" \
+    "    else if (slot < 1.5) return " sample "(texture1, texCoord); \n" \
+    "    else if (slot < 2.5) return " sample "(texture2, texCoord); \n" \
+    "    else if (slot < 3.5) return " sample "(texture3, texCoord); \n" \
+    "    else if (slot < 4.5) return " sample "(texture4, texCoord); \n" \
+    "    else if (slot < 5.5) return " sample "(texture5, texCoord); \n" \
+    "    else if (slot < 6.5) return " sample "(texture6, texCoord); \n" \
+    "    else return " sample "(texture7, texCoord); \n" \
+    "}                                  \n"
+
 // Load default shader (just vertex positioning and texture coloring)
 // NOTE: This shader program is used for internal buffers
 // NOTE: Loaded: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
@@ -4860,15 +5572,19 @@ static void rlLoadShaderDefault(void)
     "attribute vec3 vertexPosition;     \n"
     "attribute vec2 vertexTexCoord;     \n"
     "attribute vec4 vertexColor;        \n"
+    "attribute float vertexTextureSlot; \n"
     "varying vec2 fragTexCoord;         \n"
     "varying vec4 fragColor;            \n"
+    "varying float fragTextureSlot;     \n"
 #elif defined(GRAPHICS_API_OPENGL_33)
     "#version 330                       \n"
     "in vec3 vertexPosition;            \n"
     "in vec2 vertexTexCoord;            \n"
     "in vec4 vertexColor;               \n"
+    "in float vertexTextureSlot;        \n"
     "out vec2 fragTexCoord;             \n"
     "out vec4 fragColor;                \n"
+    "out float fragTextureSlot;         \n"
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_ES3)
@@ -4877,16 +5593,20 @@ static void rlLoadShaderDefault(void)
     "in vec3 vertexPosition;            \n"
     "in vec2 vertexTexCoord;            \n"
     "in vec4 vertexColor;               \n"
+    "in float vertexTextureSlot;        \n"
     "out vec2 fragTexCoord;             \n"
     "out vec4 fragColor;                \n"
+    "out float fragTextureSlot;         \n"
 #elif defined(GRAPHICS_API_OPENGL_ES2)
     "#version 100                       \n"
     "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL) (on some browsers)
     "attribute vec3 vertexPosition;     \n"
     "attribute vec2 vertexTexCoord;     \n"
     "attribute vec4 vertexColor;        \n"
+    "attribute float vertexTextureSlot; \n"
     "varying vec2 fragTexCoord;         \n"
     "varying vec4 fragColor;            \n"
+    "varying float fragTextureSlot;     \n"
 #endif
 
     "uniform mat4 mvp;                  \n"
@@ -4894,6 +5614,7 @@ static void rlLoadShaderDefault(void)
     "{                                  \n"
     "    fragTexCoord = vertexTexCoord; \n"
     "    fragColor = vertexColor;       \n"
+    "    fragTextureSlot = vertexTextureSlot; \n"
     "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
     "}                                  \n";
 
@@ -4951,26 +5672,97 @@ static void rlLoadShaderDefault(void)
     "}                                  \n";
 #endif
 
-    // NOTE: Compiled vertex/fragment shaders are not deleted,
-    // they are kept for re-use as default shaders in case some shader loading fails
-    RLGL.State.defaultVShaderId = rlCompileShader(defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
-    RLGL.State.defaultFShaderId = rlCompileShader(defaultFShaderCode, GL_FRAGMENT_SHADER);   // Compile default fragment shader
-
-    RLGL.State.defaultShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultFShaderId);
-
-    if (RLGL.State.defaultShaderId > 0)
-    {
-        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader loaded successfully", RLGL.State.defaultShaderId);
-
-        // Set default shader locations: attributes locations
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
-        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
+    // Fragment shader with texture slots, used by default shader program for batch drawing
+    const char *defaultSlotsFShaderCode =
+#if defined(GRAPHICS_API_OPENGL_21)
+    "#version 120                       \n"
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTextureSlot;     \n"
+    "uniform vec4 colDiffuse;           \n"
+    RL_DEFAULT_SHADER_TEXTURE_SLOTS_CODE("texture2D")
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = textureSlot(fragTextureSlot, fragTexCoord); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_33)
+    "#version 330       \n"
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "in float fragTextureSlot;          \n"
+    "out vec4 finalColor;               \n"
+    "uniform vec4 colDiffuse;           \n"
+    RL_DEFAULT_SHADER_TEXTURE_SLOTS_CODE("texture")
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = textureSlot(fragTextureSlot, fragTexCoord); \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
+#endif
+
+#if defined(GRAPHICS_API_OPENGL_ES3)
+    "#version 300 es                    \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES3 (WebGL 2)
+    "in vec2 fragTexCoord;              \n"
+    "in vec4 fragColor;                 \n"
+    "in float fragTextureSlot;          \n"
+    "out vec4 finalColor;               \n"
+    "uniform vec4 colDiffuse;           \n"
+    RL_DEFAULT_SHADER_TEXTURE_SLOTS_CODE("texture")
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = textureSlot(fragTextureSlot, fragTexCoord); \n"
+    "    finalColor = texelColor*colDiffuse*fragColor;        \n"
+    "}                                  \n";
+#elif defined(GRAPHICS_API_OPENGL_ES2)
+    "#version 100                       \n"
+    "precision mediump float;           \n"     // Precision required for OpenGL ES2 (WebGL)
+    "varying vec2 fragTexCoord;         \n"
+    "varying vec4 fragColor;            \n"
+    "varying float fragTextureSlot;     \n"
+    "uniform vec4 colDiffuse;           \n"
+    RL_DEFAULT_SHADER_TEXTURE_SLOTS_CODE("texture2D")
+    "void main()                        \n"
+    "{                                  \n"
+    "    vec4 texelColor = textureSlot(fragTextureSlot, fragTexCoord); \n"
+    "    gl_FragColor = texelColor*colDiffuse*fragColor;      \n"
+    "}                                  \n";
+#endif
+
+    // NOTE: Compiled vertex/fragment shaders are not deleted,
+    // they are kept for re-use as default shaders in case some shader loading fails
+    RLGL.State.defaultVShaderId = rlCompileShader(defaultVShaderCode, GL_VERTEX_SHADER);     // Compile default vertex shader
+    RLGL.State.defaultFShaderId = rlCompileShader(defaultFShaderCode, GL_FRAGMENT_SHADER);   // Compile default fragment shader
+    RLGL.State.defaultSlotsFShaderId = rlCompileShader(defaultSlotsFShaderCode, GL_FRAGMENT_SHADER); // Compile default fragment shader with texture slots
+
+    // NOTE: Default vertex shader outputs texture slot, not required by default fragment shader,
+    // default fragment shader is kept without texture slots to link with any custom vertex shader
+    RLGL.State.defaultShaderId = rlLoadShaderProgram(RLGL.State.defaultVShaderId, RLGL.State.defaultSlotsFShaderId);
+
+    if (RLGL.State.defaultShaderId > 0)
+    {
+        TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Default shader loaded successfully", RLGL.State.defaultShaderId);
+
+        // Set default shader locations: attributes locations
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_POSITION] = glGetAttribLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_POSITION);
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_TEXCOORD01] = glGetAttribLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_TEXCOORD);
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_VERTEX_COLOR] = glGetAttribLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_ATTRIB_NAME_COLOR);
 
         // Set default shader locations: uniform locations
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MATRIX_MVP] = glGetUniformLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);
+
+        // Set default shader texture slots samplers: textureN sampled from texture unit N
+        char samplerName[9] = "texture0";
+        glUseProgram(RLGL.State.defaultShaderId);
+        for (int i = 1; i < 8; i++)
+        {
+            samplerName[7] = (char)('0' + i);
+            glUniform1i(glGetUniformLocation(RLGL.State.defaultShaderId, samplerName), i);
+        }
+        glUseProgram(0);
     }
     else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", RLGL.State.defaultShaderId);
 }
@@ -4982,9 +5774,10 @@ static void rlUnloadShaderDefault(void)
     glUseProgram(0);
 
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
-    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
+    glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultSlotsFShaderId);
     glDeleteShader(RLGL.State.defaultVShaderId);
     glDeleteShader(RLGL.State.defaultFShaderId);
+    glDeleteShader(RLGL.State.defaultSlotsFShaderId);
 
     glDeleteProgram(RLGL.State.defaultShaderId);
 
@@ -5071,6 +5864,1099 @@ static const char *rlGetCompressedFormatName(int format)
 
 #endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
 
+#if defined(GRAPHICS_API_NULL)
+// Null graphics device: OpenGL commands recording
+// NOTE: Null device replaces OpenGL 3.3 Core functions loaded by glad, commands are not executed
+// but recorded: objects bookkeeping (textures, buffers, shaders...) and statistics are kept
+
+// Record command, added to commands log if enabled
+static void rlNullLog(const char *format, ...)
+{
+    RLNULL.stats.commands++;
+
+    if (!RLNULL.logEnabled) return;
+
+    char command[256] = { 0 };
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(command, sizeof(command) - 1, format, args);
+    va_end(args);
+
+    if (length < 0) return;
+    if (length > (int)sizeof(command) - 2) length = (int)sizeof(command) - 2;
+    command[length++] = '\n';
+
+    if ((RLNULL.logSize + length + 1) > RLNULL.logCapacity)
+    {
+        unsigned int capacity = (RLNULL.logCapacity > 0)? RLNULL.logCapacity*2 : 4096;
+        while (capacity < (RLNULL.logSize + length + 1)) capacity *= 2;
+
+        char *log = (char *)RL_REALLOC(RLNULL.log, capacity);
+        if (log == NULL) return;
+
+        RLNULL.log = log;
+        RLNULL.logCapacity = capacity;
+    }
+
+    memcpy(RLNULL.log + RLNULL.logSize, command, length);
+    RLNULL.logSize += length;
+    RLNULL.log[RLNULL.logSize] = '\0';
+}
+
+// Create object of provided type, returns object id
+// NOTE: Ids of deleted objects are reused, like OpenGL does
+static unsigned int rlNullCreateObject(int type)
+{
+    unsigned int id = 0;
+
+    if (RLNULL.freeIdCount > 0) id = RLNULL.freeIds[--RLNULL.freeIdCount];
+    else
+    {
+        if (RLNULL.objectCount == 0) RLNULL.objectCount = 1;    // Id 0 is never used
+
+        if (RLNULL.objectCount >= RLNULL.objectCapacity)
+        {
+            unsigned int capacity = (RLNULL.objectCapacity > 0)? RLNULL.objectCapacity*2 : 256;
+            rlNullObject *objects = (rlNullObject *)RL_REALLOC(RLNULL.objects, capacity*sizeof(rlNullObject));
+            unsigned int *freeIds = (unsigned int *)RL_REALLOC(RLNULL.freeIds, capacity*sizeof(unsigned int));
+
+            if (objects != NULL) RLNULL.objects = objects;
+            if (freeIds != NULL) RLNULL.freeIds = freeIds;
+            if ((objects == NULL) || (freeIds == NULL)) return 0;
+
+            memset(RLNULL.objects + RLNULL.objectCapacity, 0, (capacity - RLNULL.objectCapacity)*sizeof(rlNullObject));
+            RLNULL.objectCapacity = capacity;
+        }
+
+        id = RLNULL.objectCount++;
+    }
+
+    RLNULL.objects[id].type = type;
+
+    if (type == RL_NULL_TEXTURE) RLNULL.stats.textureCount++;
+    else if (type == RL_NULL_BUFFER) RLNULL.stats.bufferCount++;
+    else if (type == RL_NULL_PROGRAM) RLNULL.stats.shaderCount++;
+
+    return id;
+}
+
+// Get object by id, NULL if id is not an object of provided type
+static rlNullObject *rlNullGetObject(unsigned int id, int type)
+{
+    if ((id > 0) && (id < RLNULL.objectCount) && (RLNULL.objects[id].type == type)) return &RLNULL.objects[id];
+
+    return NULL;
+}
+
+// Delete object, it is unbound if currently bound
+static void rlNullDeleteObject(unsigned int id, int type)
+{
+    rlNullObject *object = rlNullGetObject(id, type);
+    if (object == NULL) return;
+
+    switch (type)
+    {
+        case RL_NULL_TEXTURE:
+        {
+            RLNULL.stats.textureCount--;
+            RLNULL.stats.textureMemory -= object->size;
+            for (int i = 0; i < RL_NULL_MAX_TEXTURE_UNITS; i++) if (RLNULL.textures[i] == id) RLNULL.textures[i] = 0;
+        } break;
+        case RL_NULL_RENDERBUFFER:
+        {
+            RLNULL.stats.textureMemory -= object->size;
+            if (RLNULL.renderbuffer == id) RLNULL.renderbuffer = 0;
+        } break;
+        case RL_NULL_BUFFER:
+        {
+            RLNULL.stats.bufferCount--;
+            RLNULL.stats.bufferMemory -= object->size;
+            for (int i = 0; i < RL_NULL_BUFFER_TARGETS; i++) if (RLNULL.buffers[i] == id) RLNULL.buffers[i] = 0;
+        } break;
+        case RL_NULL_VERTEX_ARRAY: if (RLNULL.vertexArray == id) RLNULL.vertexArray = 0; break;
+        case RL_NULL_FRAMEBUFFER: if (RLNULL.framebuffer == id) RLNULL.framebuffer = 0; break;
+        case RL_NULL_PROGRAM: RLNULL.stats.shaderCount--; break;
+        default: break;
+    }
+
+    RL_FREE(object->storage);
+    RL_FREE(object->variables);
+    memset(object, 0, sizeof(rlNullObject));
+
+    RLNULL.freeIds[RLNULL.freeIdCount++] = id;
+}
+
+// Get pixel size in bytes for provided pixel data format and type
+static unsigned int rlNullPixelSize(GLenum format, GLenum type)
+{
+    unsigned int components = 4;
+
+    switch (format)
+    {
+        case GL_RED:
+        case GL_ALPHA:
+        case GL_DEPTH_COMPONENT: components = 1; break;
+        case GL_RG: components = 2; break;
+        case GL_RGB: components = 3; break;
+        default: break;
+    }
+
+    switch (type)
+    {
+        case GL_UNSIGNED_SHORT_5_6_5:
+        case GL_UNSIGNED_SHORT_4_4_4_4:
+        case GL_UNSIGNED_SHORT_5_5_5_1: return 2;
+        case GL_UNSIGNED_SHORT:
+        case GL_SHORT:
+        case GL_HALF_FLOAT: return components*2;
+        case GL_UNSIGNED_INT:
+        case GL_INT:
+        case GL_FLOAT: return components*4;
+        default: break;
+    }
+
+    return components;
+}
+
+// Get buffer binding index for provided buffer target
+static int rlNullBufferTarget(GLenum target)
+{
+    switch (target)
+    {
+        case GL_ARRAY_BUFFER: return 0;
+        case GL_ELEMENT_ARRAY_BUFFER: return 1;
+        case GL_PIXEL_PACK_BUFFER: return 2;
+        case GL_PIXEL_UNPACK_BUFFER: return 3;
+        case GL_UNIFORM_BUFFER: return 4;
+        default: break;
+    }
+
+    return 5;
+}
+
+// Find shader/program variable by name, NULL if not found
+static rlNullVariable *rlNullFindVariable(rlNullObject *object, const char *name, bool uniform)
+{
+    for (int i = 0; i < object->variableCount; i++)
+    {
+        if ((object->variables[i].uniform == uniform) && (strcmp(object->variables[i].name, name) == 0)) return &object->variables[i];
+    }
+
+    return NULL;
+}
+
+// Add shader/program variable
+static rlNullVariable *rlNullAddVariable(rlNullObject *object, const char *name, bool uniform, int location)
+{
+    rlNullVariable *variables = (rlNullVariable *)RL_REALLOC(object->variables, (object->variableCount + 1)*sizeof(rlNullVariable));
+    if (variables == NULL) return NULL;
+
+    object->variables = variables;
+
+    rlNullVariable *variable = &object->variables[object->variableCount++];
+    memset(variable, 0, sizeof(rlNullVariable));
+    strncpy(variable->name, name, sizeof(variable->name) - 1);
+    variable->uniform = uniform;
+    variable->location = location;
+
+    return variable;
+}
+
+// Parse shader code to get the attributes and uniforms declared
+// NOTE: Only global declarations are considered (uniform blocks are skipped), comments and preprocessor lines are ignored
+static void rlNullParseShaderVariables(rlNullObject *shader, const char *code)
+{
+    const char *ptr = code;
+    char name[64] = { 0 };          // Last identifier of current declaration (variable name)
+    int depth = 0;                  // Braces depth, only global scope is parsed
+    int nesting = 0;                // Parentheses and brackets depth, i.e. layout() or array size
+    bool uniform = false;           // Current statement declares uniforms
+    bool attribute = false;         // Current statement declares vertex attributes
+    bool initializer = false;       // Parsing variable initializer
+
+    while (*ptr != '\0')
+    {
+        if ((ptr[0] == '/') && (ptr[1] == '/')) { while ((*ptr != '\0') && (*ptr != '\n')) ptr++; continue; }
+        if ((ptr[0] == '/') && (ptr[1] == '*'))
+        {
+            ptr += 2;
+            while ((*ptr != '\0') && !((ptr[0] == '*') && (ptr[1] == '/'))) ptr++;
+            if (*ptr != '\0') ptr += 2;
+            continue;
+        }
+        if (*ptr == '#') { while ((*ptr != '\0') && (*ptr != '\n')) ptr++; continue; }
+
+        if (((*ptr >= 'a') && (*ptr <= 'z')) || ((*ptr >= 'A') && (*ptr <= 'Z')) || (*ptr == '_'))
+        {
+            char token[64] = { 0 };
+            int length = 0;
+
+            while (((*ptr >= 'a') && (*ptr <= 'z')) || ((*ptr >= 'A') && (*ptr <= 'Z')) || ((*ptr >= '0') && (*ptr <= '9')) || (*ptr == '_'))
+            {
+                if (length < (int)sizeof(token) - 1) token[length++] = *ptr;
+                ptr++;
+            }
+
+            if ((depth == 0) && (nesting == 0) && !initializer)
+            {
+                if (strcmp(token, "uniform") == 0) uniform = true;
+                else if ((strcmp(token, "attribute") == 0) || ((strcmp(token, "in") == 0) && (shader->shaderType == GL_VERTEX_SHADER))) attribute = true;
+                else strcpy(name, token);
+            }
+
+            continue;
+        }
+
+        switch (*ptr)
+        {
+            case '(': case '[': nesting++; break;
+            case ')': case ']': nesting--; break;
+            case '{': depth++; uniform = false; attribute = false; name[0] = '\0'; break;
+            case '}': depth--; uniform = false; attribute = false; name[0] = '\0'; break;
+            case '=':
+            case ',':
+            case ';':
+            {
+                if ((depth > 0) || (nesting > 0)) break;
+
+                if ((uniform || attribute) && (name[0] != '\0') && (rlNullFindVariable(shader, name, uniform) == NULL)) rlNullAddVariable(shader, name, uniform, -1);
+                name[0] = '\0';
+
+                initializer = (*ptr == '=');
+                if (*ptr == ';') { uniform = false; attribute = false; }
+            } break;
+            default: break;
+        }
+
+        ptr++;
+    }
+}
+
+// Null device OpenGL functions
+//----------------------------------------------------------------------------------
+static const GLubyte *GLAD_API_PTR rlNullGetString(GLenum name)
+{
+    switch (name)
+    {
+        case GL_VENDOR: return (const GLubyte *)"raylib";
+        case GL_RENDERER: return (const GLubyte *)"rlgl null device";
+        case GL_VERSION: return (const GLubyte *)"3.3.0 rlgl null device";
+        case GL_SHADING_LANGUAGE_VERSION: return (const GLubyte *)"3.30";
+        default: break;
+    }
+
+    return (const GLubyte *)"";
+}
+
+static const GLubyte *GLAD_API_PTR rlNullGetStringi(GLenum name, GLuint index)
+{
+    // NOTE: glad requires at least one extension available
+    if ((name == GL_EXTENSIONS) && (index == 0)) return (const GLubyte *)"GL_EXT_texture_filter_anisotropic";
+    if ((name == GL_EXTENSIONS) && (index == 1)) return (const GLubyte *)"GL_ARB_buffer_storage";
+
+    return NULL;
+}
+
+static void GLAD_API_PTR rlNullGetIntegerv(GLenum pname, GLint *data)
+{
+    switch (pname)
+    {
+        case GL_NUM_EXTENSIONS: data[0] = 2; break;
+        case GL_MAX_TEXTURE_SIZE:
+        case GL_MAX_CUBE_MAP_TEXTURE_SIZE: data[0] = 16384; break;
+        case GL_MAX_TEXTURE_IMAGE_UNITS: data[0] = RL_NULL_MAX_TEXTURE_UNITS; break;
+        case GL_MAX_VERTEX_ATTRIBS:
+        case GL_MAX_VERTEX_ATTRIB_BINDINGS: data[0] = 16; break;
+        case GL_MAX_UNIFORM_BLOCK_SIZE: data[0] = 65536; break;
+        case GL_MAX_DRAW_BUFFERS: data[0] = 8; break;
+        case GL_MAX_UNIFORM_LOCATIONS: data[0] = 1024; break;
+        case GL_DRAW_FRAMEBUFFER_BINDING: data[0] = (GLint)RLNULL.framebuffer; break;
+        case GL_VIEWPORT: for (int i = 0; i < 4; i++) data[i] = RLNULL.viewport[i]; break;
+        case GL_COMPRESSED_TEXTURE_FORMATS: break;      // No compressed formats reported
+        default: data[0] = 0; break;
+    }
+}
+
+static void GLAD_API_PTR rlNullGetFloatv(GLenum pname, GLfloat *data)
+{
+    switch (pname)
+    {
+        case GL_LINE_WIDTH: data[0] = RLNULL.lineWidth; break;
+        case GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT: data[0] = 16.0f; break;
+        default: data[0] = 0.0f; break;
+    }
+}
+
+static GLenum GLAD_API_PTR rlNullGetError(void) { return GL_NO_ERROR; }
+
+// State changes
+static void GLAD_API_PTR rlNullEnable(GLenum cap) { RLNULL.stats.stateChanges++; rlNullLog("glEnable(0x%04X)", cap); }
+static void GLAD_API_PTR rlNullDisable(GLenum cap) { RLNULL.stats.stateChanges++; rlNullLog("glDisable(0x%04X)", cap); }
+static void GLAD_API_PTR rlNullHint(GLenum target, GLenum mode) { RLNULL.stats.stateChanges++; rlNullLog("glHint(0x%04X, 0x%04X)", target, mode); }
+static void GLAD_API_PTR rlNullCullFace(GLenum mode) { RLNULL.stats.stateChanges++; rlNullLog("glCullFace(0x%04X)", mode); }
+static void GLAD_API_PTR rlNullFrontFace(GLenum mode) { RLNULL.stats.stateChanges++; rlNullLog("glFrontFace(0x%04X)", mode); }
+static void GLAD_API_PTR rlNullPolygonMode(GLenum face, GLenum mode) { RLNULL.stats.stateChanges++; rlNullLog("glPolygonMode(0x%04X, 0x%04X)", face, mode); }
+static void GLAD_API_PTR rlNullDepthFunc(GLenum func) { RLNULL.stats.stateChanges++; rlNullLog("glDepthFunc(0x%04X)", func); }
+static void GLAD_API_PTR rlNullDepthMask(GLboolean flag) { RLNULL.stats.stateChanges++; rlNullLog("glDepthMask(%i)", flag); }
+static void GLAD_API_PTR rlNullColorMask(GLboolean r, GLboolean g, GLboolean b, GLboolean a) { RLNULL.stats.stateChanges++; rlNullLog("glColorMask(%i, %i, %i, %i)", r, g, b, a); }
+static void GLAD_API_PTR rlNullBlendEquation(GLenum mode) { RLNULL.stats.stateChanges++; rlNullLog("glBlendEquation(0x%04X)", mode); }
+static void GLAD_API_PTR rlNullBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) { RLNULL.stats.stateChanges++; rlNullLog("glBlendEquationSeparate(0x%04X, 0x%04X)", modeRGB, modeAlpha); }
+static void GLAD_API_PTR rlNullBlendFunc(GLenum src, GLenum dst) { RLNULL.stats.stateChanges++; rlNullLog("glBlendFunc(0x%04X, 0x%04X)", src, dst); }
+static void GLAD_API_PTR rlNullBlendFuncSeparate(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) { RLNULL.stats.stateChanges++; rlNullLog("glBlendFuncSeparate(0x%04X, 0x%04X, 0x%04X, 0x%04X)", srcRGB, dstRGB, srcAlpha, dstAlpha); }
+static void GLAD_API_PTR rlNullLineWidth(GLfloat width) { RLNULL.stats.stateChanges++; RLNULL.lineWidth = width; rlNullLog("glLineWidth(%.2f)", width); }
+static void GLAD_API_PTR rlNullPixelStorei(GLenum pname, GLint param) { RLNULL.stats.stateChanges++; rlNullLog("glPixelStorei(0x%04X, %i)", pname, param); }
+static void GLAD_API_PTR rlNullScissor(GLint x, GLint y, GLsizei width, GLsizei height) { RLNULL.stats.stateChanges++; rlNullLog("glScissor(%i, %i, %i, %i)", x, y, width, height); }
+static void GLAD_API_PTR rlNullClearColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a) { RLNULL.stats.stateChanges++; rlNullLog("glClearColor(%.3f, %.3f, %.3f, %.3f)", r, g, b, a); }
+static void GLAD_API_PTR rlNullClearDepth(GLdouble depth) { RLNULL.stats.stateChanges++; rlNullLog("glClearDepth(%.3f)", depth); }
+static void GLAD_API_PTR rlNullClear(GLbitfield mask) { rlNullLog("glClear(0x%04X)", mask); }
+
+static void GLAD_API_PTR rlNullViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    RLNULL.stats.stateChanges++;
+    RLNULL.viewport[0] = x;
+    RLNULL.viewport[1] = y;
+    RLNULL.viewport[2] = width;
+    RLNULL.viewport[3] = height;
+    rlNullLog("glViewport(%i, %i, %i, %i)", x, y, width, height);
+}
+
+// Textures
+static void GLAD_API_PTR rlNullGenTextures(GLsizei n, GLuint *textures)
+{
+    for (int i = 0; i < n; i++) textures[i] = rlNullCreateObject(RL_NULL_TEXTURE);
+    rlNullLog("glGenTextures(%i) = %u", n, (n > 0)? textures[0] : 0);
+}
+
+static void GLAD_API_PTR rlNullDeleteTextures(GLsizei n, const GLuint *textures)
+{
+    for (int i = 0; i < n; i++) rlNullDeleteObject(textures[i], RL_NULL_TEXTURE);
+    rlNullLog("glDeleteTextures(%i, %u)", n, (n > 0)? textures[0] : 0);
+}
+
+static void GLAD_API_PTR rlNullActiveTexture(GLenum texture)
+{
+    RLNULL.stats.stateChanges++;
+    RLNULL.activeTexture = (int)(texture - GL_TEXTURE0)%RL_NULL_MAX_TEXTURE_UNITS;
+    rlNullLog("glActiveTexture(0x%04X)", texture);
+}
+
+static void GLAD_API_PTR rlNullBindTexture(GLenum target, GLuint texture)
+{
+    RLNULL.stats.stateChanges++;
+    RLNULL.textures[RLNULL.activeTexture] = texture;
+    rlNullLog("glBindTexture(0x%04X, %u)", target, texture);
+}
+
+static void GLAD_API_PTR rlNullTexParameteri(GLenum target, GLenum pname, GLint param) { RLNULL.stats.stateChanges++; rlNullLog("glTexParameteri(0x%04X, 0x%04X, %i)", target, pname, param); }
+static void GLAD_API_PTR rlNullTexParameteriv(GLenum target, GLenum pname, const GLint *params) { RLNULL.stats.stateChanges++; rlNullLog("glTexParameteriv(0x%04X, 0x%04X)", target, pname); }
+static void GLAD_API_PTR rlNullTexParameterf(GLenum target, GLenum pname, GLfloat param) { RLNULL.stats.stateChanges++; rlNullLog("glTexParameterf(0x%04X, 0x%04X, %.3f)", target, pname, param); }
+
+// Texture level memory is accumulated, level 0 of 2D textures redefines texture memory
+static void rlNullTextureImage(GLenum target, GLint level, int width, int height, unsigned int size, const void *pixels)
+{
+    rlNullObject *texture = rlNullGetObject(RLNULL.textures[RLNULL.activeTexture], RL_NULL_TEXTURE);
+
+    if (texture != NULL)
+    {
+        if ((target == GL_TEXTURE_2D) && (level == 0))
+        {
+            RLNULL.stats.textureMemory -= texture->size;
+            texture->size = 0;
+            texture->mipmaps = false;
+        }
+
+        if (level == 0)
+        {
+            texture->width = width;
+            texture->height = height;
+        }
+
+        texture->size += size;
+        RLNULL.stats.textureMemory += size;
+    }
+
+    if (pixels != NULL)
+    {
+        RLNULL.stats.textureUploads++;
+        RLNULL.stats.uploadBytes += size;
+    }
+}
+
+static void GLAD_API_PTR rlNullTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    rlNullTextureImage(target, level, width, height, width*height*rlNullPixelSize(format, type), pixels);
+    rlNullLog("glTexImage2D(0x%04X, %i, 0x%04X, %i, %i, 0x%04X, 0x%04X)", target, level, internalformat, width, height, format, type);
+}
+
+static void GLAD_API_PTR rlNullCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+    rlNullTextureImage(target, level, width, height, imageSize, data);
+    rlNullLog("glCompressedTexImage2D(0x%04X, %i, 0x%04X, %i, %i, %i)", target, level, internalformat, width, height, imageSize);
+}
+
+static void GLAD_API_PTR rlNullTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+    RLNULL.stats.textureUploads++;
+    RLNULL.stats.uploadBytes += width*height*rlNullPixelSize(format, type);
+    rlNullLog("glTexSubImage2D(0x%04X, %i, %i, %i, %i, %i, 0x%04X, 0x%04X)", target, level, xoffset, yoffset, width, height, format, type);
+}
+
+static void GLAD_API_PTR rlNullGenerateMipmap(GLenum target)
+{
+    rlNullObject *texture = rlNullGetObject(RLNULL.textures[RLNULL.activeTexture], RL_NULL_TEXTURE);
+
+    // Full mipmap chain requires 1/3 of base level memory
+    if ((texture != NULL) && !texture->mipmaps)
+    {
+        RLNULL.stats.textureMemory += texture->size/3;
+        texture->size += texture->size/3;
+        texture->mipmaps = true;
+    }
+
+    rlNullLog("glGenerateMipmap(0x%04X)", target);
+}
+
+static void GLAD_API_PTR rlNullGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels)
+{
+    rlNullObject *texture = rlNullGetObject(RLNULL.textures[RLNULL.activeTexture], RL_NULL_TEXTURE);
+
+    if (texture != NULL)
+    {
+        unsigned int size = texture->width*texture->height*rlNullPixelSize(format, type);
+        memset(pixels, 0, size);
+        RLNULL.stats.readbackBytes += size;
+    }
+
+    rlNullLog("glGetTexImage(0x%04X, %i, 0x%04X, 0x%04X)", target, level, format, type);
+}
+
+static void GLAD_API_PTR rlNullReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+    unsigned int size = width*height*rlNullPixelSize(format, type);
+
+    // NOTE: If a pixel pack buffer is bound, pixels is an offset into buffer
+    if (RLNULL.buffers[rlNullBufferTarget(GL_PIXEL_PACK_BUFFER)] == 0) memset(pixels, 0, size);
+    RLNULL.stats.readbackBytes += size;
+
+    rlNullLog("glReadPixels(%i, %i, %i, %i, 0x%04X, 0x%04X)", x, y, width, height, format, type);
+}
+
+// Buffers
+static void GLAD_API_PTR rlNullGenBuffers(GLsizei n, GLuint *buffers)
+{
+    for (int i = 0; i < n; i++) buffers[i] = rlNullCreateObject(RL_NULL_BUFFER);
+    rlNullLog("glGenBuffers(%i) = %u", n, (n > 0)? buffers[0] : 0);
+}
+
+static void GLAD_API_PTR rlNullDeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+    for (int i = 0; i < n; i++) rlNullDeleteObject(buffers[i], RL_NULL_BUFFER);
+    rlNullLog("glDeleteBuffers(%i, %u)", n, (n > 0)? buffers[0] : 0);
+}
+
+static void GLAD_API_PTR rlNullBindBuffer(GLenum target, GLuint buffer)
+{
+    RLNULL.stats.stateChanges++;
+    RLNULL.buffers[rlNullBufferTarget(target)] = buffer;
+
+    // Element buffer binding is part of vertex array state
+    rlNullObject *vertexArray = rlNullGetObject(RLNULL.vertexArray, RL_NULL_VERTEX_ARRAY);
+    if ((target == GL_ELEMENT_ARRAY_BUFFER) && (vertexArray != NULL)) vertexArray->elementBuffer = buffer;
+
+    rlNullLog("glBindBuffer(0x%04X, %u)", target, buffer);
+}
+
+static void GLAD_API_PTR rlNullBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+    rlNullObject *buffer = rlNullGetObject(RLNULL.buffers[rlNullBufferTarget(target)], RL_NULL_BUFFER);
+
+    if (buffer != NULL)
+    {
+        RLNULL.stats.bufferMemory += (unsigned long long)size - buffer->size;
+        if ((buffer->storage != NULL) && (buffer->size != (unsigned int)size))
+        {
+            RL_FREE(buffer->storage);
+            buffer->storage = NULL;
+        }
+        buffer->size = (unsigned int)size;
+    }
+
+    if (data != NULL)
+    {
+        RLNULL.stats.bufferUploads++;
+        RLNULL.stats.uploadBytes += size;
+    }
+
+    rlNullLog("glBufferData(0x%04X, %lld, %s, 0x%04X)", target, (long long)size, (data != NULL)? "data" : "NULL", usage);
+}
+
+static void GLAD_API_PTR rlNullBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+    rlNullObject *buffer = rlNullGetObject(RLNULL.buffers[rlNullBufferTarget(target)], RL_NULL_BUFFER);
+
+    if (buffer != NULL)
+    {
+        RLNULL.stats.bufferMemory += (unsigned long long)size - buffer->size;
+        RL_FREE(buffer->storage);
+        buffer->storage = NULL;
+        buffer->size = (unsigned int)size;
+    }
+
+    if (data != NULL)
+    {
+        RLNULL.stats.bufferUploads++;
+        RLNULL.stats.uploadBytes += size;
+    }
+
+    rlNullLog("glBufferStorage(0x%04X, %lld, %s, 0x%04X)", target, (long long)size, (data != NULL)? "data" : "NULL", flags);
+}
+
+static void GLAD_API_PTR rlNullBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    RLNULL.stats.bufferUploads++;
+    RLNULL.stats.uploadBytes += size;
+    rlNullLog("glBufferSubData(0x%04X, %lld, %lld)", target, (long long)offset, (long long)size);
+}
+
+// Buffer storage is only allocated when mapped, read access is counted as readback, write access as upload
+static void *GLAD_API_PTR rlNullMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+    rlNullObject *buffer = rlNullGetObject(RLNULL.buffers[rlNullBufferTarget(target)], RL_NULL_BUFFER);
+    void *data = NULL;
+
+    if ((buffer != NULL) && (buffer->size > 0) && ((unsigned int)(offset + length) <= buffer->size))
+    {
+        if (buffer->storage == NULL) buffer->storage = (unsigned char *)RL_CALLOC(buffer->size, 1);
+        if (buffer->storage != NULL) data = buffer->storage + offset;
+
+        if (access & GL_MAP_READ_BIT) RLNULL.stats.readbackBytes += length;
+        if (access & GL_MAP_WRITE_BIT)
+        {
+            RLNULL.stats.bufferUploads++;
+            RLNULL.stats.uploadBytes += length;
+        }
+    }
+
+    rlNullLog("glMapBufferRange(0x%04X, %lld, %lld, 0x%04X)", target, (long long)offset, (long long)length, access);
+
+    return data;
+}
+
+static void *GLAD_API_PTR rlNullMapBuffer(GLenum target, GLenum access)
+{
+    rlNullObject *buffer = rlNullGetObject(RLNULL.buffers[rlNullBufferTarget(target)], RL_NULL_BUFFER);
+    GLbitfield bits = (access == GL_READ_ONLY)? GL_MAP_READ_BIT : ((access == GL_WRITE_ONLY)? GL_MAP_WRITE_BIT : (GL_MAP_READ_BIT | GL_MAP_WRITE_BIT));
+
+    return rlNullMapBufferRange(target, 0, (buffer != NULL)? buffer->size : 0, bits);
+}
+
+static GLboolean GLAD_API_PTR rlNullUnmapBuffer(GLenum target) { rlNullLog("glUnmapBuffer(0x%04X)", target); return GL_TRUE; }
+
+// Sync objects, commands are not executed so fences are always signaled
+static GLsync GLAD_API_PTR rlNullFenceSync(GLenum condition, GLbitfield flags) { rlNullLog("glFenceSync(0x%04X, %u)", condition, flags); return (GLsync)&RLNULL; }
+static GLenum GLAD_API_PTR rlNullClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { rlNullLog("glClientWaitSync(%u, %llu)", flags, (unsigned long long)timeout); return GL_ALREADY_SIGNALED; }
+static void GLAD_API_PTR rlNullDeleteSync(GLsync sync) { rlNullLog("glDeleteSync()"); }
+
+// Vertex arrays
+static void GLAD_API_PTR rlNullGenVertexArrays(GLsizei n, GLuint *arrays)
+{
+    for (int i = 0; i < n; i++) arrays[i] = rlNullCreateObject(RL_NULL_VERTEX_ARRAY);
+    rlNullLog("glGenVertexArrays(%i) = %u", n, (n > 0)? arrays[0] : 0);
+}
+
+static void GLAD_API_PTR rlNullDeleteVertexArrays(GLsizei n, const GLuint *arrays)
+{
+    for (int i = 0; i < n; i++) rlNullDeleteObject(arrays[i], RL_NULL_VERTEX_ARRAY);
+    rlNullLog("glDeleteVertexArrays(%i, %u)", n, (n > 0)? arrays[0] : 0);
+}
+
+static void GLAD_API_PTR rlNullBindVertexArray(GLuint array)
+{
+    rlNullObject *vertexArray = rlNullGetObject(array, RL_NULL_VERTEX_ARRAY);
+
+    RLNULL.stats.stateChanges++;
+    RLNULL.vertexArray = array;
+    RLNULL.buffers[rlNullBufferTarget(GL_ELEMENT_ARRAY_BUFFER)] = (vertexArray != NULL)? vertexArray->elementBuffer : 0;
+    rlNullLog("glBindVertexArray(%u)", array);
+}
+
+static void GLAD_API_PTR rlNullEnableVertexAttribArray(GLuint index) { RLNULL.stats.stateChanges++; rlNullLog("glEnableVertexAttribArray(%u)", index); }
+static void GLAD_API_PTR rlNullDisableVertexAttribArray(GLuint index) { RLNULL.stats.stateChanges++; rlNullLog("glDisableVertexAttribArray(%u)", index); }
+static void GLAD_API_PTR rlNullVertexAttribDivisor(GLuint index, GLuint divisor) { RLNULL.stats.stateChanges++; rlNullLog("glVertexAttribDivisor(%u, %u)", index, divisor); }
+static void GLAD_API_PTR rlNullVertexAttrib1fv(GLuint index, const GLfloat *v) { RLNULL.stats.stateChanges++; rlNullLog("glVertexAttrib1fv(%u)", index); }
+static void GLAD_API_PTR rlNullVertexAttrib2fv(GLuint index, const GLfloat *v) { RLNULL.stats.stateChanges++; rlNullLog("glVertexAttrib2fv(%u)", index); }
+static void GLAD_API_PTR rlNullVertexAttrib3fv(GLuint index, const GLfloat *v) { RLNULL.stats.stateChanges++; rlNullLog("glVertexAttrib3fv(%u)", index); }
+static void GLAD_API_PTR rlNullVertexAttrib4fv(GLuint index, const GLfloat *v) { RLNULL.stats.stateChanges++; rlNullLog("glVertexAttrib4fv(%u)", index); }
+
+static void GLAD_API_PTR rlNullVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
+{
+    RLNULL.stats.stateChanges++;
+    rlNullLog("glVertexAttribPointer(%u, %i, 0x%04X, %i, %i, %llu)", index, size, type, normalized, stride, (unsigned long long)(size_t)pointer);
+}
+
+// Draw calls
+static void rlNullDraw(int count, int instances)
+{
+    RLNULL.stats.drawCalls++;
+    RLNULL.stats.vertices += count*instances;
+    RLNULL.stats.instances += instances;
+}
+
+static void GLAD_API_PTR rlNullDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    rlNullDraw(count, 1);
+    rlNullLog("glDrawArrays(0x%04X, %i, %i)", mode, first, count);
+}
+
+static void GLAD_API_PTR rlNullDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
+{
+    rlNullDraw(count, 1);
+    rlNullLog("glDrawElements(0x%04X, %i, 0x%04X, %llu)", mode, count, type, (unsigned long long)(size_t)indices);
+}
+
+static void GLAD_API_PTR rlNullDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+    rlNullDraw(count, instancecount);
+    rlNullLog("glDrawArraysInstanced(0x%04X, %i, %i, %i)", mode, first, count, instancecount);
+}
+
+static void GLAD_API_PTR rlNullDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
+{
+    rlNullDraw(count, instancecount);
+    rlNullLog("glDrawElementsInstanced(0x%04X, %i, 0x%04X, %llu, %i)", mode, count, type, (unsigned long long)(size_t)indices, instancecount);
+}
+
+// Framebuffers
+static void GLAD_API_PTR rlNullGenFramebuffers(GLsizei n, GLuint *framebuffers)
+{
+    for (int i = 0; i < n; i++) framebuffers[i] = rlNullCreateObject(RL_NULL_FRAMEBUFFER);
+    rlNullLog("glGenFramebuffers(%i) = %u", n, (n > 0)? framebuffers[0] : 0);
+}
+
+static void GLAD_API_PTR rlNullDeleteFramebuffers(GLsizei n, const GLuint *framebuffers)
+{
+    for (int i = 0; i < n; i++) rlNullDeleteObject(framebuffers[i], RL_NULL_FRAMEBUFFER);
+    rlNullLog("glDeleteFramebuffers(%i, %u)", n, (n > 0)? framebuffers[0] : 0);
+}
+
+static void GLAD_API_PTR rlNullBindFramebuffer(GLenum target, GLuint framebuffer)
+{
+    RLNULL.stats.stateChanges++;
+    RLNULL.framebuffer = framebuffer;
+    rlNullLog("glBindFramebuffer(0x%04X, %u)", target, framebuffer);
+}
+
+static void GLAD_API_PTR rlNullGenRenderbuffers(GLsizei n, GLuint *renderbuffers)
+{
+    for (int i = 0; i < n; i++) renderbuffers[i] = rlNullCreateObject(RL_NULL_RENDERBUFFER);
+    rlNullLog("glGenRenderbuffers(%i) = %u", n, (n > 0)? renderbuffers[0] : 0);
+}
+
+static void GLAD_API_PTR rlNullDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers)
+{
+    for (int i = 0; i < n; i++) rlNullDeleteObject(renderbuffers[i], RL_NULL_RENDERBUFFER);
+    rlNullLog("glDeleteRenderbuffers(%i, %u)", n, (n > 0)? renderbuffers[0] : 0);
+}
+
+static void GLAD_API_PTR rlNullBindRenderbuffer(GLenum target, GLuint renderbuffer)
+{
+    RLNULL.stats.stateChanges++;
+    RLNULL.renderbuffer = renderbuffer;
+    rlNullLog("glBindRenderbuffer(0x%04X, %u)", target, renderbuffer);
+}
+
+static void GLAD_API_PTR rlNullRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+    rlNullObject *renderbuffer = rlNullGetObject(RLNULL.renderbuffer, RL_NULL_RENDERBUFFER);
+
+    if (renderbuffer != NULL)
+    {
+        // NOTE: Depth/stencil formats are considered 32 bit per pixel
+        RLNULL.stats.textureMemory -= renderbuffer->size;
+        renderbuffer->width = width;
+        renderbuffer->height = height;
+        renderbuffer->size = width*height*4;
+        RLNULL.stats.textureMemory += renderbuffer->size;
+    }
+
+    rlNullLog("glRenderbufferStorage(0x%04X, 0x%04X, %i, %i)", target, internalformat, width, height);
+}
+
+static void GLAD_API_PTR rlNullFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+    rlNullObject *framebuffer = rlNullGetObject(RLNULL.framebuffer, RL_NULL_FRAMEBUFFER);
+
+    if ((framebuffer != NULL) && (attachment == GL_DEPTH_ATTACHMENT))
+    {
+        framebuffer->depthAttachment = texture;
+        framebuffer->depthAttachmentType = (texture != 0)? GL_TEXTURE : GL_NONE;
+    }
+
+    rlNullLog("glFramebufferTexture2D(0x%04X, 0x%04X, 0x%04X, %u, %i)", target, attachment, textarget, texture, level);
+}
+
+static void GLAD_API_PTR rlNullFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+    rlNullObject *framebuffer = rlNullGetObject(RLNULL.framebuffer, RL_NULL_FRAMEBUFFER);
+
+    if ((framebuffer != NULL) && (attachment == GL_DEPTH_ATTACHMENT))
+    {
+        framebuffer->depthAttachment = renderbuffer;
+        framebuffer->depthAttachmentType = (renderbuffer != 0)? GL_RENDERBUFFER : GL_NONE;
+    }
+
+    rlNullLog("glFramebufferRenderbuffer(0x%04X, 0x%04X, 0x%04X, %u)", target, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void GLAD_API_PTR rlNullGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params)
+{
+    rlNullObject *framebuffer = rlNullGetObject(RLNULL.framebuffer, RL_NULL_FRAMEBUFFER);
+
+    params[0] = 0;
+    if ((framebuffer != NULL) && (attachment == GL_DEPTH_ATTACHMENT))
+    {
+        if (pname == GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE) params[0] = framebuffer->depthAttachmentType;
+        else if (pname == GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME) params[0] = (GLint)framebuffer->depthAttachment;
+    }
+}
+
+static GLenum GLAD_API_PTR rlNullCheckFramebufferStatus(GLenum target) { return GL_FRAMEBUFFER_COMPLETE; }
+static void GLAD_API_PTR rlNullDrawBuffers(GLsizei n, const GLenum *bufs) { RLNULL.stats.stateChanges++; rlNullLog("glDrawBuffers(%i)", n); }
+
+static void GLAD_API_PTR rlNullBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+    rlNullLog("glBlitFramebuffer(%i, %i, %i, %i, %i, %i, %i, %i, 0x%04X, 0x%04X)", srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+// Shaders
+static GLuint GLAD_API_PTR rlNullCreateShader(GLenum type)
+{
+    GLuint id = rlNullCreateObject(RL_NULL_SHADER);
+    rlNullObject *shader = rlNullGetObject(id, RL_NULL_SHADER);
+    if (shader != NULL) shader->shaderType = type;
+
+    rlNullLog("glCreateShader(0x%04X) = %u", type, id);
+
+    return id;
+}
+
+static void GLAD_API_PTR rlNullDeleteShader(GLuint shader) { rlNullDeleteObject(shader, RL_NULL_SHADER); rlNullLog("glDeleteShader(%u)", shader); }
+
+static void GLAD_API_PTR rlNullShaderSource(GLuint id, GLsizei count, const GLchar *const *string, const GLint *length)
+{
+    rlNullObject *shader = rlNullGetObject(id, RL_NULL_SHADER);
+
+    if (shader != NULL)
+    {
+        // Join source strings to parse them at once
+        int size = 0;
+        for (int i = 0; i < count; i++) size += ((length != NULL) && (length[i] >= 0))? length[i] : (int)strlen(string[i]);
+
+        char *code = (char *)RL_MALLOC(size + 1);
+
+        if (code != NULL)
+        {
+            int offset = 0;
+            for (int i = 0; i < count; i++)
+            {
+                int stringLength = ((length != NULL) && (length[i] >= 0))? length[i] : (int)strlen(string[i]);
+                memcpy(code + offset, string[i], stringLength);
+                offset += stringLength;
+            }
+            code[size] = '\0';
+
+            shader->variableCount = 0;
+            rlNullParseShaderVariables(shader, code);
+            RL_FREE(code);
+        }
+    }
+
+    rlNullLog("glShaderSource(%u, %i)", id, count);
+}
+
+static void GLAD_API_PTR rlNullCompileShader(GLuint shader) { rlNullLog("glCompileShader(%u)", shader); }
+
+static void GLAD_API_PTR rlNullGetShaderiv(GLuint shader, GLenum pname, GLint *params)
+{
+    if (pname == GL_COMPILE_STATUS) params[0] = GL_TRUE;
+    else params[0] = 0;
+}
+
+static void GLAD_API_PTR rlNullGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    if (length != NULL) *length = 0;
+    if ((infoLog != NULL) && (bufSize > 0)) infoLog[0] = '\0';
+}
+
+static GLuint GLAD_API_PTR rlNullCreateProgram(void)
+{
+    GLuint id = rlNullCreateObject(RL_NULL_PROGRAM);
+    rlNullLog("glCreateProgram() = %u", id);
+
+    return id;
+}
+
+static void GLAD_API_PTR rlNullDeleteProgram(GLuint program) { rlNullDeleteObject(program, RL_NULL_PROGRAM); rlNullLog("glDeleteProgram(%u)", program); }
+
+static void GLAD_API_PTR rlNullAttachShader(GLuint id, GLuint shader)
+{
+    rlNullObject *program = rlNullGetObject(id, RL_NULL_PROGRAM);
+
+    if (program != NULL)
+    {
+        if (program->shaders[0] == 0) program->shaders[0] = shader;
+        else if (program->shaders[1] == 0) program->shaders[1] = shader;
+    }
+
+    rlNullLog("glAttachShader(%u, %u)", id, shader);
+}
+
+static void GLAD_API_PTR rlNullDetachShader(GLuint id, GLuint shader)
+{
+    rlNullObject *program = rlNullGetObject(id, RL_NULL_PROGRAM);
+
+    if (program != NULL)
+    {
+        if (program->shaders[0] == shader) program->shaders[0] = 0;
+        if (program->shaders[1] == shader) program->shaders[1] = 0;
+    }
+
+    rlNullLog("glDetachShader(%u, %u)", id, shader);
+}
+
+static void GLAD_API_PTR rlNullBindAttribLocation(GLuint id, GLuint index, const GLchar *name)
+{
+    rlNullObject *program = rlNullGetObject(id, RL_NULL_PROGRAM);
+
+    if (program != NULL)
+    {
+        rlNullVariable *variable = rlNullFindVariable(program, name, false);
+        if (variable == NULL) variable = rlNullAddVariable(program, name, false, (int)index);
+        if (variable != NULL)
+        {
+            variable->location = (int)index;
+            variable->bound = true;
+        }
+    }
+
+    rlNullLog("glBindAttribLocation(%u, %u, %s)", id, index, name);
+}
+
+// Link program: uniforms get consecutive locations, attributes get bound location or first available
+static void GLAD_API_PTR rlNullLinkProgram(GLuint id)
+{
+    rlNullObject *program = rlNullGetObject(id, RL_NULL_PROGRAM);
+
+    if (program != NULL)
+    {
+        // Keep only attributes locations requested with glBindAttribLocation()
+        int count = 0;
+        for (int i = 0; i < program->variableCount; i++)
+        {
+            if (!program->variables[i].uniform && program->variables[i].bound)
+            {
+                program->variables[count] = program->variables[i];
+                program->variables[count].active = false;
+                count++;
+            }
+        }
+        program->variableCount = count;
+
+        int uniformLocation = 0;
+
+        for (int s = 0; s < 2; s++)
+        {
+            rlNullObject *shader = rlNullGetObject(program->shaders[s], RL_NULL_SHADER);
+            if (shader == NULL) continue;
+
+            for (int i = 0; i < shader->variableCount; i++)
+            {
+                rlNullVariable *declared = &shader->variables[i];
+                rlNullVariable *variable = rlNullFindVariable(program, declared->name, declared->uniform);
+
+                if (variable == NULL) variable = rlNullAddVariable(program, declared->name, declared->uniform, declared->uniform? uniformLocation++ : -1);
+                if (variable != NULL) variable->active = true;
+            }
+        }
+
+        // Assign attributes not bound to first available location
+        for (int i = 0; i < program->variableCount; i++)
+        {
+            rlNullVariable *variable = &program->variables[i];
+            if (variable->uniform || !variable->active || (variable->location >= 0)) continue;
+
+            int location = 0;
+            bool used = true;
+
+            while (used)
+            {
+                used = false;
+                for (int j = 0; j < program->variableCount; j++)
+                {
+                    if (!program->variables[j].uniform && program->variables[j].active && (program->variables[j].location == location)) { used = true; location++; break; }
+                }
+            }
+
+            variable->location = location;
+        }
+    }
+
+    rlNullLog("glLinkProgram(%u)", id);
+}
+
+static void GLAD_API_PTR rlNullGetProgramiv(GLuint id, GLenum pname, GLint *params)
+{
+    rlNullObject *program = rlNullGetObject(id, RL_NULL_PROGRAM);
+
+    params[0] = 0;
+
+    if (pname == GL_LINK_STATUS) params[0] = GL_TRUE;
+    else if ((program != NULL) && ((pname == GL_ACTIVE_UNIFORMS) || (pname == GL_ACTIVE_ATTRIBUTES)))
+    {
+        for (int i = 0; i < program->variableCount; i++)
+        {
+            if (program->variables[i].active && (program->variables[i].uniform == (pname == GL_ACTIVE_UNIFORMS))) params[0]++;
+        }
+    }
+}
+
+static void GLAD_API_PTR rlNullGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    if (length != NULL) *length = 0;
+    if ((infoLog != NULL) && (bufSize > 0)) infoLog[0] = '\0';
+}
+
+static void GLAD_API_PTR rlNullUseProgram(GLuint program) { RLNULL.stats.stateChanges++; rlNullLog("glUseProgram(%u)", program); }
+
+static GLint GLAD_API_PTR rlNullGetAttribLocation(GLuint id, const GLchar *name)
+{
+    rlNullObject *program = rlNullGetObject(id, RL_NULL_PROGRAM);
+    rlNullVariable *variable = (program != NULL)? rlNullFindVariable(program, name, false) : NULL;
+
+    return ((variable != NULL) && variable->active)? variable->location : -1;
+}
+
+// NOTE: Array elements and struct members (i.e. "lights[0].color") are found if base name has been declared
+static GLint GLAD_API_PTR rlNullGetUniformLocation(GLuint id, const GLchar *name)
+{
+    rlNullObject *program = rlNullGetObject(id, RL_NULL_PROGRAM);
+    if (program == NULL) return -1;
+
+    rlNullVariable *variable = rlNullFindVariable(program, name, true);
+
+    if (variable == NULL)
+    {
+        char baseName[64] = { 0 };
+        for (int i = 0; (i < (int)sizeof(baseName) - 1) && (name[i] != '\0') && (name[i] != '[') && (name[i] != '.'); i++) baseName[i] = name[i];
+
+        if ((strcmp(baseName, name) != 0) && (rlNullFindVariable(program, baseName, true) != NULL))
+        {
+            int location = 0;
+            for (int i = 0; i < program->variableCount; i++) if (program->variables[i].uniform) location++;
+
+            variable = rlNullAddVariable(program, name, true, location);
+            if (variable != NULL) variable->active = true;
+        }
+    }
+
+    return ((variable != NULL) && variable->active)? variable->location : -1;
+}
+
+// Uniforms
+static void rlNullUniform(const char *function, GLint location, GLsizei count)
+{
+    RLNULL.stats.uniformUpdates++;
+    rlNullLog("%s(%i, %i)", function, location, count);
+}
+
+static void GLAD_API_PTR rlNullUniform1i(GLint location, GLint v0) { rlNullUniform("glUniform1i", location, 1); }
+static void GLAD_API_PTR rlNullUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { rlNullUniform("glUniform4f", location, 1); }
+static void GLAD_API_PTR rlNullUniform1fv(GLint location, GLsizei count, const GLfloat *value) { rlNullUniform("glUniform1fv", location, count); }
+static void GLAD_API_PTR rlNullUniform2fv(GLint location, GLsizei count, const GLfloat *value) { rlNullUniform("glUniform2fv", location, count); }
+static void GLAD_API_PTR rlNullUniform3fv(GLint location, GLsizei count, const GLfloat *value) { rlNullUniform("glUniform3fv", location, count); }
+static void GLAD_API_PTR rlNullUniform4fv(GLint location, GLsizei count, const GLfloat *value) { rlNullUniform("glUniform4fv", location, count); }
+static void GLAD_API_PTR rlNullUniform1iv(GLint location, GLsizei count, const GLint *value) { rlNullUniform("glUniform1iv", location, count); }
+static void GLAD_API_PTR rlNullUniform2iv(GLint location, GLsizei count, const GLint *value) { rlNullUniform("glUniform2iv", location, count); }
+static void GLAD_API_PTR rlNullUniform3iv(GLint location, GLsizei count, const GLint *value) { rlNullUniform("glUniform3iv", location, count); }
+static void GLAD_API_PTR rlNullUniform4iv(GLint location, GLsizei count, const GLint *value) { rlNullUniform("glUniform4iv", location, count); }
+static void GLAD_API_PTR rlNullUniform1uiv(GLint location, GLsizei count, const GLuint *value) { rlNullUniform("glUniform1uiv", location, count); }
+static void GLAD_API_PTR rlNullUniform2uiv(GLint location, GLsizei count, const GLuint *value) { rlNullUniform("glUniform2uiv", location, count); }
+static void GLAD_API_PTR rlNullUniform3uiv(GLint location, GLsizei count, const GLuint *value) { rlNullUniform("glUniform3uiv", location, count); }
+static void GLAD_API_PTR rlNullUniform4uiv(GLint location, GLsizei count, const GLuint *value) { rlNullUniform("glUniform4uiv", location, count); }
+static void GLAD_API_PTR rlNullUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { rlNullUniform("glUniformMatrix4fv", location, count); }
+
+// Null device functions loader, used by glad to load OpenGL functions
+// NOTE: OpenGL functions not used by rlgl are not provided (NULL)
+#define RL_NULL_PROC(name) { "gl"#name, (GLADapiproc)rlNull##name }
+
+static GLADapiproc rlNullGetProcAddress(const char *name)
+{
+    static const struct { const char *name; GLADapiproc proc; } procs[] = {
+        RL_NULL_PROC(GetString), RL_NULL_PROC(GetStringi), RL_NULL_PROC(GetIntegerv), RL_NULL_PROC(GetFloatv), RL_NULL_PROC(GetError),
+        RL_NULL_PROC(Enable), RL_NULL_PROC(Disable), RL_NULL_PROC(Hint), RL_NULL_PROC(CullFace), RL_NULL_PROC(FrontFace),
+        RL_NULL_PROC(PolygonMode), RL_NULL_PROC(DepthFunc), RL_NULL_PROC(DepthMask), RL_NULL_PROC(ColorMask),
+        RL_NULL_PROC(BlendEquation), RL_NULL_PROC(BlendEquationSeparate), RL_NULL_PROC(BlendFunc), RL_NULL_PROC(BlendFuncSeparate),
+        RL_NULL_PROC(LineWidth), RL_NULL_PROC(PixelStorei), RL_NULL_PROC(Scissor), RL_NULL_PROC(Viewport),
+        RL_NULL_PROC(ClearColor), RL_NULL_PROC(ClearDepth), RL_NULL_PROC(Clear),
+        RL_NULL_PROC(GenTextures), RL_NULL_PROC(DeleteTextures), RL_NULL_PROC(ActiveTexture), RL_NULL_PROC(BindTexture),
+        RL_NULL_PROC(TexParameteri), RL_NULL_PROC(TexParameteriv), RL_NULL_PROC(TexParameterf),
+        RL_NULL_PROC(TexImage2D), RL_NULL_PROC(CompressedTexImage2D), RL_NULL_PROC(TexSubImage2D), RL_NULL_PROC(GenerateMipmap),
+        RL_NULL_PROC(GetTexImage), RL_NULL_PROC(ReadPixels),
+        RL_NULL_PROC(GenBuffers), RL_NULL_PROC(DeleteBuffers), RL_NULL_PROC(BindBuffer), RL_NULL_PROC(BufferData), RL_NULL_PROC(BufferSubData),
+        RL_NULL_PROC(MapBuffer), RL_NULL_PROC(MapBufferRange), RL_NULL_PROC(UnmapBuffer), RL_NULL_PROC(BufferStorage),
+        RL_NULL_PROC(FenceSync), RL_NULL_PROC(ClientWaitSync), RL_NULL_PROC(DeleteSync),
+        RL_NULL_PROC(GenVertexArrays), RL_NULL_PROC(DeleteVertexArrays), RL_NULL_PROC(BindVertexArray),
+        RL_NULL_PROC(EnableVertexAttribArray), RL_NULL_PROC(DisableVertexAttribArray), RL_NULL_PROC(VertexAttribPointer), RL_NULL_PROC(VertexAttribDivisor),
+        RL_NULL_PROC(VertexAttrib1fv), RL_NULL_PROC(VertexAttrib2fv), RL_NULL_PROC(VertexAttrib3fv), RL_NULL_PROC(VertexAttrib4fv),
+        RL_NULL_PROC(DrawArrays), RL_NULL_PROC(DrawElements), RL_NULL_PROC(DrawArraysInstanced), RL_NULL_PROC(DrawElementsInstanced),
+        RL_NULL_PROC(GenFramebuffers), RL_NULL_PROC(DeleteFramebuffers), RL_NULL_PROC(BindFramebuffer),
+        RL_NULL_PROC(GenRenderbuffers), RL_NULL_PROC(DeleteRenderbuffers), RL_NULL_PROC(BindRenderbuffer), RL_NULL_PROC(RenderbufferStorage),
+        RL_NULL_PROC(FramebufferTexture2D), RL_NULL_PROC(FramebufferRenderbuffer), RL_NULL_PROC(GetFramebufferAttachmentParameteriv),
+        RL_NULL_PROC(CheckFramebufferStatus), RL_NULL_PROC(DrawBuffers), RL_NULL_PROC(BlitFramebuffer),
+        RL_NULL_PROC(CreateShader), RL_NULL_PROC(DeleteShader), RL_NULL_PROC(ShaderSource), RL_NULL_PROC(CompileShader),
+        RL_NULL_PROC(GetShaderiv), RL_NULL_PROC(GetShaderInfoLog), RL_NULL_PROC(CreateProgram), RL_NULL_PROC(DeleteProgram),
+        RL_NULL_PROC(AttachShader), RL_NULL_PROC(DetachShader), RL_NULL_PROC(BindAttribLocation), RL_NULL_PROC(LinkProgram),
+        RL_NULL_PROC(GetProgramiv), RL_NULL_PROC(GetProgramInfoLog), RL_NULL_PROC(UseProgram),
+        RL_NULL_PROC(GetAttribLocation), RL_NULL_PROC(GetUniformLocation),
+        RL_NULL_PROC(Uniform1i), RL_NULL_PROC(Uniform4f), RL_NULL_PROC(Uniform1fv), RL_NULL_PROC(Uniform2fv), RL_NULL_PROC(Uniform3fv),
+        RL_NULL_PROC(Uniform4fv), RL_NULL_PROC(Uniform1iv), RL_NULL_PROC(Uniform2iv), RL_NULL_PROC(Uniform3iv), RL_NULL_PROC(Uniform4iv),
+        RL_NULL_PROC(Uniform1uiv), RL_NULL_PROC(Uniform2uiv), RL_NULL_PROC(Uniform3uiv), RL_NULL_PROC(Uniform4uiv), RL_NULL_PROC(UniformMatrix4fv)
+    };
+
+    for (int i = 0; i < (int)(sizeof(procs)/sizeof(procs[0])); i++)
+    {
+        if (strcmp(procs[i].name, name) == 0) return procs[i].proc;
+    }
+
+    return NULL;
+}
+
+// Unload null device objects
+// NOTE: Recorded statistics and commands log are kept
+static void rlNullUnload(void)
+{
+    for (unsigned int i = 0; i < RLNULL.objectCount; i++)
+    {
+        RL_FREE(RLNULL.objects[i].storage);
+        RL_FREE(RLNULL.objects[i].variables);
+    }
+
+    RL_FREE(RLNULL.objects);
+    RL_FREE(RLNULL.freeIds);
+
+    RLNULL.objects = NULL;
+    RLNULL.freeIds = NULL;
+    RLNULL.objectCount = 0;
+    RLNULL.objectCapacity = 0;
+    RLNULL.freeIdCount = 0;
+    RLNULL.stats.textureCount = 0;
+    RLNULL.stats.bufferCount = 0;
+    RLNULL.stats.shaderCount = 0;
+    RLNULL.stats.textureMemory = 0;
+    RLNULL.stats.bufferMemory = 0;
+}
+#endif  // GRAPHICS_API_NULL
+
 // Get pixel data size in bytes (image or texture)
 // NOTE: Size depends on pixel format
 static int rlGetPixelDataSize(int width, int height, int format)
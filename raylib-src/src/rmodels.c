@@ -12,12 +12,18 @@
 *       #define SUPPORT_FILEFORMAT_GLTF
 *       #define SUPPORT_FILEFORMAT_VOX
 *       #define SUPPORT_FILEFORMAT_M3D
+*       #define SUPPORT_FILEFORMAT_RANIM
 *           Selected desired fileformats to be supported for model data loading.
 *
 *       #define SUPPORT_MESH_GENERATION
 *           Support procedural mesh generation functions, uses external par_shapes.h library
 *           NOTE: Some generated meshes DO NOT include generated texture coordinates
 *
+*       #define SUPPORT_SIMD_SKINNING
+*           Use SIMD kernels (SSE2 or NEON, depending on compilation target) for CPU skinning
+*           on UpdateModelAnimation(), if not defined or not available a scalar path is used
+*           NOTE: Vertex ranges are split across worker threads if SUPPORT_THREADED_JOBS is defined
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -56,7 +62,20 @@
 #include <stdio.h>          // Required for: sprintf()
 #include <stdlib.h>         // Required for: malloc(), calloc(), free()
 #include <string.h>         // Required for: memcmp(), strlen(), strncpy()
-#include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf()
+#include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf(), isfinite()
+#include <float.h>          // Required for: FLT_MAX
+#include <limits.h>         // Required for: INT_MAX
+#include <stdint.h>         // Required for: SIZE_MAX
+
+#if defined(SUPPORT_SIMD_SKINNING)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RL_SKINNING_SSE2
+        #include <emmintrin.h>      // Required for: SSE2 intrinsics [Used in UpdateModelAnimation()]
+    #elif defined(__ARM_NEON) && defined(__aarch64__)
+        #define RL_SKINNING_NEON
+        #include <arm_neon.h>       // Required for: NEON intrinsics [Used in UpdateModelAnimation()]
+    #endif
+#endif
 
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
     #define TINYOBJ_MALLOC RL_MALLOC
@@ -132,16 +151,136 @@
 #ifndef MAX_MESH_VERTEX_BUFFERS
     #define MAX_MESH_VERTEX_BUFFERS  9    // Maximum vertex buffers (VBO) per mesh
 #endif
+#ifndef ANIMATION_COMPRESSED_FILE_VERSION
+    #define ANIMATION_COMPRESSED_FILE_VERSION 100   // Compressed animations file format version (.ranim)
+#endif
+
+// Compressed animation tracks
+#define ANIM_TRACK_TRANSLATION      0   // Track kind: translation (3 components)
+#define ANIM_TRACK_ROTATION         1   // Track kind: rotation (4 components, quaternion)
+#define ANIM_TRACK_SCALE            2   // Track kind: scale (3 components)
+
+#define ANIM_TRACK_DEFAULT          0   // Track type: default value for all frames (zero translation, identity rotation, unit scale)
+#define ANIM_TRACK_CONSTANT         1   // Track type: single full precision value for all frames
+#define ANIM_TRACK_ANIMATED         2   // Track type: quantized keyframes, interpolated between keys
+
+#ifndef SKINNING_BATCH_VERTICES
+    #define SKINNING_BATCH_VERTICES  4096 // Minimum vertices processed per worker batch on CPU skinning
+#endif
+#ifndef BLEND_POSE_STACK_BONES
+    #define BLEND_POSE_STACK_BONES     64   // Maximum bones sampled on stack when blending animations, bigger poses are allocated
+#endif
+
+#ifndef MESH_BVH_LEAF_TRIANGLES
+    #define MESH_BVH_LEAF_TRIANGLES     4   // Maximum triangles per BVH leaf node (when splitting is not worth it)
+#endif
+#ifndef MESH_BVH_PARALLEL_TRIANGLES
+    #define MESH_BVH_PARALLEL_TRIANGLES 8192 // Triangles per BVH subtree built as a separate worker job
+#endif
+#ifndef INSTANCE_BUFFER_RING_SEGMENTS
+    #define INSTANCE_BUFFER_RING_SEGMENTS 3 // Instance buffer segments used round-robin on INSTANCE_BUFFER_RING mode (frames in flight)
+#endif
+#define MESH_BVH_BINS                  16   // Number of bins used to evaluate SAH split candidates per axis
+#define MESH_BVH_MAX_DEPTH             60   // Maximum BVH depth, deeper ranges become leaf nodes (traversal stack size)
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Mesh BVH node, flattened hierarchy
+// NOTE: Interior nodes children are stored consecutively: first (left) and first + 1 (right)
+struct rMeshBVHNode {
+    float min[3];                   // Node bounds minimum
+    int first;                      // Leaf: first triangle index, interior: left child node index
+    float max[3];                   // Node bounds maximum
+    int count;                      // Leaf: triangles count, interior: 0
+};
+
+// Mesh BVH subtree build job, ranges deferred from top levels build to workers
+typedef struct MeshBVHTask {
+    int node;                       // Subtree root node index (top levels nodes array)
+    int start;                      // First triangle (sorted triangles order)
+    int count;                      // Triangles count
+    int depth;                      // Subtree root depth
+    rMeshBVHNode *nodes;            // Subtree nodes, built by worker
+    int nodeCount;                  // Subtree nodes count
+} MeshBVHTask;
+
+// Mesh BVH build triangle reference
+// NOTE: References are partitioned in place while building, so ranges data is accessed sequentially
+typedef struct MeshBVHItem {
+    float bounds[6];                // Triangle bounds: min and max
+    float centroid[3];              // Triangle bounds centroid
+    int index;                      // Triangle index
+} MeshBVHItem;
+
+// Mesh BVH build data
+typedef struct MeshBVHBuild {
+    MeshBVHItem *items;             // Triangles references, sorted by leaf node when built
+    MeshBVHTask *tasks;             // Deferred subtree build jobs
+    int taskCount;                  // Deferred subtree build jobs count
+    int taskCapacity;               // Deferred subtree build jobs capacity
+} MeshBVHBuild;
+
+// Mesh BVH batched ray queries job data
+typedef struct MeshBVHRayJob {
+    const Ray *rays;                // Rays to test (world space)
+    RayCollision *collisions;       // Output collisions
+    MeshBVH bvh;                    // Hierarchy to test
+    Matrix transform;               // Mesh transform
+    Matrix invTransform;            // Mesh inverse transform
+    float sign;                     // Transform determinant sign, normals orientation
+    float detEpsilon;               // Mesh space parallel ray threshold, matches world space EPSILON
+} MeshBVHRayJob;
+
+// CPU skinning job data, shared by all workers processing one mesh
+// NOTE: Bone matrices are packed as 3x4 row-major affine matrices (12 floats per bone),
+// so every matrix row can be loaded and blended as a single 4-wide SIMD vector
+typedef struct SkinningJob {
+    const float *vertices;          // Bind pose vertex positions (XYZ)
+    const float *normals;           // Bind pose vertex normals (XYZ), can be NULL
+    const unsigned char *boneIds;   // Vertex bone ids (4 per vertex)
+    const float *boneWeights;       // Vertex bone weights (4 per vertex)
+    float *animVertices;            // Output vertex positions (XYZ)
+    float *animNormals;             // Output vertex normals (XYZ), can be NULL
+    const float *palette;           // Packed bone matrices, 12 floats per bone
+} SkinningJob;
+
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+// glTF animation sampler keyframes, unpacked once for animations baking
+// NOTE: Cubic spline values are stored as in glTF: in-tangent, value and out-tangent per keyframe
+typedef struct AnimSamplerGLTF {
+    cgltf_interpolation_type interpolation; // Keyframes interpolation
+    int keyCount;                   // Keyframes count (0 if channel is not animated)
+    int components;                 // Value components: 3 (translation, scale) or 4 (rotation)
+    float *times;                   // Keyframes times in seconds (ascending)
+    float *values;                  // Keyframes values (shares times allocation)
+} AnimSamplerGLTF;
+
+// glTF animations baking job data, shared by all workers
+// NOTE: Animations bones are baked in parallel for all frames, then frames are built from parent joints in parallel
+typedef struct AnimBakeJobGLTF {
+    ModelAnimation *animations;     // Animations to bake (frame poses allocated)
+    int boneCount;                  // Bones per animation (skin joints count)
+    AnimSamplerGLTF *samplers;      // Samplers per animation bone: translation, rotation and scale
+    const Transform *restPose;      // Joints local transform, used by channels not animated
+    int *firstFrame;                // First frame of every animation on all animations frames (animCount + 1)
+} AnimBakeJobGLTF;
+
+// glTF external files mapped by cgltf file callbacks, unloaded on cgltf_free()
+typedef struct MappedFilesGLTF {
+    MappedFile *files;              // Mapped files (buffers data)
+    int count;                      // Mapped files count
+} MappedFilesGLTF;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+static float *skinningPalette = NULL;       // Packed bone matrices scratch buffer (main thread only, used along GPU upload)
+static int skinningPaletteCapacity = 0;     // Packed bone matrices scratch buffer capacity (floats)
+static int skinnedVertexCount = 0;          // Vertices processed on last UpdateModelAnimation() call
+static double skinningTime = 0.0;           // Time spent on last UpdateModelAnimation() call (seconds)
+static InstanceBuffer instancesBuffer = { 0 }; // Internal instance buffer used by DrawMeshInstanced(), grows as required
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -167,6 +306,18 @@ static ModelAnimation * RLLoadModelAnimationsM3D(const char *fileName, int *anim
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
 static void RLProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
 #endif
+static void RLSkinVertexRange(void *userData, int start, int end, int worker);  // Skin a range of mesh vertices (job callback)
+static void RLUpdateModelSkinning(Model model);             // Update model animated vertex data from current bone matrices (CPU skinning)
+static void RLUnloadSkinningPalette(void);                  // Unload packed bone matrices scratch buffer
+static int RLEncodeAnimationTrack(unsigned char *track, int kind, const float *values, int frameCount, float tolerance, unsigned short *keys); // Encode animation track, returns size in bytes
+static int RLGetAnimationTrackSize(const unsigned char *track, int kind, int available, int frameCount); // Get encoded animation track size, -1 if not valid
+static void RLDecodeAnimationTrack(const unsigned char *track, int kind, float frame, float *value);    // Decode animation track value at frame
+static void RLBuildMeshBVHNode(MeshBVHBuild *build, rMeshBVHNode *nodes, int *nodeCount, int index, int start, int count, int depth, bool defer); // Build BVH node (recursive)
+static void RLBuildMeshBVHTasks(void *userData, int start, int end, int worker);   // Build BVH deferred subtrees (job callback)
+static void RLGetRayCollisionsMeshBVHRange(void *userData, int start, int end, int worker); // Get batched rays collision info (job callback)
+static float RLGetRayDistanceMeshBVH(MeshBVH bvh, Vector3 origin, Vector3 direction, float detEpsilon, int *triangle);  // Get closest hit distance of mesh space ray, -1 if no hit
+static float RLGetRayDistanceTriangle(Vector3 origin, Vector3 direction, const float *triangle, float detEpsilon); // Get hit distance of ray and triangle (9 floats), -1 if no hit
+static RayCollision RLGetMeshRayCollision(Ray ray, float distance, const float *triangle, Matrix invTransform, float sign); // Get world space collision from mesh space hit
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -1209,6 +1360,7 @@ void RLUnloadModel(Model model)
     // Unload animation data
     RL_FREE(model.bones);
     RL_FREE(model.bindPose);
+    RLUnloadSkinningPalette();
 
     TRACELOG(LOG_INFO, "MODEL: Unloaded model (and meshes) from RAM and VRAM");
 }
@@ -1670,9 +1822,166 @@ void RLDrawMesh(Mesh mesh, Material material, Matrix transform)
 void RLDrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    // Instancing required variables
-    float16 *instanceTransforms = NULL;
-    unsigned int instancesVboId = 0;
+    // Internal instance buffer is reused between calls, storage is orphaned on update (no GPU sync)
+    if (instances > instancesBuffer.capacity)
+    {
+        int capacity = (instancesBuffer.capacity > 0)? instancesBuffer.capacity : 256;
+        while (capacity < instances) capacity *= 2;
+
+        RLUnloadInstanceBuffer(instancesBuffer);
+        instancesBuffer = RLLoadInstanceBuffer(capacity, NULL, 0, INSTANCE_BUFFER_ORPHAN);
+    }
+
+    if (instancesBuffer.vboId == 0) return;
+
+    instancesBuffer.instanceCount = 0;  // Only provided instances are uploaded
+    RLUpdateInstanceBuffer(&instancesBuffer, transforms, NULL, 0, instances);
+    RLDrawMeshInstancedBuffer(mesh, material, instancesBuffer, 0, instances);
+#endif
+}
+
+// Unload internal instance buffer used by DrawMeshInstanced()
+// NOTE: Required on graphics context closing, buffer is reloaded on next use
+extern void RLUnloadInstanceBufferDefault(void)
+{
+    RLUnloadInstanceBuffer(instancesBuffer);
+    instancesBuffer = (InstanceBuffer){ 0 };
+}
+
+// Load instance buffer for instanced drawing
+// NOTE: Every instance stores its transform (column-major, 16 floats) followed by custom attributes data,
+// custom attributes are optional, i.e. color or texcoords offset, provided as float attributes
+InstanceBuffer RLLoadInstanceBuffer(int capacity, const InstanceAttribute *attributes, int attributeCount, int mode)
+{
+    InstanceBuffer buffer = { 0 };
+
+    if (capacity <= 0)
+    {
+        TRACELOG(LOG_WARNING, "MESH: Failed to load instance buffer, invalid capacity");
+        return buffer;
+    }
+
+    // Compute custom data size from attributes layout
+    int dataSize = 0;
+
+    for (int i = 0; i < attributeCount; i++)
+    {
+        int attributeEnd = attributes[i].offset + (attributes[i].type + 1)*(int)sizeof(float);
+        if (attributeEnd > dataSize) dataSize = attributeEnd;
+    }
+
+    dataSize = (dataSize + 3) & ~3;     // Keep instances 4 bytes aligned
+
+    buffer.mode = mode;
+    buffer.capacity = capacity;
+    buffer.dataSize = dataSize;
+    buffer.stride = 16*sizeof(float) + dataSize;
+    buffer.data = (unsigned char *)RL_CALLOC(capacity, buffer.stride);
+
+    if (attributeCount > 0)
+    {
+        buffer.attributeCount = attributeCount;
+        buffer.attributes = (InstanceAttribute *)RL_MALLOC(attributeCount*sizeof(InstanceAttribute));
+        memcpy(buffer.attributes, attributes, attributeCount*sizeof(InstanceAttribute));
+    }
+
+    int segments = (mode == INSTANCE_BUFFER_RING)? INSTANCE_BUFFER_RING_SEGMENTS : 1;
+    buffer.vboId = rlLoadVertexBuffer(NULL, capacity*buffer.stride*segments, true);
+
+    if ((buffer.vboId == 0) || (buffer.data == NULL))
+    {
+        TRACELOG(LOG_WARNING, "MESH: Failed to load instance buffer");
+        RLUnloadInstanceBuffer(buffer);
+        return (InstanceBuffer){ 0 };
+    }
+
+    TRACELOG(LOG_INFO, "MESH: [ID %i] Instance buffer loaded successfully (%i instances, %i bytes per instance)", buffer.vboId, capacity, buffer.stride);
+
+    return buffer;
+}
+
+// Check if an instance buffer is valid (data loaded in RAM and VRAM)
+bool RLIsInstanceBufferValid(InstanceBuffer buffer)
+{
+    return ((buffer.vboId > 0) &&       // Validate GPU buffer
+            (buffer.capacity > 0) &&    // Validate instances capacity
+            (buffer.data != NULL));     // Validate instances data in RAM
+}
+
+// Unload instance buffer from CPU and GPU
+void RLUnloadInstanceBuffer(InstanceBuffer buffer)
+{
+    if (buffer.vboId > 0) rlUnloadVertexBuffer(buffer.vboId);
+
+    RL_FREE(buffer.attributes);
+    RL_FREE(buffer.data);
+}
+
+// Update instances transforms and/or custom data, NULL to keep current data
+// NOTE: Transforms are converted directly into instances data, custom data is provided packed (count*dataSize bytes)
+// GPU upload depends on buffer mode:
+//  - INSTANCE_BUFFER_STATIC: only updated range is uploaded, in place
+//  - INSTANCE_BUFFER_ORPHAN: buffer storage orphaned, all instances with data uploaded
+//  - INSTANCE_BUFFER_RING: all instances with data uploaded to next buffer segment
+void RLUpdateInstanceBuffer(InstanceBuffer *buffer, const Matrix *transforms, const void *data, int offset, int count)
+{
+    if ((buffer == NULL) || (buffer->data == NULL) || (count <= 0)) return;
+
+    if ((offset < 0) || ((offset + count) > buffer->capacity))
+    {
+        TRACELOG(LOG_WARNING, "MESH: [ID %i] Instance buffer update out of capacity (%i instances)", buffer->vboId, buffer->capacity);
+        return;
+    }
+
+    unsigned char *instance = buffer->data + offset*buffer->stride;
+
+    for (int i = 0; i < count; i++, instance += buffer->stride)
+    {
+        if (transforms != NULL)
+        {
+            const Matrix *mat = &transforms[i];
+            float *values = (float *)instance;
+
+            values[0] = mat->m0; values[1] = mat->m1; values[2] = mat->m2; values[3] = mat->m3;
+            values[4] = mat->m4; values[5] = mat->m5; values[6] = mat->m6; values[7] = mat->m7;
+            values[8] = mat->m8; values[9] = mat->m9; values[10] = mat->m10; values[11] = mat->m11;
+            values[12] = mat->m12; values[13] = mat->m13; values[14] = mat->m14; values[15] = mat->m15;
+        }
+
+        if ((data != NULL) && (buffer->dataSize > 0)) memcpy(instance + 16*sizeof(float), (const unsigned char *)data + i*buffer->dataSize, buffer->dataSize);
+    }
+
+    if ((offset + count) > buffer->instanceCount) buffer->instanceCount = offset + count;
+
+    int segmentSize = buffer->capacity*buffer->stride;
+
+    switch (buffer->mode)
+    {
+        case INSTANCE_BUFFER_ORPHAN:
+        {
+            rlOrphanVertexBuffer(buffer->vboId, segmentSize, true);
+            rlUpdateVertexBuffer(buffer->vboId, buffer->data, buffer->instanceCount*buffer->stride, 0);
+        } break;
+        case INSTANCE_BUFFER_RING:
+        {
+            buffer->segment = (buffer->segment + 1)%INSTANCE_BUFFER_RING_SEGMENTS;
+            rlUpdateVertexBuffer(buffer->vboId, buffer->data, buffer->instanceCount*buffer->stride, buffer->segment*segmentSize);
+        } break;
+        default:
+        {
+            rlUpdateVertexBuffer(buffer->vboId, buffer->data + offset*buffer->stride, count*buffer->stride, offset*buffer->stride);
+        } break;
+    }
+
+    rlDisableVertexBuffer();
+}
+
+// Draw multiple mesh instances with material, using instance buffer data
+// NOTE: Instances [offset..offset + count) are drawn, transforms are sent to shader attribute SHADER_LOC_MATRIX_MODEL
+void RLDrawMeshInstancedBuffer(Mesh mesh, Material material, InstanceBuffer buffer, int offset, int count)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    if ((buffer.vboId == 0) || (count <= 0) || (offset < 0) || ((offset + count) > buffer.capacity)) return;
 
     // Bind shader program
     rlEnableShader(material.shader.id);
@@ -1719,27 +2028,32 @@ void RLDrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms,
     if (material.shader.locs[SHADER_LOC_MATRIX_VIEW] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_VIEW], matView);
     if (material.shader.locs[SHADER_LOC_MATRIX_PROJECTION] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_PROJECTION], matProjection);
 
-    // Create instances buffer
-    instanceTransforms = (float16 *)RL_MALLOC(instances*sizeof(float16));
-
-    // Fill buffer with instances transformations as float16 arrays
-    for (int i = 0; i < instances; i++) instanceTransforms[i] = RLMatrixToFloatV(transforms[i]);
-
-    // Enable mesh VAO to attach new buffer
+    // Enable mesh VAO to attach instance buffer
     rlEnableVertexArray(mesh.vaoId);
+    rlEnableVertexBuffer(buffer.vboId);
 
-    // This could alternatively use a static VBO and either glMapBuffer() or glBufferSubData()
-    // It isn't clear which would be reliably faster in all cases and on all platforms,
-    // anecdotally glMapBuffer() seems very slow (syncs) while glBufferSubData() seems
-    // no faster, since we're transferring all the transform matrices anyway
-    instancesVboId = rlLoadVertexBuffer(instanceTransforms, instances*sizeof(float16), false);
+    // Instances data position in buffer: current segment and first instance to draw
+    int instancesOffset = (buffer.segment*buffer.capacity + offset)*buffer.stride;
 
     // Instances transformation matrices are send to shader attribute location: SHADER_LOC_MATRIX_MODEL
-    for (unsigned int i = 0; i < 4; i++)
+    if (material.shader.locs[SHADER_LOC_MATRIX_MODEL] != -1)
+    {
+        for (unsigned int i = 0; i < 4; i++)
+        {
+            rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i);
+            rlSetVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 4, RL_FLOAT, 0, buffer.stride, instancesOffset + i*sizeof(Vector4));
+            rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 1);
+        }
+    }
+
+    // Instances custom attributes, placed after transform
+    for (int i = 0; i < buffer.attributeCount; i++)
     {
-        rlEnableVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i);
-        rlSetVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 4, RL_FLOAT, 0, sizeof(Matrix), i*sizeof(Vector4));
-        rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 1);
+        if (buffer.attributes[i].location == -1) continue;
+
+        rlEnableVertexAttribute(buffer.attributes[i].location);
+        rlSetVertexAttribute(buffer.attributes[i].location, buffer.attributes[i].type + 1, RL_FLOAT, 0, buffer.stride, instancesOffset + 16*sizeof(float) + buffer.attributes[i].offset);
+        rlSetVertexAttributeDivisor(buffer.attributes[i].location, 1);
     }
 
     rlDisableVertexBuffer();
@@ -1877,8 +2191,8 @@ void RLDrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms,
         rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
 
         // Draw mesh instanced
-        if (mesh.indices != NULL) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount*3, 0, instances);
-        else rlDrawVertexArrayInstanced(0, mesh.vertexCount, instances);
+        if (mesh.indices != NULL) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount*3, 0, count);
+        else rlDrawVertexArrayInstanced(0, mesh.vertexCount, count);
     }
 
     // Unbind all bound texture maps
@@ -1902,12 +2216,30 @@ void RLDrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms,
     rlDisableVertexBuffer();
     rlDisableVertexBufferElement();
 
+    // Disable instance attributes, mesh could be drawn later without instancing
+    rlEnableVertexArray(mesh.vaoId);
+
+    if (material.shader.locs[SHADER_LOC_MATRIX_MODEL] != -1)
+    {
+        for (unsigned int i = 0; i < 4; i++)
+        {
+            rlSetVertexAttributeDivisor(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i, 0);
+            rlDisableVertexAttribute(material.shader.locs[SHADER_LOC_MATRIX_MODEL] + i);
+        }
+    }
+
+    for (int i = 0; i < buffer.attributeCount; i++)
+    {
+        if (buffer.attributes[i].location == -1) continue;
+
+        rlSetVertexAttributeDivisor(buffer.attributes[i].location, 0);
+        rlDisableVertexAttribute(buffer.attributes[i].location);
+    }
+
+    rlDisableVertexArray();
+
     // Disable shader program
     rlDisableShader();
-
-    // Remove instance transforms buffer
-    rlUnloadVertexBuffer(instancesVboId);
-    RL_FREE(instanceTransforms);
 #endif
 }
 
@@ -2258,6 +2590,23 @@ ModelAnimation * RLLoadModelAnimations(const char *fileName, int *animCount)
 #if defined(SUPPORT_FILEFORMAT_GLTF)
     if (RLIsFileExtension(fileName, ".gltf;.glb")) animations = RLLoadModelAnimationsGLTF(fileName, animCount);
 #endif
+#if defined(SUPPORT_FILEFORMAT_RANIM)
+    if (RLIsFileExtension(fileName, ".ranim"))
+    {
+        ModelAnimationCompressed *compressed = RLLoadModelAnimationsCompressed(fileName, animCount);
+
+        if (compressed != NULL)
+        {
+            animations = (ModelAnimation *)RL_CALLOC(*animCount, sizeof(ModelAnimation));
+
+            if (animations != NULL) for (int i = 0; i < *animCount; i++) animations[i] = RLDecompressModelAnimation(compressed[i]);
+            else TRACELOG(LOG_WARNING, "ANIM: [%s] Failed to allocate memory for animations", fileName);
+
+            RLUnloadModelAnimationsCompressed(compressed, *animCount);
+            if (animations == NULL) *animCount = 0;
+        }
+    }
+#endif
 
     return animations;
 }
@@ -2273,100 +2622,245 @@ void RLUpdateModelAnimationBones(Model model, ModelAnimation anim, int frame)
 
         for (int i = 0; i < model.meshCount; i++)
         {
-            if (model.meshes[i].boneMatrices)
-            {
-                assert(model.meshes[i].boneCount == anim.boneCount);
-
-                for (int boneId = 0; boneId < model.meshes[i].boneCount; boneId++)
-                {
-                    Vector3 inTranslation = model.bindPose[boneId].translation;
-                    Quaternion inRotation = model.bindPose[boneId].rotation;
-                    Vector3 inScale = model.bindPose[boneId].scale;
-
-                    Vector3 outTranslation = anim.framePoses[frame][boneId].translation;
-                    Quaternion outRotation = anim.framePoses[frame][boneId].rotation;
-                    Vector3 outScale = anim.framePoses[frame][boneId].scale;
-
-                    Vector3 invTranslation = RLVector3RotateByQuaternion(RLVector3Negate(inTranslation), RLQuaternionInvert(inRotation));
-                    Quaternion invRotation = RLQuaternionInvert(inRotation);
-                    Vector3 invScale = RLVector3Divide((Vector3){ 1.0f, 1.0f, 1.0f }, inScale);
-
-                    Vector3 boneTranslation = RLVector3Add(
-                        RLVector3RotateByQuaternion(RLVector3Multiply(outScale, invTranslation),
-                        outRotation), outTranslation);
-                    Quaternion boneRotation = RLQuaternionMultiply(outRotation, invRotation);
-                    Vector3 boneScale = RLVector3Multiply(outScale, invScale);
-
-                    Matrix boneMatrix = RLMatrixMultiply(RLMatrixMultiply(
-                        RLQuaternionToMatrix(boneRotation),
-                        RLMatrixTranslate(boneTranslation.x, boneTranslation.y, boneTranslation.z)),
-                        RLMatrixScale(boneScale.x, boneScale.y, boneScale.z));
-
-                    model.meshes[i].boneMatrices[boneId] = boneMatrix;
-                }
-            }
+            if (model.meshes[i].boneMatrices) assert(model.meshes[i].boneCount == anim.boneCount);
         }
+
+        RLUpdateModelAnimationPoseBones(model, anim.framePoses[frame]);
     }
 }
 
-// at least 2x speed up vs the old method 
 // Update model animated vertex data (positions and normals) for a given frame
-// NOTE: Updated data is uploaded to GPU
+// NOTE: Updated data is uploaded to GPU, vertices are skinned by blending up-to 4 bone matrices
+// per vertex, using SIMD kernels (if supported) and splitting big meshes across worker threads
+// WARNING: Must be called from main thread (GPU upload and shared skinning scratch buffer)
 void RLUpdateModelAnimation(Model model, ModelAnimation anim, int frame)
 {
-    RLUpdateModelAnimationBones(model,anim,frame);
-    for (int m = 0; m < model.meshCount; m++)
+    double startTime = RLGetTime();
+
+    RLUpdateModelAnimationBones(model, anim, frame);
+    RLUpdateModelSkinning(model);
+
+    skinningTime = RLGetTime() - startTime;
+}
+
+// Update model mesh bone matrices from a pose (model-space bone transforms, one per model bone)
+// NOTE: Pose can be obtained with SampleModelAnimation(), BlendModelAnimations() or BlendModelAnimationLayer(),
+// bone matrices are computed once and shared by all meshes with the same bone count
+void RLUpdateModelAnimationPoseBones(Model model, const Transform *pose)
+{
+    if ((pose == NULL) || (model.bindPose == NULL)) return;
+
+    const Matrix *computed = NULL;
+    int computedCount = 0;
+
+    for (int i = 0; i < model.meshCount; i++)
     {
-        Mesh mesh = model.meshes[m];
-        Vector3 animVertex = { 0 };
-        Vector3 animNormal = { 0 };
-        int boneId = 0;
-        int boneCounter = 0;
-        float boneWeight = 0.0;
-        bool updated = false;           // Flag to check when anim vertex information is updated
-        const int vValues = mesh.vertexCount*3;
-        for (int vCounter = 0; vCounter < vValues; vCounter += 3)
-        {
-            mesh.animVertices[vCounter] = 0;
-            mesh.animVertices[vCounter + 1] = 0;
-            mesh.animVertices[vCounter + 2] = 0;
-            if (mesh.animNormals != NULL)
+        Matrix *boneMatrices = model.meshes[i].boneMatrices;
+        int boneCount = model.meshes[i].boneCount;
+
+        if (boneMatrices == NULL) continue;
+
+        if ((computed != NULL) && (computedCount == boneCount))
+        {
+            memcpy(boneMatrices, computed, boneCount*sizeof(Matrix));
+            continue;
+        }
+
+        for (int boneId = 0; boneId < boneCount; boneId++)
+        {
+            Vector3 inTranslation = model.bindPose[boneId].translation;
+            Quaternion inRotation = model.bindPose[boneId].rotation;
+            Vector3 inScale = model.bindPose[boneId].scale;
+
+            Vector3 outTranslation = pose[boneId].translation;
+            Quaternion outRotation = pose[boneId].rotation;
+            Vector3 outScale = pose[boneId].scale;
+
+            Vector3 invTranslation = RLVector3RotateByQuaternion(RLVector3Negate(inTranslation), RLQuaternionInvert(inRotation));
+            Quaternion invRotation = RLQuaternionInvert(inRotation);
+            Vector3 invScale = RLVector3Divide((Vector3){ 1.0f, 1.0f, 1.0f }, inScale);
+
+            Vector3 boneTranslation = RLVector3Add(
+                RLVector3RotateByQuaternion(RLVector3Multiply(outScale, invTranslation),
+                outRotation), outTranslation);
+            Quaternion boneRotation = RLQuaternionMultiply(outRotation, invRotation);
+            Vector3 boneScale = RLVector3Multiply(outScale, invScale);
+
+            Matrix boneMatrix = RLMatrixMultiply(RLMatrixMultiply(
+                RLQuaternionToMatrix(boneRotation),
+                RLMatrixTranslate(boneTranslation.x, boneTranslation.y, boneTranslation.z)),
+                RLMatrixScale(boneScale.x, boneScale.y, boneScale.z));
+
+            boneMatrices[boneId] = boneMatrix;
+        }
+
+        computed = boneMatrices;
+        computedCount = boneCount;
+    }
+}
+
+// Update model animated vertex data (positions and normals) from a pose (model-space bone transforms)
+// NOTE: Updated data is uploaded to GPU
+// WARNING: Must be called from main thread (GPU upload and shared skinning scratch buffer)
+void RLUpdateModelAnimationPose(Model model, const Transform *pose)
+{
+    double startTime = RLGetTime();
+
+    RLUpdateModelAnimationPoseBones(model, pose);
+    RLUpdateModelSkinning(model);
+
+    skinningTime = RLGetTime() - startTime;
+}
+
+// Sample model animation pose at a fractional frame, interpolating between consecutive frames
+// NOTE: Translation and scale are linearly interpolated and rotation spherically interpolated,
+// frame is wrapped around frameCount (last frame interpolates into first one), pose must hold anim.boneCount transforms
+void RLSampleModelAnimation(ModelAnimation anim, float frame, Transform *pose)
+{
+    if ((anim.frameCount <= 0) || (anim.framePoses == NULL) || (pose == NULL)) return;
+
+    // NOTE: Non finite frames (NaN, infinity) can not be wrapped, first frame is sampled
+    if (!isfinite(frame)) frame = 0.0f;
+
+    float wrapped = fmodf(frame, (float)anim.frameCount);
+    if (wrapped < 0.0f) wrapped += (float)anim.frameCount;
+
+    int frame0 = (int)wrapped;
+    if (frame0 >= anim.frameCount) frame0 = anim.frameCount - 1;
+    int frame1 = (frame0 + 1)%anim.frameCount;
+    float amount = wrapped - (float)frame0;
+
+    const Transform *pose0 = anim.framePoses[frame0];
+    const Transform *pose1 = anim.framePoses[frame1];
+
+    if ((amount <= 0.0f) || (frame0 == frame1))
+    {
+        memcpy(pose, pose0, anim.boneCount*sizeof(Transform));
+        return;
+    }
+
+    for (int i = 0; i < anim.boneCount; i++)
+    {
+        pose[i].translation = RLVector3Lerp(pose0[i].translation, pose1[i].translation, amount);
+        pose[i].rotation = RLQuaternionSlerp(pose0[i].rotation, pose1[i].rotation, amount);
+        pose[i].scale = RLVector3Lerp(pose0[i].scale, pose1[i].scale, amount);
+    }
+}
+
+// Sample multiple model animations (same skeleton) at fractional frames and blend them by weight
+// NOTE: Weights are normalized, rotations are blended as a normalized weighted quaternions sum (hemisphere aligned),
+// no shared state is used, so poses can be blended from worker threads
+void RLBlendModelAnimations(const ModelAnimation *animations, const float *frames, const float *weights, int count, Transform *pose)
+{
+    if ((animations == NULL) || (frames == NULL) || (weights == NULL) || (count <= 0) || (pose == NULL)) return;
+
+    int boneCount = animations[0].boneCount;
+    float totalWeight = 0.0f;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (animations[i].boneCount != boneCount)
+        {
+            TRACELOG(LOG_WARNING, "ANIM: Animations to blend must share skeleton (%i bones, %i bones)", boneCount, animations[i].boneCount);
+            return;
+        }
+
+        // NOTE: Animations with no frames can not be sampled, they are skipped
+        if ((weights[i] > 0.0f) && (animations[i].frameCount > 0) && (animations[i].framePoses != NULL)) totalWeight += weights[i];
+    }
+
+    if (totalWeight <= 0.0f) return;
+
+    Transform stackSample[BLEND_POSE_STACK_BONES];
+    Transform *sample = (boneCount <= BLEND_POSE_STACK_BONES)? stackSample : (Transform *)RL_MALLOC(boneCount*sizeof(Transform));
+    if (sample == NULL) return;
+
+    bool first = true;
+
+    for (int i = 0; i < count; i++)
+    {
+        if ((weights[i] <= 0.0f) || (animations[i].frameCount <= 0) || (animations[i].framePoses == NULL)) continue;
+
+        float weight = weights[i]/totalWeight;
+        RLSampleModelAnimation(animations[i], frames[i], sample);
+
+        for (int b = 0; b < boneCount; b++)
+        {
+            Quaternion q = sample[b].rotation;
+
+            if (first)
             {
-                mesh.animNormals[vCounter] = 0;
-                mesh.animNormals[vCounter + 1] = 0;
-                mesh.animNormals[vCounter + 2] = 0;
+                pose[b].translation = RLVector3Scale(sample[b].translation, weight);
+                pose[b].rotation = RLQuaternionScale(q, weight);
+                pose[b].scale = RLVector3Scale(sample[b].scale, weight);
             }
-                // Iterates over 4 bones per vertex
-            for (int j = 0; j < 4; j++, boneCounter++)
+            else
             {
-                boneWeight = mesh.boneWeights[boneCounter];
-                boneId = mesh.boneIds[boneCounter];
-                // Early stop when no transformation will be applied
-                if (boneWeight == 0.0f) continue;
-                animVertex = (Vector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
-                animVertex = RLVector3Transform(animVertex,model.meshes[m].boneMatrices[boneId]);
-                mesh.animVertices[vCounter] += animVertex.x * boneWeight;
-                mesh.animVertices[vCounter+1] += animVertex.y * boneWeight;
-                mesh.animVertices[vCounter+2] += animVertex.z * boneWeight;
-                updated = true;
-                // Normals processing
-                // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-                if (mesh.normals != NULL)
-                {
-                    animNormal = (Vector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
-                    animNormal = RLVector3Transform(animNormal,model.meshes[m].boneMatrices[boneId]);
-                    mesh.animNormals[vCounter] += animNormal.x*boneWeight;
-                    mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
-                    mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
-                }
+                // Keep all rotations on the same hemisphere than accumulated one
+                Quaternion acc = pose[b].rotation;
+                if ((acc.x*q.x + acc.y*q.y + acc.z*q.z + acc.w*q.w) < 0.0f) q = RLQuaternionScale(q, -1.0f);
+
+                pose[b].translation = RLVector3Add(pose[b].translation, RLVector3Scale(sample[b].translation, weight));
+                pose[b].rotation = RLQuaternionAdd(pose[b].rotation, RLQuaternionScale(q, weight));
+                pose[b].scale = RLVector3Add(pose[b].scale, RLVector3Scale(sample[b].scale, weight));
             }
         }
-        if (updated)
+
+        first = false;
+    }
+
+    for (int b = 0; b < boneCount; b++) pose[b].rotation = RLQuaternionNormalize(pose[b].rotation);
+
+    if (sample != stackSample) RL_FREE(sample);
+}
+
+// Sample model animation at a fractional frame and blend it over an existing pose (animation layer)
+// NOTE: Every bone is interpolated towards sampled pose by weight*boneMask[bone], boneMask (one value per bone)
+// allows layering partial animations (i.e. upper-body only), if NULL, weight is applied to all bones,
+// no shared state is used, so layers can be blended from worker threads
+void RLBlendModelAnimationLayer(ModelAnimation anim, float frame, float weight, const float *boneMask, Transform *pose)
+{
+    if ((pose == NULL) || (weight <= 0.0f) || (anim.frameCount <= 0) || (anim.framePoses == NULL)) return;
+
+    Transform stackSample[BLEND_POSE_STACK_BONES];
+    Transform *sample = (anim.boneCount <= BLEND_POSE_STACK_BONES)? stackSample : (Transform *)RL_MALLOC(anim.boneCount*sizeof(Transform));
+    if (sample == NULL) return;
+
+    RLSampleModelAnimation(anim, frame, sample);
+
+    for (int b = 0; b < anim.boneCount; b++)
+    {
+        float amount = (boneMask != NULL)? weight*boneMask[b] : weight;
+
+        if (amount <= 0.0f) continue;
+        if (amount >= 1.0f)
         {
-            rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
-            rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
+            pose[b] = sample[b];
+            continue;
         }
+
+        pose[b].translation = RLVector3Lerp(pose[b].translation, sample[b].translation, amount);
+        pose[b].rotation = RLQuaternionSlerp(pose[b].rotation, sample[b].rotation, amount);
+        pose[b].scale = RLVector3Lerp(pose[b].scale, sample[b].scale, amount);
     }
+
+    if (sample != stackSample) RL_FREE(sample);
+}
+
+// Get number of vertices skinned on last UpdateModelAnimation() call
+int RLGetModelAnimationVertexCount(void)
+{
+    return skinnedVertexCount;
+}
+
+// Get CPU skinning throughput of last UpdateModelAnimation() call, in vertices per second
+float RLGetModelAnimationVertexRate(void)
+{
+    float rate = 0.0f;
+
+    if (skinningTime > 0.0) rate = (float)(skinnedVertexCount/skinningTime);
+
+    return rate;
 }
 
 // Unload animation array data
@@ -2383,6 +2877,7 @@ void RLUnloadModelAnimation(ModelAnimation anim)
 
     RL_FREE(anim.bones);
     RL_FREE(anim.framePoses);
+    RLUnloadSkinningPalette();
 }
 
 // Check model animation skeleton match
@@ -2403,68 +2898,404 @@ bool RLIsModelAnimationValid(Model model, ModelAnimation anim)
     return result;
 }
 
-#if defined(SUPPORT_MESH_GENERATION)
-// Generate polygonal mesh
-Mesh RLGenMeshPoly(int sides, float radius)
+// Compress model animation: quantized tracks, constant tracks elision and keyframe reduction
+// NOTE: Tolerance is the maximum error allowed (units for translation/scale, radians for rotation), it includes
+// quantization error, keyframes are removed while interpolation plus quantization error stays within tolerance,
+// rotations are quantized with smallest-three encoding (48 bit), translation/scale with 16 bit per component within track range
+ModelAnimationCompressed RLCompressModelAnimation(ModelAnimation anim, float tolerance)
 {
-    Mesh mesh = { 0 };
+    ModelAnimationCompressed result = { 0 };
 
-    if (sides < 3) return mesh; // Security check
-
-    int vertexCount = sides*3;
-
-    // Vertices definition
-    Vector3 *vertices = (Vector3 *)RL_MALLOC(vertexCount*sizeof(Vector3));
+    if ((anim.boneCount <= 0) || (anim.frameCount <= 0) || (anim.framePoses == NULL))
+    {
+        TRACELOG(LOG_WARNING, "ANIM: Animation data not valid for compression");
+        return result;
+    }
 
-    float d = 0.0f, dStep = 360.0f/sides;
-    for (int v = 0; v < vertexCount - 2; v += 3)
+    if (anim.frameCount > 65535)
     {
-        vertices[v] = (Vector3){ 0.0f, 0.0f, 0.0f };
-        vertices[v + 1] = (Vector3){ sinf(DEG2RAD*d)*radius, 0.0f, cosf(DEG2RAD*d)*radius };
-        vertices[v + 2] = (Vector3){ sinf(DEG2RAD*(d+dStep))*radius, 0.0f, cosf(DEG2RAD*(d+dStep))*radius };
-        d += dStep;
+        TRACELOG(LOG_WARNING, "ANIM: [%s] Animation frames count (%i) not supported for compression", anim.name, anim.frameCount);
+        return result;
     }
 
-    // Normals definition
-    Vector3 *normals = (Vector3 *)RL_MALLOC(vertexCount*sizeof(Vector3));
-    for (int n = 0; n < vertexCount; n++) normals[n] = (Vector3){ 0.0f, 1.0f, 0.0f };   // Vector3.up;
+    if (tolerance < 0.0f) tolerance = 0.0f;
 
-    // TexCoords definition
-    Vector2 *texcoords = (Vector2 *)RL_MALLOC(vertexCount*sizeof(Vector2));
-    for (int n = 0; n < vertexCount; n++) texcoords[n] = (Vector2){ 0.0f, 0.0f };
+    int frameCount = anim.frameCount;
 
-    mesh.vertexCount = vertexCount;
-    mesh.triangleCount = sides;
-    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
-    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
-    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    // Worst case size: tracks offsets + per track header, range and all keyframes (frame + 3 quantized components)
+    // NOTE: Sizes are computed in size_t, compressed data size must fit on an int (ModelAnimationCompressed.dataSize)
+    size_t trackCount = (size_t)anim.boneCount*3;
+    size_t maxTrackSize = 4 + 24 + (size_t)frameCount*2 + (size_t)frameCount*6 + 4;
 
-    // Mesh vertices position array
-    for (int i = 0; i < mesh.vertexCount; i++)
+    if (trackCount > (SIZE_MAX/(4 + maxTrackSize)))
     {
-        mesh.vertices[3*i] = vertices[i].x;
-        mesh.vertices[3*i + 1] = vertices[i].y;
-        mesh.vertices[3*i + 2] = vertices[i].z;
+        TRACELOG(LOG_WARNING, "ANIM: [%s] Animation too big for compression", anim.name);
+        return result;
     }
 
-    // Mesh texcoords array
-    for (int i = 0; i < mesh.vertexCount; i++)
+    unsigned char *data = (unsigned char *)RL_CALLOC(trackCount*4 + trackCount*maxTrackSize, 1);
+    float *values = (float *)RL_MALLOC((size_t)frameCount*4*sizeof(float));
+    unsigned short *keys = (unsigned short *)RL_MALLOC((size_t)frameCount*sizeof(unsigned short));
+    BoneInfo *bones = (BoneInfo *)RL_MALLOC(anim.boneCount*sizeof(BoneInfo));
+
+    if ((data == NULL) || (values == NULL) || (keys == NULL) || (bones == NULL))
     {
-        mesh.texcoords[2*i] = texcoords[i].x;
-        mesh.texcoords[2*i + 1] = texcoords[i].y;
+        TRACELOG(LOG_WARNING, "ANIM: [%s] Failed to allocate memory for animation compression", anim.name);
+        RL_FREE(data);
+        RL_FREE(values);
+        RL_FREE(keys);
+        RL_FREE(bones);
+        return result;
     }
 
-    // Mesh normals array
-    for (int i = 0; i < mesh.vertexCount; i++)
+    size_t size = trackCount*4;
+
+    for (int b = 0; b < anim.boneCount; b++)
     {
-        mesh.normals[3*i] = normals[i].x;
-        mesh.normals[3*i + 1] = normals[i].y;
-        mesh.normals[3*i + 2] = normals[i].z;
-    }
+        for (int kind = 0; kind < 3; kind++)
+        {
+            unsigned int offset = (unsigned int)size;
+            memcpy(data + ((size_t)b*3 + kind)*4, &offset, 4);
 
-    RL_FREE(vertices);
-    RL_FREE(normals);
-    RL_FREE(texcoords);
+            for (int f = 0; f < frameCount; f++)
+            {
+                Transform transform = anim.framePoses[f][b];
+
+                if (kind == ANIM_TRACK_TRANSLATION) memcpy(values + f*3, &transform.translation, 3*sizeof(float));
+                else if (kind == ANIM_TRACK_SCALE) memcpy(values + f*3, &transform.scale, 3*sizeof(float));
+                else
+                {
+                    // Keep rotations normalized and continuous (same hemisphere than previous frame)
+                    Quaternion q = RLQuaternionNormalize(transform.rotation);
+                    if ((f > 0) && ((values[(f - 1)*4]*q.x + values[(f - 1)*4 + 1]*q.y + values[(f - 1)*4 + 2]*q.z + values[(f - 1)*4 + 3]*q.w) < 0.0f)) q = RLQuaternionScale(q, -1.0f);
+                    memcpy(values + f*4, &q, 4*sizeof(float));
+                }
+            }
+
+            size += RLEncodeAnimationTrack(data + size, kind, values, frameCount, tolerance, keys);
+        }
+    }
+
+    RL_FREE(values);
+    RL_FREE(keys);
+
+    if (size > INT_MAX)
+    {
+        TRACELOG(LOG_WARNING, "ANIM: [%s] Compressed animation data too big", anim.name);
+        RL_FREE(data);
+        RL_FREE(bones);
+        return result;
+    }
+
+    // Shrink data to its final size, if reallocation fails, bigger buffer is kept
+    unsigned char *shrunk = (unsigned char *)RL_REALLOC(data, size);
+    if (shrunk != NULL) data = shrunk;
+
+    result.boneCount = anim.boneCount;
+    result.frameCount = anim.frameCount;
+    result.data = data;
+    result.dataSize = (int)size;
+    result.bones = bones;
+    if (anim.bones != NULL) memcpy(result.bones, anim.bones, anim.boneCount*sizeof(BoneInfo));
+    else memset(result.bones, 0, anim.boneCount*sizeof(BoneInfo));
+    memcpy(result.name, anim.name, sizeof(result.name));
+
+    TRACELOG(LOG_INFO, "ANIM: [%s] Animation compressed successfully (%i bytes -> %i bytes)", anim.name,
+        (int)(anim.frameCount*anim.boneCount*sizeof(Transform)), result.dataSize);
+
+    return result;
+}
+
+// Decompress model animation into full sampled frame poses
+ModelAnimation RLDecompressModelAnimation(ModelAnimationCompressed anim)
+{
+    ModelAnimation result = { 0 };
+
+    if ((anim.boneCount <= 0) || (anim.frameCount <= 0) || (anim.data == NULL)) return result;
+
+    result.boneCount = anim.boneCount;
+    result.frameCount = anim.frameCount;
+    result.bones = (BoneInfo *)RL_MALLOC(anim.boneCount*sizeof(BoneInfo));
+    if (anim.bones != NULL) memcpy(result.bones, anim.bones, anim.boneCount*sizeof(BoneInfo));
+    else memset(result.bones, 0, anim.boneCount*sizeof(BoneInfo));
+    memcpy(result.name, anim.name, sizeof(result.name));
+
+    result.framePoses = (Transform **)RL_MALLOC(anim.frameCount*sizeof(Transform *));
+    for (int f = 0; f < anim.frameCount; f++)
+    {
+        result.framePoses[f] = (Transform *)RL_MALLOC(anim.boneCount*sizeof(Transform));
+        RLSampleModelAnimationCompressed(anim, (float)f, result.framePoses[f]);
+    }
+
+    return result;
+}
+
+// Sample compressed model animation pose at a fractional frame, decompressing required keyframes on the fly
+// NOTE: Same behaviour as SampleModelAnimation(), frame is wrapped around frameCount
+void RLSampleModelAnimationCompressed(ModelAnimationCompressed anim, float frame, Transform *pose)
+{
+    if ((anim.frameCount <= 0) || (anim.data == NULL) || (pose == NULL)) return;
+
+    // NOTE: Non finite frames (NaN, infinity) can not be wrapped, first frame is sampled
+    if (!isfinite(frame)) frame = 0.0f;
+
+    float wrapped = fmodf(frame, (float)anim.frameCount);
+    if (wrapped < 0.0f) wrapped += (float)anim.frameCount;
+
+    // Between last and first frame (looping), both ends are decoded and interpolated
+    float lastFrame = (float)(anim.frameCount - 1);
+    float loopAmount = (wrapped > lastFrame)? (wrapped - lastFrame) : 0.0f;
+    if (loopAmount > 0.0f) wrapped = lastFrame;
+
+    for (int b = 0; b < anim.boneCount; b++)
+    {
+        float value[3][4] = { 0 };
+
+        for (int kind = 0; kind < 3; kind++)
+        {
+            unsigned int offset = 0;
+            memcpy(&offset, anim.data + (b*3 + kind)*4, 4);
+            RLDecodeAnimationTrack(anim.data + offset, kind, wrapped, value[kind]);
+
+            if (loopAmount > 0.0f)
+            {
+                float first[4] = { 0 };
+                RLDecodeAnimationTrack(anim.data + offset, kind, 0.0f, first);
+
+                if (kind == ANIM_TRACK_ROTATION)
+                {
+                    Quaternion q = RLQuaternionSlerp((Quaternion){ value[kind][0], value[kind][1], value[kind][2], value[kind][3] },
+                        (Quaternion){ first[0], first[1], first[2], first[3] }, loopAmount);
+                    memcpy(value[kind], &q, 4*sizeof(float));
+                }
+                else
+                {
+                    for (int c = 0; c < 3; c++) value[kind][c] += (first[c] - value[kind][c])*loopAmount;
+                }
+            }
+        }
+
+        pose[b].translation = (Vector3){ value[0][0], value[0][1], value[0][2] };
+        pose[b].rotation = (Quaternion){ value[1][0], value[1][1], value[1][2], value[1][3] };
+        pose[b].scale = (Vector3){ value[2][0], value[2][1], value[2][2] };
+    }
+}
+
+// Unload compressed animation data
+void RLUnloadModelAnimationCompressed(ModelAnimationCompressed anim)
+{
+    RL_FREE(anim.bones);
+    RL_FREE(anim.data);
+}
+
+// Unload compressed animation array data
+void RLUnloadModelAnimationsCompressed(ModelAnimationCompressed *animations, int animCount)
+{
+    for (int i = 0; i < animCount; i++) RLUnloadModelAnimationCompressed(animations[i]);
+    RL_FREE(animations);
+}
+
+// Load compressed model animations from file (.ranim)
+// NOTE: File layout: "rANM" id, version, animations count and, for every animation:
+// name[32], boneCount, frameCount, dataSize, bones[boneCount], data[dataSize]
+ModelAnimationCompressed *RLLoadModelAnimationsCompressed(const char *fileName, int *animCount)
+{
+    ModelAnimationCompressed *animations = NULL;
+    *animCount = 0;
+
+    MappedFile file = RLLoadMappedFile(fileName);
+    const unsigned char *fileData = file.data;
+    int fileSize = (file.size <= 2147483647)? (int)file.size : 0;   // NOTE: Bigger files are not valid
+
+    if (fileData == NULL) return NULL;
+
+    int header[3] = { 0 };  // id, version, animCount
+
+    if ((fileSize < 12) || (memcmp(fileData, "rANM", 4) != 0))
+    {
+        TRACELOG(LOG_WARNING, "ANIM: [%s] File is not a valid compressed animations file", fileName);
+        RLUnloadMappedFile(file);
+        return NULL;
+    }
+
+    memcpy(header, fileData, 12);
+
+    if (header[1] != ANIMATION_COMPRESSED_FILE_VERSION)
+    {
+        TRACELOG(LOG_WARNING, "ANIM: [%s] Compressed animations file version not supported (%i)", fileName, header[1]);
+        RLUnloadMappedFile(file);
+        return NULL;
+    }
+
+    int count = header[2];
+    int offset = 12;
+
+    if ((count > 0) && (count <= fileSize/48)) animations = (ModelAnimationCompressed *)RL_CALLOC(count, sizeof(ModelAnimationCompressed));
+
+    for (int i = 0; (animations != NULL) && (i < count); i++)
+    {
+        ModelAnimationCompressed *anim = &animations[i];
+        int info[3] = { 0 };    // boneCount, frameCount, dataSize
+        bool valid = ((fileSize - offset) >= 44);
+
+        if (valid)
+        {
+            memcpy(anim->name, fileData + offset, 32);
+            anim->name[31] = '\0';
+            memcpy(info, fileData + offset + 32, 12);
+            offset += 44;
+
+            // NOTE: Bones count is bounded by file size before any multiplication
+            valid = (info[0] > 0) && (info[1] > 0) && (info[1] <= 65535) &&
+                    (info[0] <= (fileSize - offset)/(int)sizeof(BoneInfo)) && (info[2] >= info[0]*12) &&
+                    (info[2] <= (fileSize - offset - info[0]*(int)sizeof(BoneInfo)));
+        }
+
+        if (valid)
+        {
+            anim->boneCount = info[0];
+            anim->frameCount = info[1];
+            anim->dataSize = info[2];
+            anim->bones = (BoneInfo *)RL_MALLOC(anim->boneCount*sizeof(BoneInfo));
+            anim->data = (unsigned char *)RL_MALLOC(anim->dataSize);
+            valid = (anim->bones != NULL) && (anim->data != NULL);
+        }
+
+        if (valid)
+        {
+            memcpy(anim->bones, fileData + offset, anim->boneCount*sizeof(BoneInfo));
+            offset += anim->boneCount*sizeof(BoneInfo);
+            memcpy(anim->data, fileData + offset, anim->dataSize);
+            offset += anim->dataSize;
+
+            // Validate all tracks, data is sampled without further checks
+            for (int t = 0; valid && (t < anim->boneCount*3); t++)
+            {
+                unsigned int trackOffset = 0;
+                memcpy(&trackOffset, anim->data + t*4, 4);
+                valid = (trackOffset >= (unsigned int)(anim->boneCount*12)) && (trackOffset < (unsigned int)anim->dataSize) &&
+                        (RLGetAnimationTrackSize(anim->data + trackOffset, t%3, anim->dataSize - trackOffset, anim->frameCount) > 0);
+            }
+        }
+
+        if (!valid)
+        {
+            TRACELOG(LOG_WARNING, "ANIM: [%s] Compressed animation %i data is not valid", fileName, i);
+            RLUnloadModelAnimationsCompressed(animations, i + 1);
+            animations = NULL;
+            break;
+        }
+    }
+
+    if (animations != NULL)
+    {
+        *animCount = count;
+        TRACELOG(LOG_INFO, "ANIM: [%s] Compressed animations loaded successfully (%i animations)", fileName, count);
+    }
+
+    RLUnloadMappedFile(file);
+
+    return animations;
+}
+
+// Export compressed model animations to file (.ranim)
+bool RLExportModelAnimationsCompressed(const ModelAnimationCompressed *animations, int animCount, const char *fileName)
+{
+    bool success = false;
+
+    if ((animations == NULL) || (animCount <= 0)) return success;
+
+    int fileSize = 12;
+    for (int i = 0; i < animCount; i++) fileSize += 44 + animations[i].boneCount*sizeof(BoneInfo) + animations[i].dataSize;
+
+    unsigned char *fileData = (unsigned char *)RL_CALLOC(fileSize, 1);
+    int header[3] = { 0, ANIMATION_COMPRESSED_FILE_VERSION, animCount };
+    memcpy(header, "rANM", 4);
+    memcpy(fileData, header, 12);
+
+    int offset = 12;
+    for (int i = 0; i < animCount; i++)
+    {
+        int info[3] = { animations[i].boneCount, animations[i].frameCount, animations[i].dataSize };
+
+        memcpy(fileData + offset, animations[i].name, 32);
+        memcpy(fileData + offset + 32, info, 12);
+        offset += 44;
+        memcpy(fileData + offset, animations[i].bones, animations[i].boneCount*sizeof(BoneInfo));
+        offset += animations[i].boneCount*sizeof(BoneInfo);
+        memcpy(fileData + offset, animations[i].data, animations[i].dataSize);
+        offset += animations[i].dataSize;
+    }
+
+    success = RLSaveFileData(fileName, fileData, fileSize);
+
+    RL_FREE(fileData);
+
+    return success;
+}
+
+#if defined(SUPPORT_MESH_GENERATION)
+// Generate polygonal mesh
+Mesh RLGenMeshPoly(int sides, float radius)
+{
+    Mesh mesh = { 0 };
+
+    if (sides < 3) return mesh; // Security check
+
+    int vertexCount = sides*3;
+
+    // Vertices definition
+    Vector3 *vertices = (Vector3 *)RL_MALLOC(vertexCount*sizeof(Vector3));
+
+    float d = 0.0f, dStep = 360.0f/sides;
+    for (int v = 0; v < vertexCount - 2; v += 3)
+    {
+        vertices[v] = (Vector3){ 0.0f, 0.0f, 0.0f };
+        vertices[v + 1] = (Vector3){ sinf(DEG2RAD*d)*radius, 0.0f, cosf(DEG2RAD*d)*radius };
+        vertices[v + 2] = (Vector3){ sinf(DEG2RAD*(d+dStep))*radius, 0.0f, cosf(DEG2RAD*(d+dStep))*radius };
+        d += dStep;
+    }
+
+    // Normals definition
+    Vector3 *normals = (Vector3 *)RL_MALLOC(vertexCount*sizeof(Vector3));
+    for (int n = 0; n < vertexCount; n++) normals[n] = (Vector3){ 0.0f, 1.0f, 0.0f };   // Vector3.up;
+
+    // TexCoords definition
+    Vector2 *texcoords = (Vector2 *)RL_MALLOC(vertexCount*sizeof(Vector2));
+    for (int n = 0; n < vertexCount; n++) texcoords[n] = (Vector2){ 0.0f, 0.0f };
+
+    mesh.vertexCount = vertexCount;
+    mesh.triangleCount = sides;
+    mesh.vertices = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+    mesh.texcoords = (float *)RL_MALLOC(mesh.vertexCount*2*sizeof(float));
+    mesh.normals = (float *)RL_MALLOC(mesh.vertexCount*3*sizeof(float));
+
+    // Mesh vertices position array
+    for (int i = 0; i < mesh.vertexCount; i++)
+    {
+        mesh.vertices[3*i] = vertices[i].x;
+        mesh.vertices[3*i + 1] = vertices[i].y;
+        mesh.vertices[3*i + 2] = vertices[i].z;
+    }
+
+    // Mesh texcoords array
+    for (int i = 0; i < mesh.vertexCount; i++)
+    {
+        mesh.texcoords[2*i] = texcoords[i].x;
+        mesh.texcoords[2*i + 1] = texcoords[i].y;
+    }
+
+    // Mesh normals array
+    for (int i = 0; i < mesh.vertexCount; i++)
+    {
+        mesh.normals[3*i] = normals[i].x;
+        mesh.normals[3*i + 1] = normals[i].y;
+        mesh.normals[3*i + 2] = normals[i].z;
+    }
+
+    RL_FREE(vertices);
+    RL_FREE(normals);
+    RL_FREE(texcoords);
 
     // Upload vertex data to GPU (static mesh)
     // NOTE: mesh.vboId array is allocated inside UploadMesh()
@@ -4037,6 +4868,8 @@ RayCollision RLGetRayCollisionBox(Ray ray, BoundingBox box)
 }
 
 // Get collision info between ray and mesh
+// NOTE: Ray is transformed once into mesh space, instead of transforming all mesh vertices,
+// use LoadMeshBVH() and GetRayCollisionMeshBVH() to avoid testing all triangles for static meshes
 RayCollision RLGetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
 {
     RayCollision collision = { 0 };
@@ -4045,36 +4878,73 @@ RayCollision RLGetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
     if (mesh.vertices != NULL)
     {
         int triangleCount = mesh.triangleCount;
+        Vector3 *vertdata = (Vector3 *)mesh.vertices;
+        float det = RLMatrixDeterminant(transform);
 
-        // Test against all triangles in mesh
-        for (int i = 0; i < triangleCount; i++)
+        if (fabsf(det) > 0.0f)
         {
-            Vector3 a, b, c;
-            Vector3* vertdata = (Vector3*)mesh.vertices;
+            Matrix invTransform = RLMatrixInvert(transform);
+            Vector3 origin = RLVector3Transform(ray.position, invTransform);
+            Vector3 direction = {
+                invTransform.m0*ray.direction.x + invTransform.m4*ray.direction.y + invTransform.m8*ray.direction.z,
+                invTransform.m1*ray.direction.x + invTransform.m5*ray.direction.y + invTransform.m9*ray.direction.z,
+                invTransform.m2*ray.direction.x + invTransform.m6*ray.direction.y + invTransform.m10*ray.direction.z
+            };
 
-            if (mesh.indices)
+            float detEpsilon = EPSILON/fabsf(det);
+            float closest = -1.0f;
+            Vector3 hitTriangle[3] = { 0 };
+
+            // Test against all triangles in mesh (mesh space)
+            for (int i = 0; i < triangleCount; i++)
             {
-                a = vertdata[mesh.indices[i*3 + 0]];
-                b = vertdata[mesh.indices[i*3 + 1]];
-                c = vertdata[mesh.indices[i*3 + 2]];
+                Vector3 triangle[3] = { 0 };
+
+                for (int k = 0; k < 3; k++) triangle[k] = (mesh.indices != NULL)? vertdata[mesh.indices[i*3 + k]] : vertdata[i*3 + k];
+
+                float distance = RLGetRayDistanceTriangle(origin, direction, (const float *)triangle, detEpsilon);
+
+                // Save the closest hit triangle
+                if ((distance >= 0.0f) && ((closest < 0.0f) || (distance < closest)))
+                {
+                    closest = distance;
+                    memcpy(hitTriangle, triangle, sizeof(triangle));
+                }
             }
-            else
+
+            if (closest >= 0.0f) collision = RLGetMeshRayCollision(ray, closest, (const float *)hitTriangle, invTransform, (det < 0.0f)? -1.0f : 1.0f);
+        }
+        else
+        {
+            // Transform not invertible (i.e. zero scale), test against all transformed triangles
+            for (int i = 0; i < triangleCount; i++)
             {
-                a = vertdata[i*3 + 0];
-                b = vertdata[i*3 + 1];
-                c = vertdata[i*3 + 2];
-            }
+                Vector3 a, b, c;
+
+                if (mesh.indices)
+                {
+                    a = vertdata[mesh.indices[i*3 + 0]];
+                    b = vertdata[mesh.indices[i*3 + 1]];
+                    c = vertdata[mesh.indices[i*3 + 2]];
+                }
+                else
+                {
+                    a = vertdata[i*3 + 0];
+                    b = vertdata[i*3 + 1];
+                    c = vertdata[i*3 + 2];
+                }
 
-            a = RLVector3Transform(a, transform);
-            b = RLVector3Transform(b, transform);
-            c = RLVector3Transform(c, transform);
+                a = RLVector3Transform(a, transform);
+                b = RLVector3Transform(b, transform);
+                c = RLVector3Transform(c, transform);
 
-            RayCollision triHitInfo = RLGetRayCollisionTriangle(ray, a, b, c);
+                RayCollision triHitInfo = RLGetRayCollisionTriangle(ray, a, b, c);
 
-            if (triHitInfo.hit)
-            {
-                // Save the closest hit triangle
-                if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+                if (triHitInfo.hit)
+                {
+                    // Save the closest hit triangle
+                    if ((!collision.hit) || (collision.distance > triHitInfo.distance)) collision = triHitInfo;
+                }
             }
         }
     }
@@ -4082,6 +4952,145 @@ RayCollision RLGetRayCollisionMesh(Ray ray, Mesh mesh, Matrix transform)
     return collision;
 }
 
+// Load mesh bounding volume hierarchy for fast ray queries
+// NOTE: Built with binned SAH (surface area heuristic) splits, bigger meshes subtrees are built in parallel,
+// hierarchy is not updated on mesh changes (animated vertices are not considered), it must be reloaded
+MeshBVH RLLoadMeshBVH(Mesh mesh)
+{
+    MeshBVH bvh = { 0 };
+
+    if ((mesh.vertices == NULL) || (mesh.triangleCount <= 0))
+    {
+        TRACELOG(LOG_WARNING, "MESH: BVH requires mesh vertex data available on CPU");
+        return bvh;
+    }
+
+    int triangleCount = mesh.triangleCount;
+    const Vector3 *vertdata = (const Vector3 *)mesh.vertices;
+
+    // Gather triangles vertex positions and centroids
+    float *positions = (float *)RL_MALLOC(triangleCount*9*sizeof(float));
+    MeshBVHBuild build = { 0 };
+    build.items = (MeshBVHItem *)RL_MALLOC(triangleCount*sizeof(MeshBVHItem));
+
+    for (int i = 0; i < triangleCount; i++)
+    {
+        float *triangle = positions + i*9;
+
+        for (int k = 0; k < 3; k++)
+        {
+            Vector3 v = (mesh.indices != NULL)? vertdata[mesh.indices[i*3 + k]] : vertdata[i*3 + k];
+            triangle[k*3] = v.x;
+            triangle[k*3 + 1] = v.y;
+            triangle[k*3 + 2] = v.z;
+        }
+
+        for (int c = 0; c < 3; c++)
+        {
+            float min = fminf(triangle[c], fminf(triangle[3 + c], triangle[6 + c]));
+            float max = fmaxf(triangle[c], fmaxf(triangle[3 + c], triangle[6 + c]));
+            build.items[i].bounds[c] = min;
+            build.items[i].bounds[3 + c] = max;
+            build.items[i].centroid[c] = (min + max)*0.5f;
+        }
+
+        build.items[i].index = i;
+    }
+
+    // Build top levels, ranges up to MESH_BVH_PARALLEL_TRIANGLES are deferred as subtree jobs
+    // NOTE: Deferred ranges do not depend on workers count, so the hierarchy is always the same
+    rMeshBVHNode *nodes = (rMeshBVHNode *)RL_MALLOC((2*triangleCount)*sizeof(rMeshBVHNode));
+    int nodeCount = 1;
+    RLBuildMeshBVHNode(&build, nodes, &nodeCount, 0, 0, triangleCount, 0, true);
+
+    RLParallelFor(build.taskCount, 1, RLBuildMeshBVHTasks, &build);
+
+    // Merge subtrees nodes: subtree root replaces the deferred node, remaining nodes are appended
+    int totalCount = nodeCount;
+    for (int t = 0; t < build.taskCount; t++) totalCount += build.tasks[t].nodeCount - 1;
+
+    nodes = (rMeshBVHNode *)RL_REALLOC(nodes, totalCount*sizeof(rMeshBVHNode));
+
+    for (int t = 0; t < build.taskCount; t++)
+    {
+        MeshBVHTask *task = &build.tasks[t];
+        int base = nodeCount - 1;   // Global index of subtree node k (k > 0) is base + k
+
+        for (int k = 0; k < task->nodeCount; k++)
+        {
+            rMeshBVHNode node = task->nodes[k];
+            if (node.count == 0) node.first += base;
+            nodes[(k == 0)? task->node : base + k] = node;
+        }
+
+        nodeCount += task->nodeCount - 1;
+        RL_FREE(task->nodes);
+    }
+
+    // Sort triangles by leaf order, for cache friendly traversal
+    bvh.triangles = (float *)RL_MALLOC(triangleCount*9*sizeof(float));
+    for (int i = 0; i < triangleCount; i++) memcpy(bvh.triangles + i*9, positions + build.items[i].index*9, 9*sizeof(float));
+
+    bvh.nodes = nodes;
+    bvh.nodeCount = nodeCount;
+    bvh.triangleCount = triangleCount;
+
+    RL_FREE(positions);
+    RL_FREE(build.items);
+    RL_FREE(build.tasks);
+
+    TRACELOG(LOG_INFO, "MESH: BVH loaded successfully (%i triangles, %i nodes)", bvh.triangleCount, bvh.nodeCount);
+
+    return bvh;
+}
+
+// Check if mesh BVH is valid (loaded)
+bool RLIsMeshBVHValid(MeshBVH bvh)
+{
+    return ((bvh.nodes != NULL) && (bvh.triangles != NULL) && (bvh.nodeCount > 0) && (bvh.triangleCount > 0));
+}
+
+// Unload mesh BVH data
+void RLUnloadMeshBVH(MeshBVH bvh)
+{
+    RL_FREE(bvh.nodes);
+    RL_FREE(bvh.triangles);
+}
+
+// Get collision info between ray and mesh, using mesh BVH
+// NOTE: Transform must be the same transform used on GetRayCollisionMesh(), ray is transformed into mesh space
+RayCollision RLGetRayCollisionMeshBVH(Ray ray, MeshBVH bvh, Matrix transform)
+{
+    RayCollision collision = { 0 };
+
+    RLGetRayCollisionsMeshBVH(&ray, 1, bvh, transform, &collision);
+
+    return collision;
+}
+
+// Get collision info between multiple rays and mesh, using mesh BVH
+// NOTE: Mesh transform is inverted once for all rays, bigger batches are tested in parallel
+void RLGetRayCollisionsMeshBVH(const Ray *rays, int rayCount, MeshBVH bvh, Matrix transform, RayCollision *collisions)
+{
+    if ((rays == NULL) || (collisions == NULL) || (rayCount <= 0)) return;
+
+    memset(collisions, 0, rayCount*sizeof(RayCollision));
+
+    float det = RLMatrixDeterminant(transform);
+    if (!RLIsMeshBVHValid(bvh) || (fabsf(det) <= 0.0f)) return;
+
+    MeshBVHRayJob job = { 0 };
+    job.rays = rays;
+    job.collisions = collisions;
+    job.bvh = bvh;
+    job.transform = transform;
+    job.invTransform = RLMatrixInvert(transform);
+    job.sign = (det < 0.0f)? -1.0f : 1.0f;
+    job.detEpsilon = EPSILON/fabsf(det);
+
+    RLParallelFor(rayCount, 64, RLGetRayCollisionsMeshBVHRange, &job);
+}
+
 // Get collision info between ray and triangle
 // NOTE: The points are expected to be in counter-clockwise winding
 // NOTE: Based on https://en.wikipedia.org/wiki/M%C3%B6ller%E2%80%93Trumbore_intersection_algorithm
@@ -4108,78 +5117,939 @@ RayCollision RLGetRayCollisionTriangle(Ray ray, Vector3 p1, Vector3 p2, Vector3
     // Avoid culling!
     if ((det > -EPSILON) && (det < EPSILON)) return collision;
 
-    invDet = 1.0f/det;
+    invDet = 1.0f/det;
+
+    // Calculate distance from V1 to ray origin
+    tv = RLVector3Subtract(ray.position, p1);
+
+    // Calculate u parameter and test bound
+    u = RLVector3DotProduct(tv, p)*invDet;
+
+    // The intersection lies outside the triangle
+    if ((u < 0.0f) || (u > 1.0f)) return collision;
+
+    // Prepare to test v parameter
+    q = RLVector3CrossProduct(tv, edge1);
+
+    // Calculate V parameter and test bound
+    v = RLVector3DotProduct(ray.direction, q)*invDet;
+
+    // The intersection lies outside the triangle
+    if ((v < 0.0f) || ((u + v) > 1.0f)) return collision;
+
+    t = RLVector3DotProduct(edge2, q)*invDet;
+
+    if (t > EPSILON)
+    {
+        // Ray hit, get hit point and normal
+        collision.hit = true;
+        collision.distance = t;
+        collision.normal = RLVector3Normalize(RLVector3CrossProduct(edge1, edge2));
+        collision.point = RLVector3Add(ray.position, RLVector3Scale(ray.direction, t));
+    }
+
+    return collision;
+}
+
+// Get collision info between ray and quad
+// NOTE: The points are expected to be in counter-clockwise winding
+RayCollision RLGetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4)
+{
+    RayCollision collision = { 0 };
+
+    collision = RLGetRayCollisionTriangle(ray, p1, p2, p4);
+
+    if (!collision.hit) collision = RLGetRayCollisionTriangle(ray, p2, p3, p4);
+
+    return collision;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
+// Build pose from parent joints
+// NOTE: Required for animations loading (required by IQM and GLTF)
+static void RLBuildPoseFromParentJoints(BoneInfo *bones, int boneCount, Transform *transforms)
+{
+    for (int i = 0; i < boneCount; i++)
+    {
+        if (bones[i].parent >= 0)
+        {
+            if (bones[i].parent > i)
+            {
+                TRACELOG(LOG_WARNING, "Assumes bones are toplogically sorted, but bone %d has parent %d. Skipping.", i, bones[i].parent);
+                continue;
+            }
+            transforms[i].rotation = RLQuaternionMultiply(transforms[bones[i].parent].rotation, transforms[i].rotation);
+            transforms[i].translation = RLVector3RotateByQuaternion(transforms[i].translation, transforms[bones[i].parent].rotation);
+            transforms[i].translation = RLVector3Add(transforms[i].translation, transforms[bones[i].parent].translation);
+            transforms[i].scale = RLVector3Multiply(transforms[i].scale, transforms[bones[i].parent].scale);
+        }
+    }
+}
+#endif
+
+// Update model animated vertex data (positions and normals) from current mesh bone matrices
+// NOTE: Updated data is uploaded to GPU
+static void RLUpdateModelSkinning(Model model)
+{
+    skinnedVertexCount = 0;
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        Mesh mesh = model.meshes[m];
+
+        if ((mesh.boneMatrices == NULL) || (mesh.boneIds == NULL) || (mesh.boneWeights == NULL) ||
+            (mesh.animVertices == NULL) || (mesh.vertices == NULL)) continue;
+
+        // Pack bone matrices: 3x4 row-major per bone (last row of affine matrices is not required)
+        int paletteSize = mesh.boneCount*12;
+
+        if (paletteSize > skinningPaletteCapacity)
+        {
+            float *palette = (float *)RL_REALLOC(skinningPalette, paletteSize*sizeof(float));
+            if (palette == NULL) continue;
+
+            skinningPalette = palette;
+            skinningPaletteCapacity = paletteSize;
+        }
+
+        for (int b = 0; b < mesh.boneCount; b++)
+        {
+            Matrix mat = mesh.boneMatrices[b];
+            float *rows = skinningPalette + b*12;
+
+            rows[0] = mat.m0; rows[1] = mat.m4; rows[2] = mat.m8; rows[3] = mat.m12;
+            rows[4] = mat.m1; rows[5] = mat.m5; rows[6] = mat.m9; rows[7] = mat.m13;
+            rows[8] = mat.m2; rows[9] = mat.m6; rows[10] = mat.m10; rows[11] = mat.m14;
+        }
+
+        SkinningJob job = {
+            .vertices = mesh.vertices,
+            .normals = ((mesh.normals != NULL) && (mesh.animNormals != NULL))? mesh.normals : NULL,
+            .boneIds = mesh.boneIds,
+            .boneWeights = mesh.boneWeights,
+            .animVertices = mesh.animVertices,
+            .animNormals = mesh.animNormals,
+            .palette = skinningPalette
+        };
+
+        RLParallelFor(mesh.vertexCount, SKINNING_BATCH_VERTICES, RLSkinVertexRange, &job);
+        skinnedVertexCount += mesh.vertexCount;
+
+        rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0);   // Update vertex position
+        if (job.normals != NULL) rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0);  // Update vertex normals
+    }
+}
+
+// Unload packed bone matrices scratch buffer
+// NOTE: Buffer is shared by all models, allocated again on next UpdateModelAnimation() if required
+static void RLUnloadSkinningPalette(void)
+{
+    RL_FREE(skinningPalette);
+    skinningPalette = NULL;
+    skinningPaletteCapacity = 0;
+}
+
+// Get animation track value error: distance for translation/scale, angle for rotation (radians)
+static float RLGetAnimationValueError(int kind, const float *a, const float *b)
+{
+    float error = 0.0f;
+
+    if (kind == ANIM_TRACK_ROTATION)
+    {
+        float dot = fabsf(a[0]*b[0] + a[1]*b[1] + a[2]*b[2] + a[3]*b[3]);
+        error = (dot >= 1.0f)? 0.0f : 2.0f*acosf(dot);
+    }
+    else error = sqrtf((a[0] - b[0])*(a[0] - b[0]) + (a[1] - b[1])*(a[1] - b[1]) + (a[2] - b[2])*(a[2] - b[2]));
+
+    return error;
+}
+
+// Interpolate animation track values: lerp for translation/scale, slerp for rotation
+static void RLLerpAnimationValue(int kind, const float *a, const float *b, float amount, float *result)
+{
+    if (kind == ANIM_TRACK_ROTATION)
+    {
+        Quaternion q = RLQuaternionSlerp((Quaternion){ a[0], a[1], a[2], a[3] }, (Quaternion){ b[0], b[1], b[2], b[3] }, amount);
+        result[0] = q.x; result[1] = q.y; result[2] = q.z; result[3] = q.w;
+    }
+    else for (int c = 0; c < 3; c++) result[c] = a[c] + (b[c] - a[c])*amount;
+}
+
+// Check animation track segment, all frames between start and end interpolated from segment ends within tolerance
+static bool RLIsAnimationSegmentValid(int kind, const float *values, int start, int end, float tolerance)
+{
+    int components = (kind == ANIM_TRACK_ROTATION)? 4 : 3;
+
+    for (int f = start + 1; f < end; f++)
+    {
+        float interpolated[4] = { 0 };
+        RLLerpAnimationValue(kind, values + start*components, values + end*components, (float)(f - start)/(float)(end - start), interpolated);
+        if (RLGetAnimationValueError(kind, interpolated, values + f*components) > tolerance) return false;
+    }
+
+    return true;
+}
+
+// Encode quaternion using smallest-three: 2 bit largest component index + 3x15 bit components (48 bit)
+static void RLEncodeQuaternion(const float *q, unsigned short *packed)
+{
+    int largest = 0;
+    for (int c = 1; c < 4; c++) if (fabsf(q[c]) > fabsf(q[largest])) largest = c;
+
+    // Largest component sign is dropped, q and -q represent the same rotation
+    float sign = (q[largest] < 0.0f)? -1.0f : 1.0f;
+    unsigned long long value = (unsigned long long)largest << 45;
+
+    for (int c = 0, shift = 30; c < 4; c++)
+    {
+        if (c == largest) continue;
+
+        // Remaining components are in range [-1/sqrt(2), 1/sqrt(2)]
+        int quantized = (int)((q[c]*sign + 0.70710678f)/1.41421356f*32767.0f + 0.5f);
+        if (quantized < 0) quantized = 0;
+        else if (quantized > 32767) quantized = 32767;
+
+        value |= (unsigned long long)quantized << shift;
+        shift -= 15;
+    }
+
+    packed[0] = (unsigned short)(value & 0xffff);
+    packed[1] = (unsigned short)((value >> 16) & 0xffff);
+    packed[2] = (unsigned short)((value >> 32) & 0xffff);
+}
+
+// Decode smallest-three encoded quaternion
+static void RLDecodeQuaternion(const unsigned short *packed, float *q)
+{
+    unsigned long long value = (unsigned long long)packed[0] | ((unsigned long long)packed[1] << 16) | ((unsigned long long)packed[2] << 32);
+    int largest = (int)((value >> 45) & 0x3);
+    float sum = 0.0f;
+
+    for (int c = 0, shift = 30; c < 4; c++)
+    {
+        if (c == largest) continue;
+
+        q[c] = (float)((value >> shift) & 0x7fff)/32767.0f*1.41421356f - 0.70710678f;
+        sum += q[c]*q[c];
+        shift -= 15;
+    }
+
+    q[largest] = (sum < 1.0f)? sqrtf(1.0f - sum) : 0.0f;
+}
+
+// Encode animation track (values for all frames) into track data, returns size in bytes (multiple of 4)
+// NOTE: Track layout: type (1 byte), reserved (1 byte), keys count (2 bytes) and
+//  - ANIM_TRACK_CONSTANT: value (3 or 4 floats)
+//  - ANIM_TRACK_ANIMATED: translation/scale: range min and extent (6 floats), keys frame (keyCount shorts), quantized keys value (keyCount*3 shorts)
+//                         rotation: keys frame (keyCount shorts), smallest-three encoded keys value (keyCount*3 shorts)
+static int RLEncodeAnimationTrack(unsigned char *track, int kind, const float *values, int frameCount, float tolerance, unsigned short *keys)
+{
+    int components = (kind == ANIM_TRACK_ROTATION)? 4 : 3;
+    const float defaults[3][4] = { { 0.0f, 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f, 1.0f }, { 1.0f, 1.0f, 1.0f, 0.0f } };
+    unsigned short keyCount = 1;
+    int size = 4;
+
+    // Check for constant tracks
+    bool constant = true;
+    for (int f = 1; f < frameCount; f++)
+    {
+        if (RLGetAnimationValueError(kind, values + f*components, values) > tolerance) { constant = false; break; }
+    }
+
+    if (constant)
+    {
+        if (RLGetAnimationValueError(kind, values, defaults[kind]) <= tolerance) track[0] = ANIM_TRACK_DEFAULT;
+        else
+        {
+            track[0] = ANIM_TRACK_CONSTANT;
+            memcpy(track + size, values, components*sizeof(float));
+            size += components*sizeof(float);
+        }
+
+        memcpy(track + 2, &keyCount, 2);
+        return size;
+    }
+
+    // Decoded keys differ from source values by quantization error, keys are selected with the remaining tolerance
+    // NOTE: Translation/scale bound is half quantization step of the track range (keys range is never bigger),
+    // rotation bound is a conservative estimate for smallest-three 15 bit components (radians)
+    float quantizationError = 10.0f*0.70710678f/32767.0f;
+
+    if (kind != ANIM_TRACK_ROTATION)
+    {
+        float extent = 0.0f;
+
+        for (int c = 0; c < 3; c++)
+        {
+            float min = values[c];
+            float max = values[c];
+
+            for (int f = 1; f < frameCount; f++)
+            {
+                if (values[f*3 + c] < min) min = values[f*3 + c];
+                if (values[f*3 + c] > max) max = values[f*3 + c];
+            }
+
+            extent += (max - min)*(max - min);
+        }
+
+        quantizationError = 0.5f*sqrtf(extent)/65535.0f;
+    }
+
+    float keyTolerance = (tolerance > quantizationError)? (tolerance - quantizationError) : 0.0f;
+
+    // Keyframes reduction: extend every segment while all the skipped frames
+    // can be interpolated from the segment ends within tolerance
+    // NOTE: Segment end is searched doubling its length until a segment is not valid, then bisecting,
+    // every end candidate is fully checked, so O(n*log(n)) values are checked per segment (not O(n^2))
+    keys[0] = 0;
+    int key = 0;
+
+    while (key < (frameCount - 1))
+    {
+        int valid = key + 1;        // Furthest end found valid, next frame is always valid
+        int invalid = frameCount;   // Nearest end found not valid (or past the last frame)
+
+        for (int length = 2; key + length < frameCount; length *= 2)
+        {
+            if (RLIsAnimationSegmentValid(kind, values, key, key + length, keyTolerance)) valid = key + length;
+            else
+            {
+                invalid = key + length;
+                break;
+            }
+        }
+
+        while ((invalid - valid) > 1)
+        {
+            int middle = valid + (invalid - valid)/2;
+
+            if (RLIsAnimationSegmentValid(kind, values, key, middle, keyTolerance)) valid = middle;
+            else invalid = middle;
+        }
+
+        keys[keyCount++] = (unsigned short)valid;
+        key = valid;
+    }
+
+    track[0] = ANIM_TRACK_ANIMATED;
+    memcpy(track + 2, &keyCount, 2);
+
+    float range[6] = { 0 };     // min[3], extent[3]
+    if (kind != ANIM_TRACK_ROTATION)
+    {
+        float max[3] = { 0 };
+
+        for (int c = 0; c < 3; c++)
+        {
+            range[c] = max[c] = values[keys[0]*3 + c];
+
+            for (int k = 1; k < keyCount; k++)
+            {
+                float value = values[keys[k]*3 + c];
+                if (value < range[c]) range[c] = value;
+                if (value > max[c]) max[c] = value;
+            }
+
+            range[3 + c] = max[c] - range[c];
+        }
+
+        memcpy(track + size, range, sizeof(range));
+        size += sizeof(range);
+    }
+
+    memcpy(track + size, keys, keyCount*sizeof(unsigned short));
+    size += keyCount*sizeof(unsigned short);
+
+    for (int k = 0; k < keyCount; k++)
+    {
+        unsigned short packed[3] = { 0 };
+        const float *value = values + keys[k]*components;
+
+        if (kind == ANIM_TRACK_ROTATION) RLEncodeQuaternion(value, packed);
+        else
+        {
+            for (int c = 0; c < 3; c++)
+            {
+                float normalized = (range[3 + c] > 0.0f)? (value[c] - range[c])/range[3 + c] : 0.0f;
+                packed[c] = (unsigned short)(normalized*65535.0f + 0.5f);
+            }
+        }
+
+        memcpy(track + size, packed, sizeof(packed));
+        size += sizeof(packed);
+    }
+
+    return (size + 3) & ~3;
+}
+
+// Get encoded animation track size in bytes, -1 if track is not valid
+static int RLGetAnimationTrackSize(const unsigned char *track, int kind, int available, int frameCount)
+{
+    if (available < 4) return -1;
+
+    unsigned short keyCount = 0;
+    memcpy(&keyCount, track + 2, 2);
+
+    int size = -1;
+
+    switch (track[0])
+    {
+        case ANIM_TRACK_DEFAULT: size = 4; break;
+        case ANIM_TRACK_CONSTANT: size = 4 + ((kind == ANIM_TRACK_ROTATION)? 16 : 12); break;
+        case ANIM_TRACK_ANIMATED:
+        {
+            if ((keyCount < 2) || (keyCount > frameCount)) return -1;
+            size = (4 + ((kind == ANIM_TRACK_ROTATION)? 0 : 24) + keyCount*2 + keyCount*6 + 3) & ~3;
+            if (size > available) return -1;
+
+            // Keys frame must be increasing and in range
+            const unsigned char *frames = track + 4 + ((kind == ANIM_TRACK_ROTATION)? 0 : 24);
+            unsigned short previous = 0;
+
+            for (int k = 0; k < keyCount; k++)
+            {
+                unsigned short frame = 0;
+                memcpy(&frame, frames + k*2, 2);
+                if ((frame >= frameCount) || ((k > 0) && (frame <= previous))) return -1;
+                previous = frame;
+            }
+        } break;
+        default: break;
+    }
+
+    return (size <= available)? size : -1;
+}
+
+// Decode animation track value at a (fractional) frame, keys are searched with binary search
+static void RLDecodeAnimationTrack(const unsigned char *track, int kind, float frame, float *value)
+{
+    int components = (kind == ANIM_TRACK_ROTATION)? 4 : 3;
+
+    switch (track[0])
+    {
+        case ANIM_TRACK_DEFAULT:
+        {
+            if (kind == ANIM_TRACK_TRANSLATION) { value[0] = 0.0f; value[1] = 0.0f; value[2] = 0.0f; }
+            else if (kind == ANIM_TRACK_ROTATION) { value[0] = 0.0f; value[1] = 0.0f; value[2] = 0.0f; value[3] = 1.0f; }
+            else { value[0] = 1.0f; value[1] = 1.0f; value[2] = 1.0f; }
+        } break;
+        case ANIM_TRACK_CONSTANT: memcpy(value, track + 4, components*sizeof(float)); break;
+        case ANIM_TRACK_ANIMATED:
+        {
+            unsigned short keyCount = 0;
+            memcpy(&keyCount, track + 2, 2);
+
+            float range[6] = { 0 };
+            const unsigned char *keys = track + 4;
+
+            if (kind != ANIM_TRACK_ROTATION)
+            {
+                memcpy(range, track + 4, sizeof(range));
+                keys += sizeof(range);
+            }
+
+            const unsigned char *packedValues = keys + keyCount*2;
+
+            // Find last key with frame <= requested frame
+            int low = 0;
+            int high = keyCount - 1;
+
+            while (low < high)
+            {
+                int mid = (low + high + 1)/2;
+                unsigned short keyFrame = 0;
+                memcpy(&keyFrame, keys + mid*2, 2);
+
+                if ((float)keyFrame <= frame) low = mid;
+                else high = mid - 1;
+            }
+
+            int key1 = (low < (keyCount - 1))? low + 1 : low;
+            unsigned short frame0 = 0;
+            unsigned short frame1 = 0;
+            memcpy(&frame0, keys + low*2, 2);
+            memcpy(&frame1, keys + key1*2, 2);
+
+            float decoded[2][4] = { 0 };
+            int key[2] = { low, key1 };
+
+            for (int i = 0; i < 2; i++)
+            {
+                unsigned short packed[3] = { 0 };
+                memcpy(packed, packedValues + key[i]*6, 6);
+
+                if (kind == ANIM_TRACK_ROTATION) RLDecodeQuaternion(packed, decoded[i]);
+                else for (int c = 0; c < 3; c++) decoded[i][c] = range[c] + (float)packed[c]/65535.0f*range[3 + c];
+            }
+
+            float amount = (frame1 > frame0)? (frame - (float)frame0)/(float)(frame1 - frame0) : 0.0f;
+            if (amount < 0.0f) amount = 0.0f;
+            else if (amount > 1.0f) amount = 1.0f;
+
+            RLLerpAnimationValue(kind, decoded[0], decoded[1], amount, value);
+        } break;
+        default: break;
+    }
+}
+
+// Get triangles bounds surface area (half), used on SAH cost
+static float RLGetBoundsArea(const float *min, const float *max)
+{
+    float dx = max[0] - min[0];
+    float dy = max[1] - min[1];
+    float dz = max[2] - min[2];
+
+    return (dx*dy + dy*dz + dz*dx);
+}
+
+// Grow bounds to include triangle bounds (min and max, 6 floats)
+static void RLGrowBoundsTriangle(float *min, float *max, const float *bounds)
+{
+    for (int c = 0; c < 3; c++)
+    {
+        min[c] = (bounds[c] < min[c])? bounds[c] : min[c];
+        max[c] = (bounds[3 + c] > max[c])? bounds[3 + c] : max[c];
+    }
+}
+
+// Build BVH node for triangles range [start, start + count), recursive
+// NOTE: When defer is requested, ranges smaller than MESH_BVH_PARALLEL_TRIANGLES are stored as subtree jobs
+static void RLBuildMeshBVHNode(MeshBVHBuild *build, rMeshBVHNode *nodes, int *nodeCount, int index, int start, int count, int depth, bool defer)
+{
+    if (defer && (count <= MESH_BVH_PARALLEL_TRIANGLES))
+    {
+        if (build->taskCount == build->taskCapacity)
+        {
+            build->taskCapacity = (build->taskCapacity > 0)? build->taskCapacity*2 : 64;
+            build->tasks = (MeshBVHTask *)RL_REALLOC(build->tasks, build->taskCapacity*sizeof(MeshBVHTask));
+        }
+
+        MeshBVHTask *task = &build->tasks[build->taskCount++];
+        task->node = index;
+        task->start = start;
+        task->count = count;
+        task->depth = depth;
+        return;
+    }
+
+    rMeshBVHNode *node = &nodes[index];
+    float cmin[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+    float cmax[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+
+    for (int c = 0; c < 3; c++) { node->min[c] = FLT_MAX; node->max[c] = -FLT_MAX; }
+
+    for (int i = start; i < (start + count); i++)
+    {
+        const float *centroid = build->items[i].centroid;
+
+        RLGrowBoundsTriangle(node->min, node->max, build->items[i].bounds);
+
+        for (int c = 0; c < 3; c++)
+        {
+            cmin[c] = (centroid[c] < cmin[c])? centroid[c] : cmin[c];
+            cmax[c] = (centroid[c] > cmax[c])? centroid[c] : cmax[c];
+        }
+    }
+
+    node->first = start;
+    node->count = count;
+
+    if ((count <= 1) || (depth >= MESH_BVH_MAX_DEPTH)) return;
+
+    // Find best split plane, binned SAH on centroids
+    // NOTE: Small ranges use less bins, there are no more candidate planes than triangles
+    int bins = (count < MESH_BVH_BINS)? count : MESH_BVH_BINS;
+    int bestAxis = -1;
+    int bestPlane = 0;
+    float bestCost = FLT_MAX;
+
+    for (int axis = 0; axis < 3; axis++)
+    {
+        float extent = cmax[axis] - cmin[axis];
+        if (extent <= 0.0f) continue;
+
+        int binCount[MESH_BVH_BINS] = { 0 };
+        float binBounds[MESH_BVH_BINS][6];
+        float scale = (float)bins/extent;
+
+        for (int b = 0; b < bins; b++)
+        {
+            for (int c = 0; c < 3; c++) { binBounds[b][c] = FLT_MAX; binBounds[b][3 + c] = -FLT_MAX; }
+        }
+
+        for (int i = start; i < (start + count); i++)
+        {
+            int b = (int)((build->items[i].centroid[axis] - cmin[axis])*scale);
+            if (b > (bins - 1)) b = bins - 1;
+
+            binCount[b]++;
+            RLGrowBoundsTriangle(binBounds[b], binBounds[b] + 3, build->items[i].bounds);
+        }
+
+        // Sweep bins from both sides to get left/right cost of every plane
+        float leftCost[MESH_BVH_BINS] = { 0 };
+        float min[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+        float max[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+        int leftCount = 0;
+
+        for (int b = 0; b < (bins - 1); b++)
+        {
+            leftCount += binCount[b];
+            RLGrowBoundsTriangle(min, max, binBounds[b]);
+            leftCost[b + 1] = (leftCount > 0)? leftCount*RLGetBoundsArea(min, max) : 0.0f;
+        }
+
+        for (int c = 0; c < 3; c++) { min[c] = FLT_MAX; max[c] = -FLT_MAX; }
+        int rightCount = 0;
+
+        for (int b = bins - 1; b > 0; b--)
+        {
+            rightCount += binCount[b];
+            RLGrowBoundsTriangle(min, max, binBounds[b]);
+
+            if ((rightCount > 0) && (rightCount < count))
+            {
+                float cost = leftCost[b] + rightCount*RLGetBoundsArea(min, max);
+
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestPlane = b;
+                }
+            }
+        }
+    }
+
+    // Keep as leaf if splitting is not cheaper than testing all triangles
+    // NOTE: Node traversal cost is considered the same as one triangle test
+    float area = RLGetBoundsArea(node->min, node->max);
+    if ((count <= MESH_BVH_LEAF_TRIANGLES) && ((bestAxis < 0) || ((area + bestCost) >= count*area))) return;
+
+    // Partition triangles references
+    int leftCount = count/2;
+
+    if (bestAxis >= 0)
+    {
+        float scale = (float)bins/(cmax[bestAxis] - cmin[bestAxis]);
+        int i = start;
+        int j = start + count - 1;
+
+        while (i <= j)
+        {
+            int b = (int)((build->items[i].centroid[bestAxis] - cmin[bestAxis])*scale);
+            if (b > (bins - 1)) b = bins - 1;
+
+            if (b < bestPlane) i++;
+            else
+            {
+                MeshBVHItem temp = build->items[i];
+                build->items[i] = build->items[j];
+                build->items[j--] = temp;
+            }
+        }
+
+        leftCount = i - start;
+    }
+
+    // All centroids in the same point, split by index
+    if ((leftCount == 0) || (leftCount == count)) leftCount = count/2;
+
+    int left = *nodeCount;
+    *nodeCount += 2;
+
+    node->first = left;
+    node->count = 0;
+
+    RLBuildMeshBVHNode(build, nodes, nodeCount, left, start, leftCount, depth + 1, defer);
+    RLBuildMeshBVHNode(build, nodes, nodeCount, left + 1, start + leftCount, count - leftCount, depth + 1, defer);
+}
+
+// Build BVH deferred subtrees (job callback)
+static void RLBuildMeshBVHTasks(void *userData, int start, int end, int worker)
+{
+    MeshBVHBuild *build = (MeshBVHBuild *)userData;
+
+    for (int t = start; t < end; t++)
+    {
+        MeshBVHTask *task = &build->tasks[t];
+
+        // Subtree nodes are allocated locally, triangle ranges do not overlap between jobs
+        task->nodes = (rMeshBVHNode *)RL_MALLOC((2*task->count)*sizeof(rMeshBVHNode));
+        task->nodeCount = 1;
+        RLBuildMeshBVHNode(build, task->nodes, &task->nodeCount, 0, task->start, task->count, task->depth, false);
+    }
+}
+
+// Get hit distance of ray and triangle (9 floats), -1 if no hit
+// NOTE: Same test as GetRayCollisionTriangle(), Moller-Trumbore intersection algorithm,
+// for mesh space rays the determinant is scaled by the transform determinant compared to world space,
+// so detEpsilon is expected as EPSILON/|det(transform)|, hit distance is the same in both spaces
+static float RLGetRayDistanceTriangle(Vector3 origin, Vector3 direction, const float *triangle, float detEpsilon)
+{
+    Vector3 p1 = { triangle[0], triangle[1], triangle[2] };
+    Vector3 edge1 = { triangle[3] - p1.x, triangle[4] - p1.y, triangle[5] - p1.z };
+    Vector3 edge2 = { triangle[6] - p1.x, triangle[7] - p1.y, triangle[8] - p1.z };
+
+    Vector3 p = RLVector3CrossProduct(direction, edge2);
+    float det = RLVector3DotProduct(edge1, p);
+
+    if ((det > -detEpsilon) && (det < detEpsilon)) return -1.0f;
+
+    float invDet = 1.0f/det;
+    Vector3 tv = RLVector3Subtract(origin, p1);
+    float u = RLVector3DotProduct(tv, p)*invDet;
+
+    if ((u < 0.0f) || (u > 1.0f)) return -1.0f;
+
+    Vector3 q = RLVector3CrossProduct(tv, edge1);
+    float v = RLVector3DotProduct(direction, q)*invDet;
+
+    if ((v < 0.0f) || ((u + v) > 1.0f)) return -1.0f;
+
+    float t = RLVector3DotProduct(edge2, q)*invDet;
+
+    return (t > EPSILON)? t : -1.0f;
+}
+
+// Get world space collision info from mesh space hit
+// NOTE: Ray direction is transformed with the mesh inverse transform without normalization,
+// so the hit distance is the same in mesh and world space
+static RayCollision RLGetMeshRayCollision(Ray ray, float distance, const float *triangle, Matrix invTransform, float sign)
+{
+    RayCollision collision = { 0 };
+
+    Vector3 edge1 = { triangle[3] - triangle[0], triangle[4] - triangle[1], triangle[5] - triangle[2] };
+    Vector3 edge2 = { triangle[6] - triangle[0], triangle[7] - triangle[1], triangle[8] - triangle[2] };
+    Vector3 normal = RLVector3CrossProduct(edge1, edge2);
+
+    // Normals are transformed by the inverse transpose matrix
+    collision.hit = true;
+    collision.distance = distance;
+    collision.normal = RLVector3Normalize((Vector3){
+        sign*(invTransform.m0*normal.x + invTransform.m1*normal.y + invTransform.m2*normal.z),
+        sign*(invTransform.m4*normal.x + invTransform.m5*normal.y + invTransform.m6*normal.z),
+        sign*(invTransform.m8*normal.x + invTransform.m9*normal.y + invTransform.m10*normal.z) });
+    collision.point = RLVector3Add(ray.position, RLVector3Scale(ray.direction, distance));
+
+    return collision;
+}
+
+// Get closest hit distance of mesh space ray and BVH triangles, -1 if no hit
+// NOTE: Nearest child is visited first, nodes further than current closest hit are skipped
+static float RLGetRayDistanceMeshBVH(MeshBVH bvh, Vector3 origin, Vector3 direction, float detEpsilon, int *triangle)
+{
+    const rMeshBVHNode *nodes = bvh.nodes;
+    float closest = FLT_MAX;
+    float invDir[3] = { 0 };
+    float org[3] = { origin.x, origin.y, origin.z };
+    float dir[3] = { direction.x, direction.y, direction.z };
+
+    for (int c = 0; c < 3; c++) invDir[c] = (fabsf(dir[c]) > 1e-20f)? 1.0f/dir[c] : ((dir[c] < 0.0f)? -1e20f : 1e20f);
+
+    int stack[MESH_BVH_MAX_DEPTH + 4] = { 0 };
+    int stackSize = 0;
+    int current = 0;
+
+    while (current >= 0)
+    {
+        const rMeshBVHNode *node = &nodes[current];
 
-    // Calculate distance from V1 to ray origin
-    tv = RLVector3Subtract(ray.position, p1);
+        if (node->count > 0)
+        {
+            for (int i = node->first; i < (node->first + node->count); i++)
+            {
+                float distance = RLGetRayDistanceTriangle(origin, direction, bvh.triangles + i*9, detEpsilon);
 
-    // Calculate u parameter and test bound
-    u = RLVector3DotProduct(tv, p)*invDet;
+                if ((distance >= 0.0f) && (distance < closest))
+                {
+                    closest = distance;
+                    *triangle = i;
+                }
+            }
 
-    // The intersection lies outside the triangle
-    if ((u < 0.0f) || (u > 1.0f)) return collision;
+            current = (stackSize > 0)? stack[--stackSize] : -1;
+        }
+        else
+        {
+            // Slab test both children, get entry distance or FLT_MAX if missed
+            float entry[2] = { FLT_MAX, FLT_MAX };
 
-    // Prepare to test v parameter
-    q = RLVector3CrossProduct(tv, edge1);
+            for (int k = 0; k < 2; k++)
+            {
+                const rMeshBVHNode *child = &nodes[node->first + k];
+                float tmin = 0.0f;
+                float tmax = closest;
 
-    // Calculate V parameter and test bound
-    v = RLVector3DotProduct(ray.direction, q)*invDet;
+                for (int c = 0; c < 3; c++)
+                {
+                    float t1 = (child->min[c] - org[c])*invDir[c];
+                    float t2 = (child->max[c] - org[c])*invDir[c];
+                    float near = (t1 < t2)? t1 : t2;
+                    float far = (t1 < t2)? t2 : t1;
+                    tmin = (near > tmin)? near : tmin;
+                    tmax = (far < tmax)? far : tmax;
+                }
 
-    // The intersection lies outside the triangle
-    if ((v < 0.0f) || ((u + v) > 1.0f)) return collision;
+                if (tmin <= tmax) entry[k] = tmin;
+            }
 
-    t = RLVector3DotProduct(edge2, q)*invDet;
+            int first = (entry[0] <= entry[1])? 0 : 1;
 
-    if (t > EPSILON)
-    {
-        // Ray hit, get hit point and normal
-        collision.hit = true;
-        collision.distance = t;
-        collision.normal = RLVector3Normalize(RLVector3CrossProduct(edge1, edge2));
-        collision.point = RLVector3Add(ray.position, RLVector3Scale(ray.direction, t));
+            if (entry[first] == FLT_MAX) current = (stackSize > 0)? stack[--stackSize] : -1;
+            else
+            {
+                if (entry[1 - first] != FLT_MAX) stack[stackSize++] = node->first + 1 - first;
+                current = node->first + first;
+            }
+        }
     }
 
-    return collision;
+    return (closest < FLT_MAX)? closest : -1.0f;
 }
 
-// Get collision info between ray and quad
-// NOTE: The points are expected to be in counter-clockwise winding
-RayCollision RLGetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Vector3 p4)
+// Get batched rays collision info (job callback)
+static void RLGetRayCollisionsMeshBVHRange(void *userData, int start, int end, int worker)
 {
-    RayCollision collision = { 0 };
+    MeshBVHRayJob *job = (MeshBVHRayJob *)userData;
+    Matrix inv = job->invTransform;
 
-    collision = RLGetRayCollisionTriangle(ray, p1, p2, p4);
+    for (int i = start; i < end; i++)
+    {
+        Ray ray = job->rays[i];
+        Vector3 origin = RLVector3Transform(ray.position, inv);
+        Vector3 direction = {
+            inv.m0*ray.direction.x + inv.m4*ray.direction.y + inv.m8*ray.direction.z,
+            inv.m1*ray.direction.x + inv.m5*ray.direction.y + inv.m9*ray.direction.z,
+            inv.m2*ray.direction.x + inv.m6*ray.direction.y + inv.m10*ray.direction.z
+        };
 
-    if (!collision.hit) collision = RLGetRayCollisionTriangle(ray, p2, p3, p4);
+        int triangle = -1;
+        float distance = RLGetRayDistanceMeshBVH(job->bvh, origin, direction, job->detEpsilon, &triangle);
 
-    return collision;
+        if (distance >= 0.0f) job->collisions[i] = RLGetMeshRayCollision(ray, distance, job->bvh.triangles + triangle*9, inv, job->sign);
+    }
 }
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
-// Build pose from parent joints
-// NOTE: Required for animations loading (required by IQM and GLTF)
-static void RLBuildPoseFromParentJoints(BoneInfo *bones, int boneCount, Transform *transforms)
+// Skin a range of mesh vertices: blend up-to 4 bone matrices per vertex and transform position and normal
+// NOTE: Normals are transformed by the 3x3 part of the blended matrix (no translation)
+static void RLSkinVertexRange(void *userData, int start, int end, int worker)
 {
-    for (int i = 0; i < boneCount; i++)
+    const SkinningJob *job = (const SkinningJob *)userData;
+    for (int v = start; v < end; v++)
     {
-        if (bones[i].parent >= 0)
+        const unsigned char *ids = job->boneIds + v*4;
+        const float *weights = job->boneWeights + v*4;
+        const float *position = job->vertices + v*3;
+        float *animPosition = job->animVertices + v*3;
+
+#if defined(RL_SKINNING_SSE2)
+        __m128 row0 = _mm_setzero_ps();
+        __m128 row1 = _mm_setzero_ps();
+        __m128 row2 = _mm_setzero_ps();
+
+        for (int j = 0; j < 4; j++)
         {
-            if (bones[i].parent > i)
-            {
-                TRACELOG(LOG_WARNING, "Assumes bones are toplogically sorted, but bone %d has parent %d. Skipping.", i, bones[i].parent);
-                continue;
-            }
-            transforms[i].rotation = RLQuaternionMultiply(transforms[bones[i].parent].rotation, transforms[i].rotation);
-            transforms[i].translation = RLVector3RotateByQuaternion(transforms[i].translation, transforms[bones[i].parent].rotation);
-            transforms[i].translation = RLVector3Add(transforms[i].translation, transforms[bones[i].parent].translation);
-            transforms[i].scale = RLVector3Multiply(transforms[i].scale, transforms[bones[i].parent].scale);
+            if (weights[j] == 0.0f) continue;
+
+            const float *bone = job->palette + ids[j]*12;
+            __m128 weight = _mm_set1_ps(weights[j]);
+            row0 = _mm_add_ps(row0, _mm_mul_ps(weight, _mm_loadu_ps(bone)));
+            row1 = _mm_add_ps(row1, _mm_mul_ps(weight, _mm_loadu_ps(bone + 4)));
+            row2 = _mm_add_ps(row2, _mm_mul_ps(weight, _mm_loadu_ps(bone + 8)));
+        }
+
+        float res[4];
+        __m128 vec = _mm_setr_ps(position[0], position[1], position[2], 1.0f);
+        __m128 x = _mm_mul_ps(row0, vec);
+        __m128 y = _mm_mul_ps(row1, vec);
+        __m128 z = _mm_mul_ps(row2, vec);
+        __m128 w = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+        _mm_storeu_ps(res, _mm_add_ps(_mm_add_ps(x, y), _mm_add_ps(z, w)));
+        animPosition[0] = res[0];
+        animPosition[1] = res[1];
+        animPosition[2] = res[2];
+
+        if (job->normals != NULL)
+        {
+            const float *normal = job->normals + v*3;
+            float *animNormal = job->animNormals + v*3;
+
+            vec = _mm_setr_ps(normal[0], normal[1], normal[2], 0.0f);
+            x = _mm_mul_ps(row0, vec);
+            y = _mm_mul_ps(row1, vec);
+            z = _mm_mul_ps(row2, vec);
+            w = _mm_setzero_ps();
+            _MM_TRANSPOSE4_PS(x, y, z, w);
+            _mm_storeu_ps(res, _mm_add_ps(_mm_add_ps(x, y), _mm_add_ps(z, w)));
+            animNormal[0] = res[0];
+            animNormal[1] = res[1];
+            animNormal[2] = res[2];
+        }
+#elif defined(RL_SKINNING_NEON)
+        float32x4_t row0 = vdupq_n_f32(0.0f);
+        float32x4_t row1 = vdupq_n_f32(0.0f);
+        float32x4_t row2 = vdupq_n_f32(0.0f);
+
+        for (int j = 0; j < 4; j++)
+        {
+            if (weights[j] == 0.0f) continue;
+
+            const float *bone = job->palette + ids[j]*12;
+            row0 = vmlaq_n_f32(row0, vld1q_f32(bone), weights[j]);
+            row1 = vmlaq_n_f32(row1, vld1q_f32(bone + 4), weights[j]);
+            row2 = vmlaq_n_f32(row2, vld1q_f32(bone + 8), weights[j]);
+        }
+
+        float vec[4] = { position[0], position[1], position[2], 1.0f };
+        float32x4_t pos = vld1q_f32(vec);
+        animPosition[0] = vaddvq_f32(vmulq_f32(row0, pos));
+        animPosition[1] = vaddvq_f32(vmulq_f32(row1, pos));
+        animPosition[2] = vaddvq_f32(vmulq_f32(row2, pos));
+
+        if (job->normals != NULL)
+        {
+            const float *normal = job->normals + v*3;
+            float *animNormal = job->animNormals + v*3;
+
+            vec[0] = normal[0]; vec[1] = normal[1]; vec[2] = normal[2]; vec[3] = 0.0f;
+            pos = vld1q_f32(vec);
+            animNormal[0] = vaddvq_f32(vmulq_f32(row0, pos));
+            animNormal[1] = vaddvq_f32(vmulq_f32(row1, pos));
+            animNormal[2] = vaddvq_f32(vmulq_f32(row2, pos));
+        }
+#else
+        float mat[12] = { 0 };
+
+        for (int j = 0; j < 4; j++)
+        {
+            if (weights[j] == 0.0f) continue;
+
+            const float *bone = job->palette + ids[j]*12;
+            for (int k = 0; k < 12; k++) mat[k] += weights[j]*bone[k];
+        }
+
+        animPosition[0] = mat[0]*position[0] + mat[1]*position[1] + mat[2]*position[2] + mat[3];
+        animPosition[1] = mat[4]*position[0] + mat[5]*position[1] + mat[6]*position[2] + mat[7];
+        animPosition[2] = mat[8]*position[0] + mat[9]*position[1] + mat[10]*position[2] + mat[11];
+
+        if (job->normals != NULL)
+        {
+            const float *normal = job->normals + v*3;
+            float *animNormal = job->animNormals + v*3;
+
+            animNormal[0] = mat[0]*normal[0] + mat[1]*normal[1] + mat[2]*normal[2];
+            animNormal[1] = mat[4]*normal[0] + mat[5]*normal[1] + mat[6]*normal[2];
+            animNormal[2] = mat[8]*normal[0] + mat[9]*normal[1] + mat[10]*normal[2];
         }
+#endif
     }
 }
-#endif
 
 #if defined(SUPPORT_FILEFORMAT_OBJ)
 // Load OBJ mesh data
@@ -4437,9 +6307,8 @@ static Model RLLoadIQM(const char *fileName)
     #define MESH_NAME_LENGTH    32          // Mesh name string length
     #define MATERIAL_NAME_LENGTH 32         // Material name string length
 
-    int dataSize = 0;
-    unsigned char *fileData = RLLoadFileData(fileName, &dataSize);
-    unsigned char *fileDataPtr = fileData;
+    MappedFile file = RLLoadMappedFile(fileName);
+    const unsigned char *fileDataPtr = file.data;
 
     // IQM file structs
     //-----------------------------------------------------------------------------------
@@ -4541,20 +6410,29 @@ static Model RLLoadIQM(const char *fileName)
     // In case file can not be read, return an empty model
     if (fileDataPtr == NULL) return model;
 
+    if (file.size < (long long)sizeof(IQMHeader))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
+        RLUnloadMappedFile(file);
+        return model;
+    }
+
     const char *basePath = RLGetDirectoryPath(fileName);
 
     // Read IQM header
-    IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
+    const IQMHeader *iqmHeader = (const IQMHeader *)fileDataPtr;
 
     if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
+        RLUnloadMappedFile(file);
         return model;
     }
 
     if (iqmHeader->version != IQM_VERSION)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
+        RLUnloadMappedFile(file);
         return model;
     }
 
@@ -4798,7 +6676,7 @@ static Model RLLoadIQM(const char *fileName)
         }
     }
 
-    RLUnloadFileData(fileData);
+    RLUnloadMappedFile(file);
 
     RL_FREE(imesh);
     RL_FREE(tri);
@@ -4820,9 +6698,8 @@ static ModelAnimation * RLLoadModelAnimationsIQM(const char *fileName, int *anim
     #define IQM_MAGIC       "INTERQUAKEMODEL"   // IQM file magic number
     #define IQM_VERSION     2                   // only IQM version 2 supported
 
-    int dataSize = 0;
-    unsigned char *fileData = RLLoadFileData(fileName, &dataSize);
-    unsigned char *fileDataPtr = fileData;
+    MappedFile file = RLLoadMappedFile(fileName);
+    const unsigned char *fileDataPtr = file.data;
 
     typedef struct IQMHeader {
         char magic[16];
@@ -4864,18 +6741,27 @@ static ModelAnimation * RLLoadModelAnimationsIQM(const char *fileName, int *anim
     // In case file can not be read, return an empty model
     if (fileDataPtr == NULL) return NULL;
 
+    if (file.size < (long long)sizeof(IQMHeader))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
+        RLUnloadMappedFile(file);
+        return NULL;
+    }
+
     // Read IQM header
-    IQMHeader *iqmHeader = (IQMHeader *)fileDataPtr;
+    const IQMHeader *iqmHeader = (const IQMHeader *)fileDataPtr;
 
     if (memcmp(iqmHeader->magic, IQM_MAGIC, sizeof(IQM_MAGIC)) != 0)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file is not a valid model", fileName);
+        RLUnloadMappedFile(file);
         return NULL;
     }
 
     if (iqmHeader->version != IQM_VERSION)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] IQM file version not supported (%i)", fileName, iqmHeader->version);
+        RLUnloadMappedFile(file);
         return NULL;
     }
 
@@ -5032,7 +6918,7 @@ static ModelAnimation * RLLoadModelAnimationsIQM(const char *fileName, int *anim
         }
     }
 
-    RLUnloadFileData(fileData);
+    RLUnloadMappedFile(file);
 
     RL_FREE(joints);
     RL_FREE(framedata);
@@ -5046,15 +6932,33 @@ static ModelAnimation * RLLoadModelAnimationsIQM(const char *fileName, int *anim
 
 #if defined(SUPPORT_FILEFORMAT_GLTF)
 // Load file data callback for cgltf
+// NOTE: Files are mapped in memory and registered on mapped files list (provided as user data),
+// buffers data is only read by cgltf and raylib, never written
 static cgltf_result RLLoadFileGLTFCallback(const struct cgltf_memory_options *memoryOptions, const struct cgltf_file_options *fileOptions, const char *path, cgltf_size *size, void **data)
 {
-    int filesize;
-    unsigned char *filedata = RLLoadFileData(path, &filesize);
+    MappedFilesGLTF *mapped = (MappedFilesGLTF *)fileOptions->user_data;
+    MappedFile file = RLLoadMappedFile(path);
+
+    if (!RLIsMappedFileValid(file) || (mapped == NULL))
+    {
+        RLUnloadMappedFile(file);
+        return cgltf_result_io_error;
+    }
 
-    if (filedata == NULL) return cgltf_result_io_error;
+    MappedFile *files = (MappedFile *)RL_REALLOC(mapped->files, (mapped->count + 1)*sizeof(MappedFile));
 
-    *size = filesize;
-    *data = filedata;
+    if (files == NULL)
+    {
+        RLUnloadMappedFile(file);
+        return cgltf_result_out_of_memory;
+    }
+
+    mapped->files = files;
+    mapped->files[mapped->count] = file;
+    mapped->count++;
+
+    *size = (cgltf_size)file.size;
+    *data = (void *)file.data;
 
     return cgltf_result_success;
 }
@@ -5062,7 +6966,18 @@ static cgltf_result RLLoadFileGLTFCallback(const struct cgltf_memory_options *me
 // Release file data callback for cgltf
 static void RLReleaseFileGLTFCallback(const struct cgltf_memory_options *memoryOptions, const struct cgltf_file_options *fileOptions, void *data)
 {
-    RLUnloadFileData(data);
+    MappedFilesGLTF *mapped = (MappedFilesGLTF *)fileOptions->user_data;
+
+    for (int i = 0; (mapped != NULL) && (i < mapped->count); i++)
+    {
+        if (mapped->files[i].data == data)
+        {
+            RLUnloadMappedFile(mapped->files[i]);
+            mapped->files[i] = mapped->files[mapped->count - 1];
+            mapped->count--;
+            break;
+        }
+    }
 }
 
 // Load image from different glTF provided methods (uri, path, buffer_view)
@@ -5144,6 +7059,12 @@ static BoneInfo * RLLoadBoneInfoGLTF(cgltf_skin skin, int *boneCount)
     *boneCount = (int)skin.joints_count;
     BoneInfo *bones = RL_MALLOC(skin.joints_count*sizeof(BoneInfo));
 
+    if (bones == NULL)
+    {
+        *boneCount = 0;
+        return NULL;
+    }
+
     for (unsigned int i = 0; i < skin.joints_count; i++)
     {
         cgltf_node node = *skin.joints[i];
@@ -5224,18 +7145,23 @@ static Model RLLoadGLTF(const char *fileName)
 
     Model model = { 0 };
 
-    // glTF file loading
-    int dataSize = 0;
-    unsigned char *fileData = RLLoadFileData(fileName, &dataSize);
+    // glTF file mapping, binary chunk (glb) data is read directly from file data
+    MappedFile file = RLLoadMappedFile(fileName);
 
-    if (fileData == NULL) return model;
+    if (!RLIsMappedFileValid(file))
+    {
+        RLUnloadMappedFile(file);
+        return model;
+    }
 
     // glTF data loading
+    MappedFilesGLTF mapped = { 0 };
     cgltf_options options = { 0 };
     options.file.read = RLLoadFileGLTFCallback;
     options.file.release = RLReleaseFileGLTFCallback;
+    options.file.user_data = &mapped;
     cgltf_data *data = NULL;
-    cgltf_result result = cgltf_parse(&options, fileData, dataSize, &data);
+    cgltf_result result = cgltf_parse(&options, file.data, (cgltf_size)file.size, &data);
 
     if (result == cgltf_result_success)
     {
@@ -5903,166 +7829,236 @@ static Model RLLoadGLTF(const char *fileName)
     else TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
 
     // WARNING: cgltf requires the file pointer available while reading data
-    RLUnloadFileData(fileData);
+    RLUnloadMappedFile(file);
+    RL_FREE(mapped.files);
 
     return model;
 }
 
-// Get interpolated pose for bone sampler at a specific time. Returns true on success
-static bool RLGetPoseAtTimeGLTF(cgltf_interpolation_type interpolationType, cgltf_accessor *input, cgltf_accessor *output, float time, void *data)
+#ifndef GLTF_ANIMDELAY
+    #define GLTF_ANIMDELAY 17    // Animation frames delay, (~1000 ms/60 FPS = 16.666666* ms)
+#endif
+#ifndef GLTF_ANIM_BATCH_BONES
+    #define GLTF_ANIM_BATCH_BONES 4     // Animation bones baked per worker batch, all frames of every bone
+#endif
+#ifndef GLTF_ANIM_BATCH_FRAMES
+    #define GLTF_ANIM_BATCH_FRAMES 64   // Animation frames built from parent joints per worker batch
+#endif
+
+// Load glTF animation sampler keyframes, input times and output values unpacked to floats
+// NOTE: Only float output values are supported, returns false if sampler data is not valid
+static bool RLLoadAnimSamplerGLTF(const cgltf_animation_sampler *sampler, AnimSamplerGLTF *result)
 {
-    if (interpolationType >= cgltf_interpolation_type_max_enum) return false;
+    const cgltf_accessor *input = sampler->input;
+    const cgltf_accessor *output = sampler->output;
 
-    // Input and output should have the same count
-    float tstart = 0.0f;
-    float tend = 0.0f;
-    int keyframe = 0;       // Defaults to first pose
+    int components = 0;
+    if (output->type == cgltf_type_vec3) components = 3;
+    else if (output->type == cgltf_type_vec4) components = 4;   // Only v4 is for rotations, so we know it's a quaternion
 
-    for (int i = 0; i < (int)input->count - 1; i++)
+    int keyCount = (int)input->count;
+    int valuesPerKey = (sampler->interpolation == cgltf_interpolation_type_cubic_spline)? 3 : 1;
+
+    if ((sampler->interpolation >= cgltf_interpolation_type_max_enum) || (keyCount == 0) || (components == 0) ||
+        (input->type != cgltf_type_scalar) || (output->component_type != cgltf_component_type_r_32f) ||
+        ((int)output->count < keyCount*valuesPerKey)) return false;
+
+    // NOTE: Output is fully unpacked, sparse accessors values could be written anywhere on it
+    int outputCount = (int)output->count*components;
+    float *times = (float *)RL_MALLOC((keyCount + outputCount)*sizeof(float));
+    if (times == NULL) return false;
+
+    if ((cgltf_accessor_unpack_floats(input, times, keyCount) != (cgltf_size)keyCount) ||
+        (cgltf_accessor_unpack_floats(output, times + keyCount, outputCount) != (cgltf_size)outputCount))
     {
-        cgltf_bool r1 = cgltf_accessor_read_float(input, i, &tstart, 1);
-        if (!r1) return false;
+        RL_FREE(times);
+        return false;
+    }
 
-        cgltf_bool r2 = cgltf_accessor_read_float(input, i + 1, &tend, 1);
-        if (!r2) return false;
+    result->interpolation = sampler->interpolation;
+    result->keyCount = keyCount;
+    result->components = components;
+    result->times = times;
+    result->values = times + keyCount;
 
-        if ((tstart <= time) && (time < tend))
-        {
-            keyframe = i;
-            break;
-        }
+    return true;
+}
+
+// Get glTF animation sampler value at a specific time
+// NOTE: Cursor keeps last keyframe found, so times requested in ascending order are found in constant time,
+// out of keyframes range times hold first or last keyframe value
+static void RLGetAnimSamplerValueGLTF(const AnimSamplerGLTF *sampler, float time, int *cursor, float *value)
+{
+    const float *times = sampler->times;
+    int components = sampler->components;
+    int last = sampler->keyCount - 1;
+
+    // Keyframe values stride and value offset, cubic spline keyframes include in and out tangents
+    bool cubic = (sampler->interpolation == cgltf_interpolation_type_cubic_spline);
+    int stride = cubic? 3*components : components;
+    int offset = cubic? components : 0;
+
+    if ((last == 0) || (time <= times[0]))
+    {
+        memcpy(value, sampler->values + offset, components*sizeof(float));
+        return;
+    }
+
+    if (time >= times[last])
+    {
+        memcpy(value, sampler->values + last*stride + offset, components*sizeof(float));
+        return;
     }
 
-    // Constant animation, no need to interpolate
-    if (RLFloatEquals(tend, tstart)) return true;
+    // Find keyframe: times[keyframe] <= time < times[keyframe + 1]
+    int keyframe = *cursor;
+    if ((keyframe >= last) || (times[keyframe] > time)) keyframe = 0;   // Time going backwards, search again
+    while (times[keyframe + 1] <= time) keyframe++;
+    *cursor = keyframe;
 
-    float duration = fmaxf((tend - tstart), EPSILON);
-    float t = (time - tstart)/duration;
+    float duration = fmaxf((times[keyframe + 1] - times[keyframe]), EPSILON);
+    float t = (time - times[keyframe])/duration;
     t = (t < 0.0f)? 0.0f : t;
     t = (t > 1.0f)? 1.0f : t;
 
-    if (output->component_type != cgltf_component_type_r_32f) return false;
+    const float *key1 = sampler->values + keyframe*stride;
+    const float *key2 = key1 + stride;
 
-    if (output->type == cgltf_type_vec3)
+    if (components == 3)
     {
-        switch (interpolationType)
-        {
-            case cgltf_interpolation_type_step:
-            {
-                float tmp[3] = { 0.0f };
-                cgltf_accessor_read_float(output, keyframe, tmp, 3);
-                Vector3 v1 = {tmp[0], tmp[1], tmp[2]};
-                Vector3 *r = data;
+        Vector3 v1 = { key1[offset], key1[offset + 1], key1[offset + 2] };
+        Vector3 v2 = { key2[offset], key2[offset + 1], key2[offset + 2] };
+        Vector3 result = v1;
 
-                *r = v1;
-            } break;
-            case cgltf_interpolation_type_linear:
-            {
-                float tmp[3] = { 0.0f };
-                cgltf_accessor_read_float(output, keyframe, tmp, 3);
-                Vector3 v1 = {tmp[0], tmp[1], tmp[2]};
-                cgltf_accessor_read_float(output, keyframe+1, tmp, 3);
-                Vector3 v2 = {tmp[0], tmp[1], tmp[2]};
-                Vector3 *r = data;
-
-                *r = RLVector3Lerp(v1, v2, t);
-            } break;
+        switch (sampler->interpolation)
+        {
+            case cgltf_interpolation_type_linear: result = RLVector3Lerp(v1, v2, t); break;
             case cgltf_interpolation_type_cubic_spline:
             {
-                float tmp[3] = { 0.0f };
-                cgltf_accessor_read_float(output, 3*keyframe+1, tmp, 3);
-                Vector3 v1 = {tmp[0], tmp[1], tmp[2]};
-                cgltf_accessor_read_float(output, 3*keyframe+2, tmp, 3);
-                Vector3 tangent1 = {tmp[0], tmp[1], tmp[2]};
-                cgltf_accessor_read_float(output, 3*(keyframe+1)+1, tmp, 3);
-                Vector3 v2 = {tmp[0], tmp[1], tmp[2]};
-                cgltf_accessor_read_float(output, 3*(keyframe+1), tmp, 3);
-                Vector3 tangent2 = {tmp[0], tmp[1], tmp[2]};
-                Vector3 *r = data;
-
-                *r = RLVector3CubicHermite(v1, tangent1, v2, tangent2, t);
+                Vector3 tangent1 = { key1[2*components], key1[2*components + 1], key1[2*components + 2] };
+                Vector3 tangent2 = { key2[0], key2[1], key2[2] };
+
+                result = RLVector3CubicHermite(v1, tangent1, v2, tangent2, t);
             } break;
             default: break;
         }
+
+        value[0] = result.x;
+        value[1] = result.y;
+        value[2] = result.z;
     }
-    else if (output->type == cgltf_type_vec4)
+    else
     {
-        // Only v4 is for rotations, so we know it's a quaternion
-        switch (interpolationType)
-        {
-            case cgltf_interpolation_type_step:
-            {
-                float tmp[4] = { 0.0f };
-                cgltf_accessor_read_float(output, keyframe, tmp, 4);
-                Vector4 v1 = {tmp[0], tmp[1], tmp[2], tmp[3]};
-                Vector4 *r = data;
+        Vector4 v1 = { key1[offset], key1[offset + 1], key1[offset + 2], key1[offset + 3] };
+        Vector4 v2 = { key2[offset], key2[offset + 1], key2[offset + 2], key2[offset + 3] };
+        Vector4 result = v1;
 
-                *r = v1;
-            } break;
-            case cgltf_interpolation_type_linear:
-            {
-                float tmp[4] = { 0.0f };
-                cgltf_accessor_read_float(output, keyframe, tmp, 4);
-                Vector4 v1 = {tmp[0], tmp[1], tmp[2], tmp[3]};
-                cgltf_accessor_read_float(output, keyframe+1, tmp, 4);
-                Vector4 v2 = {tmp[0], tmp[1], tmp[2], tmp[3]};
-                Vector4 *r = data;
-
-                *r = RLQuaternionSlerp(v1, v2, t);
-            } break;
+        switch (sampler->interpolation)
+        {
+            case cgltf_interpolation_type_linear: result = RLQuaternionSlerp(v1, v2, t); break;
             case cgltf_interpolation_type_cubic_spline:
             {
-                float tmp[4] = { 0.0f };
-                cgltf_accessor_read_float(output, 3*keyframe+1, tmp, 4);
-                Vector4 v1 = {tmp[0], tmp[1], tmp[2], tmp[3]};
-                cgltf_accessor_read_float(output, 3*keyframe+2, tmp, 4);
-                Vector4 outTangent1 = {tmp[0], tmp[1], tmp[2], 0.0f};
-                cgltf_accessor_read_float(output, 3*(keyframe+1)+1, tmp, 4);
-                Vector4 v2 = {tmp[0], tmp[1], tmp[2], tmp[3]};
-                cgltf_accessor_read_float(output, 3*(keyframe+1), tmp, 4);
-                Vector4 inTangent2 = {tmp[0], tmp[1], tmp[2], 0.0f};
-                Vector4 *r = data;
+                Vector4 outTangent1 = { key1[2*components], key1[2*components + 1], key1[2*components + 2], 0.0f };
+                Vector4 inTangent2 = { key2[0], key2[1], key2[2], 0.0f };
 
                 v1 = RLQuaternionNormalize(v1);
                 v2 = RLQuaternionNormalize(v2);
 
-                if (RLVector4DotProduct(v1, v2) < 0.0f)
-                {
-                    v2 = RLVector4Negate(v2);
-                }
+                if (RLVector4DotProduct(v1, v2) < 0.0f) v2 = RLVector4Negate(v2);
 
                 outTangent1 = RLVector4Scale(outTangent1, duration);
                 inTangent2 = RLVector4Scale(inTangent2, duration);
 
-                *r = RLQuaternionCubicHermiteSpline(v1, outTangent1, v2, inTangent2, t);
+                result = RLQuaternionCubicHermiteSpline(v1, outTangent1, v2, inTangent2, t);
             } break;
             default: break;
         }
+
+        value[0] = result.x;
+        value[1] = result.y;
+        value[2] = result.z;
+        value[3] = result.w;
     }
+}
 
-    return true;
+// Bake glTF animations bones local transforms for all frames (job callback)
+// NOTE: Items are animations bones: animation*boneCount + bone
+static void RLBakeAnimationBonesGLTF(void *userData, int start, int end, int worker)
+{
+    AnimBakeJobGLTF *job = (AnimBakeJobGLTF *)userData;
+
+    for (int i = start; i < end; i++)
+    {
+        ModelAnimation *animation = &job->animations[i/job->boneCount];
+        const AnimSamplerGLTF *samplers = &job->samplers[3*i];
+        int bone = i%job->boneCount;
+        int cursors[3] = { 0 };
+
+        for (int frame = 0; frame < animation->frameCount; frame++)
+        {
+            float time = ((float)frame*GLTF_ANIMDELAY)/1000.0f;
+            Transform pose = job->restPose[bone];
+            float value[4] = { 0 };
+
+            if (samplers[0].keyCount > 0)
+            {
+                RLGetAnimSamplerValueGLTF(&samplers[0], time, &cursors[0], value);
+                pose.translation = (Vector3){ value[0], value[1], value[2] };
+            }
+
+            if (samplers[1].keyCount > 0)
+            {
+                RLGetAnimSamplerValueGLTF(&samplers[1], time, &cursors[1], value);
+                pose.rotation = (Quaternion){ value[0], value[1], value[2], value[3] };
+            }
+
+            if (samplers[2].keyCount > 0)
+            {
+                RLGetAnimSamplerValueGLTF(&samplers[2], time, &cursors[2], value);
+                pose.scale = (Vector3){ value[0], value[1], value[2] };
+            }
+
+            animation->framePoses[frame][bone] = pose;
+        }
+    }
 }
 
-#define GLTF_ANIMDELAY 17    // Animation frames delay, (~1000 ms/60 FPS = 16.666666* ms)
+// Build glTF animations frame poses from parent joints (job callback)
+// NOTE: Items are all animations frames, consecutive
+static void RLBuildAnimationFramesGLTF(void *userData, int start, int end, int worker)
+{
+    AnimBakeJobGLTF *job = (AnimBakeJobGLTF *)userData;
+    int animation = 0;
+
+    for (int i = start; i < end; i++)
+    {
+        while (job->firstFrame[animation + 1] <= i) animation++;
+
+        ModelAnimation *anim = &job->animations[animation];
+        RLBuildPoseFromParentJoints(anim->bones, anim->boneCount, anim->framePoses[i - job->firstFrame[animation]]);
+    }
+}
 
 static ModelAnimation * RLLoadModelAnimationsGLTF(const char *fileName, int *animCount)
 {
-    // glTF file loading
-    int dataSize = 0;
-    unsigned char *fileData = RLLoadFileData(fileName, &dataSize);
+    // glTF file mapping
+    MappedFile file = RLLoadMappedFile(fileName);
 
     ModelAnimation *animations = NULL;
 
     // glTF data loading
+    MappedFilesGLTF mapped = { 0 };
     cgltf_options options = { 0 };
     options.file.read = RLLoadFileGLTFCallback;
     options.file.release = RLReleaseFileGLTFCallback;
+    options.file.user_data = &mapped;
     cgltf_data *data = NULL;
-    cgltf_result result = cgltf_parse(&options, fileData, dataSize, &data);
+    cgltf_result result = cgltf_parse(&options, file.data, (cgltf_size)file.size, &data);
 
     if (result != cgltf_result_success)
     {
         TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
+        RLUnloadMappedFile(file);
         *animCount = 0;
         return NULL;
     }
@@ -6075,23 +8071,43 @@ static ModelAnimation * RLLoadModelAnimationsGLTF(const char *fileName, int *ani
         if (data->skins_count > 0)
         {
             cgltf_skin skin = data->skins[0];
+            int boneCount = (int)skin.joints_count;
             *animCount = (int)data->animations_count;
-            animations = RL_MALLOC(data->animations_count*sizeof(ModelAnimation));
+            animations = RL_CALLOC(data->animations_count, sizeof(ModelAnimation));
 
-            for (unsigned int i = 0; i < data->animations_count; i++)
+            // Keyframes of all animations are unpacked once and bones baked in parallel,
+            // every bone channel keeps its own keyframe cursor, so baking cost is linear on frames and keyframes
+            AnimBakeJobGLTF job = { 0 };
+            job.animations = animations;
+            job.boneCount = boneCount;
+            job.samplers = RL_CALLOC(data->animations_count*boneCount*3, sizeof(AnimSamplerGLTF));
+            job.firstFrame = RL_CALLOC(data->animations_count + 1, sizeof(int));
+
+            Transform *restPose = RL_MALLOC(boneCount*sizeof(Transform));
+
+            // NOTE: Partly built animations are unloaded on allocation failure, animations frame poses are cleared to be freed safely
+            bool failed = (data->animations_count > 0) && ((animations == NULL) || (job.samplers == NULL) || (job.firstFrame == NULL) || (restPose == NULL));
+
+            for (int k = 0; (k < boneCount) && !failed; k++)
             {
-                animations[i].bones = RLLoadBoneInfoGLTF(skin, &animations[i].boneCount);
+                restPose[k].translation = (Vector3){ skin.joints[k]->translation[0], skin.joints[k]->translation[1], skin.joints[k]->translation[2] };
+                restPose[k].rotation = (Quaternion){ skin.joints[k]->rotation[0], skin.joints[k]->rotation[1], skin.joints[k]->rotation[2], skin.joints[k]->rotation[3] };
+                restPose[k].scale = (Vector3){ skin.joints[k]->scale[0], skin.joints[k]->scale[1], skin.joints[k]->scale[2] };
+            }
+            job.restPose = restPose;
 
-                cgltf_animation animData = data->animations[i];
+            for (unsigned int i = 0; (i < data->animations_count) && !failed; i++)
+            {
+                animations[i].bones = RLLoadBoneInfoGLTF(skin, &animations[i].boneCount);
 
-                struct Channels {
-                    cgltf_animation_channel *translate;
-                    cgltf_animation_channel *rotate;
-                    cgltf_animation_channel *scale;
-                    cgltf_interpolation_type interpolationType;
-                };
+                if (animations[i].bones == NULL)
+                {
+                    failed = true;
+                    break;
+                }
 
-                struct Channels *boneChannels = RL_CALLOC(animations[i].boneCount, sizeof(struct Channels));
+                cgltf_animation animData = data->animations[i];
+                AnimSamplerGLTF *boneSamplers = &job.samplers[i*boneCount*3];
                 float animDuration = 0.0f;
 
                 for (unsigned int j = 0; j < animData.channels_count; j++)
@@ -6114,22 +8130,13 @@ static ModelAnimation * RLLoadModelAnimationsGLTF(const char *fileName, int *ani
                         continue;
                     }
 
-                    boneChannels[boneIndex].interpolationType = animData.channels[j].sampler->interpolation;
+                    int path = -1;      // Bone sampler: 0 - translation, 1 - rotation, 2 - scale
 
                     if (animData.channels[j].sampler->interpolation != cgltf_interpolation_type_max_enum)
                     {
-                        if (channel.target_path == cgltf_animation_path_type_translation)
-                        {
-                            boneChannels[boneIndex].translate = &animData.channels[j];
-                        }
-                        else if (channel.target_path == cgltf_animation_path_type_rotation)
-                        {
-                            boneChannels[boneIndex].rotate = &animData.channels[j];
-                        }
-                        else if (channel.target_path == cgltf_animation_path_type_scale)
-                        {
-                            boneChannels[boneIndex].scale = &animData.channels[j];
-                        }
+                        if (channel.target_path == cgltf_animation_path_type_translation) path = 0;
+                        else if (channel.target_path == cgltf_animation_path_type_rotation) path = 1;
+                        else if (channel.target_path == cgltf_animation_path_type_scale) path = 2;
                         else
                         {
                             TRACELOG(LOG_WARNING, "MODEL: [%s] Unsupported target_path on channel %d's sampler for animation %d. Skipping.", fileName, j, i);
@@ -6137,6 +8144,18 @@ static ModelAnimation * RLLoadModelAnimationsGLTF(const char *fileName, int *ani
                     }
                     else TRACELOG(LOG_WARNING, "MODEL: [%s] Invalid interpolation curve encountered for GLTF animation.", fileName);
 
+                    if (path >= 0)
+                    {
+                        AnimSamplerGLTF *sampler = &boneSamplers[boneIndex*3 + path];
+                        RL_FREE(sampler->times);    // Channel targeting same bone path, last one is used
+                        *sampler = (AnimSamplerGLTF){ 0 };
+
+                        if (!RLLoadAnimSamplerGLTF(channel.sampler, sampler))
+                        {
+                            TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load channel %d pose data for bone %s", fileName, j, animations[i].bones[boneIndex].name);
+                        }
+                    }
+
                     float t = 0.0f;
                     cgltf_bool r = cgltf_accessor_read_float(channel.sampler->input, channel.sampler->input->count - 1, &t, 1);
 
@@ -6156,55 +8175,49 @@ static ModelAnimation * RLLoadModelAnimationsGLTF(const char *fileName, int *ani
                 }
 
                 animations[i].frameCount = (int)(animDuration*1000.0f/GLTF_ANIMDELAY) + 1;
-                animations[i].framePoses = RL_MALLOC(animations[i].frameCount*sizeof(Transform *));
+                animations[i].framePoses = RL_CALLOC(animations[i].frameCount, sizeof(Transform *));
+
+                if (animations[i].framePoses == NULL)
+                {
+                    animations[i].frameCount = 0;
+                    failed = true;
+                    break;
+                }
 
                 for (int j = 0; j < animations[i].frameCount; j++)
                 {
                     animations[i].framePoses[j] = RL_MALLOC(animations[i].boneCount*sizeof(Transform));
-                    float time = ((float) j*GLTF_ANIMDELAY)/1000.0f;
+                    if (animations[i].framePoses[j] == NULL) failed = true;
+                }
 
-                    for (int k = 0; k < animations[i].boneCount; k++)
-                    {
-                        Vector3 translation = {skin.joints[k]->translation[0], skin.joints[k]->translation[1], skin.joints[k]->translation[2]};
-                        Quaternion rotation = {skin.joints[k]->rotation[0], skin.joints[k]->rotation[1], skin.joints[k]->rotation[2], skin.joints[k]->rotation[3]};
-                        Vector3 scale = {skin.joints[k]->scale[0], skin.joints[k]->scale[1], skin.joints[k]->scale[2]};
+                if (failed) break;
 
-                        if (boneChannels[k].translate)
-                        {
-                            if (!RLGetPoseAtTimeGLTF(boneChannels[k].interpolationType, boneChannels[k].translate->sampler->input, boneChannels[k].translate->sampler->output, time, &translation))
-                            {
-                                TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load translate pose data for bone %s", fileName, animations[i].bones[k].name);
-                            }
-                        }
+                job.firstFrame[i + 1] = job.firstFrame[i] + animations[i].frameCount;
 
-                        if (boneChannels[k].rotate)
-                        {
-                            if (!RLGetPoseAtTimeGLTF(boneChannels[k].interpolationType, boneChannels[k].rotate->sampler->input, boneChannels[k].rotate->sampler->output, time, &rotation))
-                            {
-                                TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load rotate pose data for bone %s", fileName, animations[i].bones[k].name);
-                            }
-                        }
+                TRACELOG(LOG_INFO, "MODEL: [%s] Loaded animation: %s (%d frames, %fs)", fileName, (animData.name != NULL)? animData.name : "NULL", animations[i].frameCount, animDuration);
+            }
 
-                        if (boneChannels[k].scale)
-                        {
-                            if (!RLGetPoseAtTimeGLTF(boneChannels[k].interpolationType, boneChannels[k].scale->sampler->input, boneChannels[k].scale->sampler->output, time, &scale))
-                            {
-                                TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load scale pose data for bone %s", fileName, animations[i].bones[k].name);
-                            }
-                        }
+            if (!failed)
+            {
+                RLParallelFor((int)data->animations_count*boneCount, GLTF_ANIM_BATCH_BONES, RLBakeAnimationBonesGLTF, &job);
+                RLParallelFor(job.firstFrame[data->animations_count], GLTF_ANIM_BATCH_FRAMES, RLBuildAnimationFramesGLTF, &job);
+            }
 
-                        animations[i].framePoses[j][k] = (Transform){
-                            .translation = translation,
-                            .rotation = rotation,
-                            .scale = scale
-                        };
-                    }
+            if (job.samplers != NULL)
+            {
+                for (unsigned int i = 0; i < data->animations_count*boneCount*3; i++) RL_FREE(job.samplers[i].times);
+            }
 
-                    RLBuildPoseFromParentJoints(animations[i].bones, animations[i].boneCount, animations[i].framePoses[j]);
-                }
+            RL_FREE(job.samplers);
+            RL_FREE(job.firstFrame);
+            RL_FREE(restPose);
 
-                TRACELOG(LOG_INFO, "MODEL: [%s] Loaded animation: %s (%d frames, %fs)", fileName, (animData.name != NULL)? animData.name : "NULL", animations[i].frameCount, animDuration);
-                RL_FREE(boneChannels);
+            if (failed)
+            {
+                TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to allocate memory for animations", fileName);
+                if (animations != NULL) RLUnloadModelAnimations(animations, (int)data->animations_count);
+                animations = NULL;
+                *animCount = 0;
             }
         }
 
@@ -6212,10 +8225,11 @@ static ModelAnimation * RLLoadModelAnimationsGLTF(const char *fileName, int *ani
         {
             TRACELOG(LOG_WARNING, "MODEL: [%s] expected exactly one skin to load animation data from, but found %i", fileName, data->skins_count);
         }
-
-        cgltf_free(data);
     }
-    RLUnloadFileData(fileData);
+
+    cgltf_free(data);     // NOTE: Also unloads buffers files mapped before a buffers loading failure
+    RLUnloadMappedFile(file);
+    RL_FREE(mapped.files);
     return animations;
 }
 #endif
@@ -6680,7 +8694,9 @@ static Model RLLoadM3D(const char *fileName)
     return model;
 }
 
-#define M3D_ANIMDELAY 17    // Animation frames delay, (~1000 ms/60 FPS = 16.666666* ms)
+#ifndef M3D_ANIMDELAY
+    #define M3D_ANIMDELAY 17    // Animation frames delay, (~1000 ms/60 FPS = 16.666666* ms)
+#endif
 
 // Load M3D animation data
 static ModelAnimation * RLLoadModelAnimationsM3D(const char *fileName, int *animCount)
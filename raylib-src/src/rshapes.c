@@ -678,6 +678,13 @@ void RLDrawRectangleRec(Rectangle rec, Color color)
     RLDrawRectanglePro(rec, (Vector2){ 0.0f, 0.0f }, 0.0f, color);
 }
 
+// Queue a color-filled rectangle on sprite queue
+// NOTE: Rectangle uses shapes texture, so it can be batched together with other shapes texture sprites
+void RLQueueRectangle(SpriteQueue queue, Rectangle rec, Color color)
+{
+    RLQueueTexturePro(queue, texShapes, texShapesRec, rec, (Vector2){ 0.0f, 0.0f }, 0.0f, color);
+}
+
 // Draw a color-filled rectangle with pro parameters
 void RLDrawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color)
 {
@@ -93,6 +93,12 @@
         #pragma GCC diagnostic ignored "-Wunused-function"
     #endif
 
+    // Glyphs rasterization temporary allocations are served from job workers scratch arenas [LoadFontData()]
+    static void *RLFontScratchAlloc(size_t size, void *userData);
+    static void RLFontScratchFree(void *ptr, void *userData);
+    #define STBTT_malloc(x,u)   RLFontScratchAlloc(x,u)
+    #define STBTT_free(x,u)     RLFontScratchFree(x,u)
+
     #define STBTT_STATIC
     #define STB_TRUETYPE_IMPLEMENTATION
     #include "external/stb_truetype.h"      // Required for: ttf font data reading
@@ -115,11 +121,132 @@
 #ifndef MAX_TEXTSPLIT_COUNT
     #define MAX_TEXTSPLIT_COUNT                  128        // Maximum number of substrings to split: TextSplit()
 #endif
+#ifndef FONT_RASTER_BATCH_GLYPHS
+    #define FONT_RASTER_BATCH_GLYPHS              16        // Glyphs rasterized per worker batch: LoadFontData()
+#endif
+#ifndef FONT_CACHE_DEFAULT_GLYPHS
+    #define FONT_CACHE_DEFAULT_GLYPHS           1024        // Dynamic font default glyphs cache capacity: LoadFontDynamic()
+#endif
+#ifndef FONT_CACHE_ATLAS_PAGES
+    #define FONT_CACHE_ATLAS_PAGES                 4        // Dynamic font atlas pages, least recently used page is evicted when full
+#endif
+#ifndef TEXT_RUN_CACHE_SIZE
+    #define TEXT_RUN_CACHE_SIZE                   64        // Text runs kept by DrawTextEx() cache (power of two)
+#endif
+
+// NOTE: Using some SDF generation default values,
+// trades off precision with ability to handle *smaller* sizes
+#ifndef FONT_SDF_CHAR_PADDING
+    #define FONT_SDF_CHAR_PADDING                  4        // SDF font generation char padding
+#endif
+#ifndef FONT_SDF_ON_EDGE_VALUE
+    #define FONT_SDF_ON_EDGE_VALUE               128        // SDF font generation on edge value
+#endif
+#ifndef FONT_SDF_PIXEL_DIST_SCALE
+    #define FONT_SDF_PIXEL_DIST_SCALE           64.0f       // SDF font generation pixel distance scale
+#endif
+#ifndef FONT_BITMAP_ALPHA_THRESHOLD
+    #define FONT_BITMAP_ALPHA_THRESHOLD           80        // Bitmap (B&W) font generation alpha threshold
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Font glyphs lookup table, codepoint to glyph index
+// NOTE: Codepoints below directCount (BMP range used by the font) are indexed directly,
+// other codepoints are found on an open addressing hash table
+struct rGlyphLookup {
+    const GlyphInfo *glyphs;        // Glyphs array the table was built from (used to detect stale tables)
+    int glyphCount;                 // Glyphs count the table was built from
+    int directCount;                // Number of directly indexed codepoints [0..directCount)
+    int *direct;                    // Directly indexed glyph indices (-1 if codepoint not available)
+    int hashCapacity;               // Hash table capacity (power of two, 0 if not required)
+    int *hashCodepoints;            // Hash table codepoints (-1 for empty slots)
+    int *hashIndices;               // Hash table glyph indices
+    struct FontGlyphCache *cache;   // Dynamic font glyphs cache (NULL for fonts with all glyphs loaded)
+};
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Font rasterization scratch memory, one per job worker
+// NOTE: stb_truetype temporary allocations are bump allocated and released at once after every glyph,
+// allocations not fitting are served by RL_MALLOC() and arena grows to fit them on next glyphs
+typedef struct FontScratchArena {
+    unsigned char *data;            // Arena memory
+    size_t size;                    // Arena size in bytes
+    size_t used;                    // Arena used size in bytes
+    size_t required;                // Size required by current glyph allocations, including the ones not fitting
+} FontScratchArena;
+
+// Font glyphs rasterization job data, shared by all workers
+// NOTE: Used on LoadFontData(), every glyph is rasterized independently into its own image
+typedef struct FontRasterJob {
+    const stbtt_fontinfo *fontInfo; // Font info, copied by every worker to use its scratch arena
+    const int *codepoints;          // Codepoints to rasterize
+    GlyphInfo *glyphs;              // Glyphs output
+    int fontSize;                   // Font size in pixels
+    int type;                       // Font type (FontType)
+    float scaleFactor;              // Font scale factor for requested size
+    int ascent;                     // Font ascent (unscaled), equivalent to font baseline
+    FontScratchArena *arenas;       // Scratch arenas, one per worker
+} FontRasterJob;
+
+// Font atlas page skyline node, horizontal segment of the packed area top
+typedef struct FontSkylineNode {
+    int x;                          // Segment start position X
+    int y;                          // Segment height (packed area bottom for next rectangles)
+    int width;                      // Segment width
+} FontSkylineNode;
+
+// Font atlas page, horizontal band of the atlas packed with skyline algorithm
+typedef struct FontAtlasPage {
+    FontSkylineNode *nodes;         // Skyline nodes, sorted by position X (up to atlas width + 1)
+    int nodeCount;                  // Skyline nodes count
+    int glyphCount;                 // Glyphs packed on page
+    unsigned int lastUse;           // Last glyph use on page (cache tick), for LRU eviction
+} FontAtlasPage;
+
+// Dynamic font glyphs cache, glyphs are rasterized on first use into atlas pages
+// NOTE: Font glyphs/recs are fixed size arrays of glyph slots, so Font copies remain valid
+typedef struct FontGlyphCache {
+    unsigned char *fileData;        // Font file data, required by fontInfo
+    stbtt_fontinfo fontInfo;        // Font info, kept for rasterization
+    FontScratchArena arena;         // Rasterization scratch memory
+    float scaleFactor;              // Font scale factor for font size
+    int ascent;                     // Font ascent (unscaled)
+    int fontSize;                   // Font size in pixels
+    int padding;                    // Glyphs padding in atlas
+
+    int capacity;                   // Glyph slots, plus reserved empty glyph slot at the end (Font glyphCount)
+    GlyphInfo *glyphs;              // Glyph slots info (Font glyphs)
+    Rectangle *recs;                // Glyph slots atlas rectangles (Font recs)
+    int *slotPages;                 // Glyph slots atlas page (-1 for free slots)
+    int *freeSlots;                 // Free glyph slots stack
+    int freeCount;                  // Free glyph slots count
+
+    int hashCapacity;               // Codepoints hash table capacity (power of two)
+    int *hashCodepoints;            // Hash table codepoints (-1 for empty entries)
+    int *hashSlots;                 // Hash table glyph slots
+
+    Texture2D texture;              // Atlas texture (Font texture)
+    int atlasSize;                  // Atlas width and height
+    int pageHeight;                 // Atlas page height
+    int pageCount;                  // Atlas pages count
+    FontAtlasPage *pages;           // Atlas pages
+    unsigned int tick;              // Glyph lookups counter, used as LRU clock
+} FontGlyphCache;
+#endif
+
+#if defined(SUPPORT_TEXT_RUN_CACHE)
+// Text run cache entry, text laid out by DrawTextEx()
+// NOTE: Entries are direct mapped by text hash, a colliding text replaces the entry reusing its memory
+typedef struct TextRunCacheEntry {
+    unsigned int hash;              // Text and layout parameters hash
+    char *text;                     // Text copy, compared on lookup
+    int textCapacity;               // Text copy buffer size
+    int capacity;                   // Run glyphs buffers capacity
+    TextRun run;                    // Text run laid out
+} TextRunCacheEntry;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global variables
@@ -130,6 +257,9 @@ extern bool isGpuReady;
 // NOTE: Default font is loaded on InitWindow() and disposed on CloseWindow() [module: core]
 static Font defaultFont = { 0 };
 #endif
+#if defined(SUPPORT_TEXT_RUN_CACHE)
+static TextRunCacheEntry textRunCache[TEXT_RUN_CACHE_SIZE] = { 0 };   // Text runs recently drawn
+#endif
 
 //----------------------------------------------------------------------------------
 // Other Modules Functions Declaration (required by text)
@@ -145,6 +275,22 @@ static Font RLLoadBMFont(const char *fileName);   // Load a BMFont file (AngelCo
 #if defined(SUPPORT_FILEFORMAT_BDF)
 static GlyphInfo *LoadFontDataBDF(const unsigned char *fileData, int dataSize, int *codepoints, int codepointCount, int *outFontSize);
 #endif
+static rGlyphLookup *RLLoadGlyphLookup(const GlyphInfo *glyphs, int glyphCount);  // Load glyphs lookup table, codepoint to glyph index
+#if defined(SUPPORT_FILEFORMAT_TTF)
+static void RLLoadGlyphsRange(void *userData, int start, int end, int worker);  // Rasterize glyphs range [LoadFontData()]
+static void RLResetFontScratchArena(FontScratchArena *arena);                   // Release scratch arena memory used by last glyph
+static void RLLoadGlyph(const stbtt_fontinfo *fontInfo, int codepoint, int fontSize, int type, float scaleFactor, int ascent, GlyphInfo *glyph); // Rasterize glyph for codepoint
+static FontGlyphCache *RLLoadFontGlyphCache(const unsigned char *fileData, int dataSize, int fontSize, int capacity); // Load dynamic font glyphs cache
+static void RLUnloadFontGlyphCache(FontGlyphCache *cache);                      // Unload dynamic font glyphs cache
+static int RLGetCachedGlyphIndex(FontGlyphCache *cache, int codepoint);         // Get glyph slot for codepoint, rasterized on first use
+static bool RLPackSkylinePage(FontAtlasPage *page, int width, int height, int pageWidth, int pageHeight, int *x, int *y); // Pack rectangle on atlas page
+static void RLEvictFontCachePage(FontGlyphCache *cache);                        // Evict least recently used atlas page glyphs
+#endif
+static void RLLayoutTextRun(TextRun *run, int *capacity, Font font, const char *text, float fontSize, float spacing, float wrapWidth); // Layout text into run, buffers grown as required
+#if defined(SUPPORT_TEXT_RUN_CACHE)
+static TextRun *RLGetCachedTextRun(Font font, const char *text, float fontSize, float spacing); // Get text run from cache, laid out on miss
+static void RLUnloadTextRunCache(Font font, bool all);                          // Unload cached text runs using font (or all of them)
+#endif
 static int textLineSpacing = 2;                 // Text vertical line spacing in pixels (between lines)
 
 #if defined(SUPPORT_DEFAULT_FONT)
@@ -301,6 +447,7 @@ extern void RLLoadFontDefault(void)
     RLUnloadImage(imFont);
 
     defaultFont.baseSize = (int)defaultFont.recs[0].height;
+    defaultFont.lookup = RLLoadGlyphLookup(defaultFont.glyphs, defaultFont.glyphCount);
 
     TRACELOG(LOG_INFO, "FONT: Default font loaded successfully (%i glyphs)", defaultFont.glyphCount);
 }
@@ -308,10 +455,14 @@ extern void RLLoadFontDefault(void)
 // Unload raylib default font
 extern void RLUnloadFontDefault(void)
 {
+#if defined(SUPPORT_TEXT_RUN_CACHE)
+    RLUnloadTextRunCache(defaultFont, true);
+#endif
     for (int i = 0; i < defaultFont.glyphCount; i++) RLUnloadImage(defaultFont.glyphs[i].image);
     if (isGpuReady) RLUnloadTexture(defaultFont.texture);
     RL_FREE(defaultFont.glyphs);
     RL_FREE(defaultFont.recs);
+    RL_FREE(defaultFont.lookup);
 }
 #endif      // SUPPORT_DEFAULT_FONT
 
@@ -383,16 +534,16 @@ Font RLLoadFontEx(const char *fileName, int fontSize, int *codepoints, int codep
 {
     Font font = { 0 };
 
-    // Loading file to memory
-    int dataSize = 0;
-    unsigned char *fileData = RLLoadFileData(fileName, &dataSize);
+    // Mapping file in memory, glyphs rasterized directly from file data
+    MappedFile file = RLLoadMappedFile(fileName);
 
-    if (fileData != NULL)
+    if (RLIsMappedFileValid(file))
     {
         // Loading font from memory data
-        font = RLLoadFontFromMemory(RLGetFileExtension(fileName), fileData, dataSize, fontSize, codepoints, codepointCount);
+        if (file.size <= 2147483647) font = RLLoadFontFromMemory(RLGetFileExtension(fileName), file.data, (int)file.size, fontSize, codepoints, codepointCount);
+        else TRACELOG(LOG_WARNING, "FONT: [%s] File is bigger than 2147483647 bytes, not supported", fileName);
 
-        RLUnloadFileData(fileData);
+        RLUnloadMappedFile(file);
     }
 
     return font;
@@ -519,6 +670,7 @@ Font RLLoadFontFromImage(Image image, Color key, int firstChar)
     RLUnloadImage(fontClear);     // Unload processed image once converted to texture
 
     font.baseSize = (int)font.recs[0].height;
+    font.lookup = RLLoadGlyphLookup(font.glyphs, font.glyphCount);
 
     return font;
 }
@@ -571,6 +723,8 @@ Font RLLoadFontFromMemory(const char *fileType, const unsigned char *fileData, i
 
         RLUnloadImage(atlas);
 
+        font.lookup = RLLoadGlyphLookup(font.glyphs, font.glyphCount);
+
         TRACELOG(LOG_INFO, "FONT: Data loaded successfully (%i pixel size | %i glyphs)", font.baseSize, font.glyphCount);
     }
     else font = RLGetFontDefault();
@@ -581,6 +735,88 @@ Font RLLoadFontFromMemory(const char *fileType, const unsigned char *fileData, i
     return font;
 }
 
+// Load font from file with glyphs rasterized on first use (dynamic font)
+// NOTE: Only TTF/OTF fonts supported, up to glyphCapacity glyphs are kept on atlas
+Font RLLoadFontDynamic(const char *fileName, int fontSize, int glyphCapacity)
+{
+    Font font = { 0 };
+
+    // Mapping file in memory
+    MappedFile file = RLLoadMappedFile(fileName);
+
+    if (RLIsMappedFileValid(file))
+    {
+        // Loading font from memory data, file data is copied by font glyphs cache
+        if (file.size <= 2147483647) font = RLLoadFontDynamicFromMemory(RLGetFileExtension(fileName), file.data, (int)file.size, fontSize, glyphCapacity);
+        else TRACELOG(LOG_WARNING, "FONT: [%s] File is bigger than 2147483647 bytes, not supported", fileName);
+
+        RLUnloadMappedFile(file);
+    }
+
+    return font;
+}
+
+// Load font from memory buffer with glyphs rasterized on first use (dynamic font), fileType refers to extension: i.e. ".ttf"
+// NOTE: Glyphs are rasterized when first found by GetGlyphIndex() (i.e. DrawTextEx(), MeasureTextEx()) and packed
+// on atlas pages, when glyphs slots or pages are full, least recently used page glyphs are evicted
+// WARNING: Evicted glyphs atlas area is reused, glyphs queued for deferred drawing (SpriteQueue) could become invalid
+Font RLLoadFontDynamicFromMemory(const char *fileType, const unsigned char *fileData, int dataSize, int fontSize, int glyphCapacity)
+{
+    Font font = { 0 };
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    char fileExtLower[16] = { 0 };
+    strncpy(fileExtLower, RLTextToLower(fileType), 16 - 1);
+
+    if ((fileData != NULL) && (fontSize > 0) && (RLTextIsEqual(fileExtLower, ".ttf") || RLTextIsEqual(fileExtLower, ".otf")))
+    {
+        FontGlyphCache *cache = RLLoadFontGlyphCache(fileData, dataSize, fontSize, (glyphCapacity > 0)? glyphCapacity : FONT_CACHE_DEFAULT_GLYPHS);
+        rGlyphLookup *lookup = (rGlyphLookup *)RL_CALLOC(1, sizeof(rGlyphLookup));
+
+        if ((cache != NULL) && (lookup != NULL))
+        {
+            lookup->cache = cache;
+
+            font.baseSize = fontSize;
+            font.glyphCount = cache->capacity + 1;
+            font.glyphPadding = cache->padding;
+            font.texture = cache->texture;
+            font.recs = cache->recs;
+            font.glyphs = cache->glyphs;
+            font.lookup = lookup;
+
+            TRACELOG(LOG_INFO, "FONT: Dynamic font loaded successfully (%i pixel size | %i glyphs cache | %ix%i atlas)", fontSize, cache->capacity, cache->atlasSize, cache->atlasSize);
+        }
+        else
+        {
+            if (cache != NULL)
+            {
+                RLUnloadTexture(cache->texture);
+                RL_FREE(cache->glyphs);
+                RL_FREE(cache->recs);
+                RLUnloadFontGlyphCache(cache);
+            }
+
+            RL_FREE(lookup);
+        }
+    }
+#endif
+
+    if (font.glyphs == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FONT: Failed to load dynamic font");
+        font = RLGetFontDefault();
+    }
+
+    return font;
+}
+
+// Check if font glyphs are rasterized on first use (dynamic font)
+bool RLIsFontDynamic(Font font)
+{
+    return ((font.lookup != NULL) && (font.lookup->cache != NULL));
+}
+
 // Check if a font is valid (font data loaded)
 // WARNING: GPU texture not checked
 bool RLIsFontValid(Font font)
@@ -594,24 +830,9 @@ bool RLIsFontValid(Font font)
 }
 
 // Load font data for further use
-// NOTE: Requires TTF font memory data and can generate SDF data
+// NOTE: Requires TTF font memory data and can generate SDF data, glyphs are rasterized by job workers
 GlyphInfo * RLLoadFontData(const unsigned char *fileData, int dataSize, int fontSize, int *codepoints, int codepointCount, int type)
 {
-    // NOTE: Using some SDF generation default values,
-    // trades off precision with ability to handle *smaller* sizes
-#ifndef FONT_SDF_CHAR_PADDING
-    #define FONT_SDF_CHAR_PADDING            4      // SDF font generation char padding
-#endif
-#ifndef FONT_SDF_ON_EDGE_VALUE
-    #define FONT_SDF_ON_EDGE_VALUE         128      // SDF font generation on edge value
-#endif
-#ifndef FONT_SDF_PIXEL_DIST_SCALE
-    #define FONT_SDF_PIXEL_DIST_SCALE     64.0f     // SDF font generation pixel distance scale
-#endif
-#ifndef FONT_BITMAP_ALPHA_THRESHOLD
-    #define FONT_BITMAP_ALPHA_THRESHOLD     80      // Bitmap (B&W) font generation alpha threshold
-#endif
-
     GlyphInfo *chars = NULL;
 
 #if defined(SUPPORT_FILEFORMAT_TTF)
@@ -624,9 +845,6 @@ GlyphInfo * RLLoadFontData(const unsigned char *fileData, int dataSize, int font
 
         if (stbtt_InitFont(&fontInfo, (unsigned char *)fileData, 0))     // Initialize font for data reading
         {
-            // Calculate font scale factor
-            float scaleFactor = stbtt_ScaleForPixelHeight(&fontInfo, (float)fontSize);
-
             // Calculate font basic metrics
             // NOTE: ascent is equivalent to font baseline
             int ascent, descent, lineGap;
@@ -646,81 +864,28 @@ GlyphInfo * RLLoadFontData(const unsigned char *fileData, int dataSize, int font
 
             chars = (GlyphInfo *)RL_CALLOC(codepointCount, sizeof(GlyphInfo));
 
-            // NOTE: Using simple packaging, one char after another
-            for (int i = 0; i < codepointCount; i++)
-            {
-                int chw = 0, chh = 0;   // Character width and height (on generation)
-                int ch = codepoints[i];  // Character value to get info for
-                chars[i].value = ch;
-
-                //  Render a unicode codepoint to a bitmap
-                //      stbtt_GetCodepointBitmap()           -- allocates and returns a bitmap
-                //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
-                //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
-
-                // Check if a glyph is available in the font
-                // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
-                int index = stbtt_FindGlyphIndex(&fontInfo, ch);
-
-                if (index > 0)
-                {
-                    switch (type)
-                    {
-                        case FONT_DEFAULT:
-                        case FONT_BITMAP: chars[i].image.data = stbtt_GetCodepointBitmap(&fontInfo, scaleFactor, scaleFactor, ch, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
-                        case FONT_SDF: if (ch != 32) chars[i].image.data = stbtt_GetCodepointSDF(&fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &chars[i].offsetX, &chars[i].offsetY); break;
-                        default: break;
-                    }
-
-                    if (chars[i].image.data != NULL)    // Glyph data has been found in the font
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                        if (chh > fontSize) TRACELOG(LOG_WARNING, "FONT: Character [0x%08x] size is bigger than expected font size", ch);
-
-                        // Load characters images
-                        chars[i].image.width = chw;
-                        chars[i].image.height = chh;
-                        chars[i].image.mipmaps = 1;
-                        chars[i].image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-
-                        chars[i].offsetY += (int)((float)ascent*scaleFactor);
-                    }
+            int workerCount = RLGetJobWorkerCount();
+            FontRasterJob job = {
+                .fontInfo = &fontInfo,
+                .codepoints = codepoints,
+                .glyphs = chars,
+                .fontSize = fontSize,
+                .type = type,
+                .scaleFactor = stbtt_ScaleForPixelHeight(&fontInfo, (float)fontSize),
+                .ascent = ascent,
+                .arenas = (FontScratchArena *)RL_CALLOC(workerCount, sizeof(FontScratchArena))
+            };
 
-                    // NOTE: We create an empty image for space character,
-                    // it could be further required for atlas packing
-                    if (ch == 32)
-                    {
-                        stbtt_GetCodepointHMetrics(&fontInfo, ch, &chars[i].advanceX, NULL);
-                        chars[i].advanceX = (int)((float)chars[i].advanceX*scaleFactor);
-
-                        Image imSpace = {
-                            .data = RL_CALLOC(chars[i].advanceX*fontSize, 2),
-                            .width = chars[i].advanceX,
-                            .height = fontSize,
-                            .mipmaps = 1,
-                            .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
-                        };
-
-                        chars[i].image = imSpace;
-                    }
+            // Glyphs are independent, rasterized by job workers into their own images
+            // NOTE: Every glyph is processed the same way on any worker, so result does not depend on workers count,
+            // if scratch arenas could not be allocated, temporary memory is allocated with RL_MALLOC()
+            if (chars != NULL) RLParallelFor(codepointCount, FONT_RASTER_BATCH_GLYPHS, RLLoadGlyphsRange, &job);
+            else TRACELOG(LOG_WARNING, "FONT: Failed to allocate glyphs data");
 
-                    if (type == FONT_BITMAP)
-                    {
-                        // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
-                        // NOTE: For optimum results, bitmap font should be generated at base pixel size
-                        for (int p = 0; p < chw*chh; p++)
-                        {
-                            if (((unsigned char *)chars[i].image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)chars[i].image.data)[p] = 0;
-                            else ((unsigned char *)chars[i].image.data)[p] = 255;
-                        }
-                    }
-                }
-                else
-                {
-                    // TODO: Use some fallback glyph for codepoints not found in the font
-                }
+            if (job.arenas != NULL)
+            {
+                for (int i = 0; i < workerCount; i++) RL_FREE(job.arenas[i].data);
+                RL_FREE(job.arenas);
             }
         }
         else TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
@@ -953,6 +1118,13 @@ void RLUnloadFont(Font font)
         RLUnloadFontData(font.glyphs, font.glyphCount);
         if (isGpuReady) RLUnloadTexture(font.texture);
         RL_FREE(font.recs);
+#if defined(SUPPORT_FILEFORMAT_TTF)
+        if ((font.lookup != NULL) && (font.lookup->cache != NULL)) RLUnloadFontGlyphCache(font.lookup->cache);
+#endif
+#if defined(SUPPORT_TEXT_RUN_CACHE)
+        RLUnloadTextRunCache(font, false);
+#endif
+        RL_FREE(font.lookup);
 
         TRACELOGD("FONT: Unloaded font data from RAM and VRAM");
     }
@@ -1149,6 +1321,16 @@ void RLDrawTextEx(Font font, const char *text, Vector2 position, float fontSize,
 {
     if (font.texture.id == 0) font = RLGetFontDefault();  // Security check in case of not valid font
 
+#if defined(SUPPORT_TEXT_RUN_CACHE)
+    // Text already laid out recently, draw cached text run
+    TextRun *run = RLGetCachedTextRun(font, text, fontSize, spacing);
+    if (run != NULL)
+    {
+        RLDrawTextRun(*run, position, tint);
+        return;
+    }
+#endif
+
     int size = RLTextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
 
     float textOffsetY = 0;          // Offset between lines (on linebreak '\n')
@@ -1184,6 +1366,56 @@ void RLDrawTextEx(Font font, const char *text, Vector2 position, float fontSize,
     }
 }
 
+// Queue text using Font on sprite queue
+// NOTE: Same layout as DrawTextEx(), glyphs are queued as sprites using font texture
+void RLQueueTextEx(SpriteQueue queue, Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    if (font.texture.id == 0) font = RLGetFontDefault();  // Security check in case of not valid font
+
+    int size = RLTextLength(text);    // Total size in bytes of the text, scanned by codepoints in loop
+
+    float textOffsetY = 0;          // Offset between lines (on linebreak '\n')
+    float textOffsetX = 0.0f;       // Offset X to next character to draw
+
+    float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+
+    for (int i = 0; i < size;)
+    {
+        // Get next codepoint from byte string and glyph index in font
+        int codepointByteCount = 0;
+        int codepoint = RLGetCodepointNext(&text[i], &codepointByteCount);
+        int index = RLGetGlyphIndex(font, codepoint);
+
+        if (codepoint == '\n')
+        {
+            // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+            textOffsetY += (fontSize + textLineSpacing);
+            textOffsetX = 0.0f;
+        }
+        else
+        {
+            if ((codepoint != ' ') && (codepoint != '\t'))
+            {
+                // Same glyph rectangles as DrawTextCodepoint(), considering glyphPadding
+                Rectangle dstRec = { position.x + textOffsetX + font.glyphs[index].offsetX*scaleFactor - (float)font.glyphPadding*scaleFactor,
+                                     position.y + textOffsetY + font.glyphs[index].offsetY*scaleFactor - (float)font.glyphPadding*scaleFactor,
+                                     (font.recs[index].width + 2.0f*font.glyphPadding)*scaleFactor,
+                                     (font.recs[index].height + 2.0f*font.glyphPadding)*scaleFactor };
+
+                Rectangle srcRec = { font.recs[index].x - (float)font.glyphPadding, font.recs[index].y - (float)font.glyphPadding,
+                                     font.recs[index].width + 2.0f*font.glyphPadding, font.recs[index].height + 2.0f*font.glyphPadding };
+
+                RLQueueTexturePro(queue, font.texture, srcRec, dstRec, (Vector2){ 0, 0 }, 0.0f, tint);
+            }
+
+            if (font.glyphs[index].advanceX == 0) textOffsetX += ((float)font.recs[index].width*scaleFactor + spacing);
+            else textOffsetX += ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+        }
+
+        i += codepointByteCount;   // Move text bytes counter to next codepoint
+    }
+}
+
 // Draw text using Font and pro parameters (rotation)
 void RLDrawTextPro(Font font, const char *text, Vector2 position, Vector2 origin, float rotation, float fontSize, float spacing, Color tint)
 {
@@ -1253,12 +1485,111 @@ void RLDrawTextCodepoints(Font font, const int *codepoints, int codepointCount,
     }
 }
 
+// Load text run, text laid out once to be drawn repeatedly
+// NOTE: Same layout as DrawTextEx(), words are wrapped at spaces to fit wrapWidth (0 for no wrapping),
+// words longer than wrapWidth are broken at the glyph not fitting
+TextRun RLLoadTextRun(Font font, const char *text, float fontSize, float spacing, float wrapWidth)
+{
+    TextRun run = { 0 };
+
+    if (font.texture.id == 0) font = RLGetFontDefault();  // Security check in case of not valid font
+
+    if (font.glyphs == NULL) TRACELOG(LOG_WARNING, "TEXT: Failed to load text run, font not available");
+    else
+    {
+        int capacity = 0;
+        RLLayoutTextRun(&run, &capacity, font, text, fontSize, spacing, wrapWidth);
+    }
+
+    return run;
+}
+
+// Check if a text run is valid (laid out with a font)
+bool RLIsTextRunValid(TextRun run)
+{
+    return ((run.font.glyphs != NULL) &&                        // Validate run font
+            ((run.glyphCount == 0) || (run.positions != NULL))); // Validate run glyphs data
+}
+
+// Unload text run
+void RLUnloadTextRun(TextRun run)
+{
+    // NOTE: Codepoints and glyph indices share positions allocation
+    RL_FREE(run.positions);
+}
+
+// Draw text run
+// NOTE: All glyphs are drawn with a single texture change, quads equivalent to DrawTextCodepoint()
+void RLDrawTextRun(TextRun run, Vector2 position, Color tint)
+{
+    Font font = run.font;
+
+    if ((run.glyphCount <= 0) || (font.texture.id == 0)) return;
+
+    float scaleFactor = run.fontSize/font.baseSize;     // Character quad scaling factor
+
+    if (RLIsFontDynamic(font))
+    {
+        // NOTE: Dynamic font glyphs could be evicted while resolving them (flushing the batch),
+        // glyph indices are resolved again and glyphs drawn one by one
+        for (int i = 0; i < run.glyphCount; i++)
+        {
+            RLDrawTextCodepoint(font, run.codepoints[i], (Vector2){ position.x + run.positions[i].x, position.y + run.positions[i].y }, run.fontSize, tint);
+        }
+
+        return;
+    }
+
+    float width = (float)font.texture.width;
+    float height = (float)font.texture.height;
+    float padding = (float)font.glyphPadding;
+
+    rlSetTexture(font.texture.id);
+    rlBegin(RL_QUADS);
+
+        rlColor4ub(tint.r, tint.g, tint.b, tint.a);
+        rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+        for (int i = 0; i < run.glyphCount; i++)
+        {
+            int index = run.glyphIndices[i];
+            Rectangle rec = font.recs[index];
+
+            // Character destination rectangle on screen, considering glyphPadding
+            float x = position.x + run.positions[i].x + font.glyphs[index].offsetX*scaleFactor - padding*scaleFactor;
+            float y = position.y + run.positions[i].y + font.glyphs[index].offsetY*scaleFactor - padding*scaleFactor;
+            float w = (rec.width + 2.0f*padding)*scaleFactor;
+            float h = (rec.height + 2.0f*padding)*scaleFactor;
+
+            // Character source rectangle from font texture atlas, considering glyphPadding
+            float u0 = (rec.x - padding)/width;
+            float v0 = (rec.y - padding)/height;
+            float u1 = ((rec.x - padding) + (rec.width + 2.0f*padding))/width;
+            float v1 = ((rec.y - padding) + (rec.height + 2.0f*padding))/height;
+
+            // Top-left, bottom-left, bottom-right and top-right corners for texture and quad
+            rlTexCoord2f(u0, v0); rlVertex2f(x, y);
+            rlTexCoord2f(u0, v1); rlVertex2f(x, y + h);
+            rlTexCoord2f(u1, v1); rlVertex2f(x + w, y + h);
+            rlTexCoord2f(u1, v0); rlVertex2f(x + w, y);
+        }
+
+    rlEnd();
+    rlSetTexture(0);
+}
+
 // Set vertical line spacing when drawing with line-breaks
 void RLSetTextLineSpacing(int spacing)
 {
     textLineSpacing = spacing;
 }
 
+// Get vertical line spacing when drawing with line-breaks
+int RLGetTextLineSpacing(void)
+{
+    return textLineSpacing;
+}
+
 // Measure string width for default font
 int RLMeasureText(const char *text, int fontSize)
 {
@@ -1340,6 +1671,41 @@ int RLGetGlyphIndex(Font font, int codepoint)
 {
     int index = 0;
 
+#if defined(SUPPORT_FILEFORMAT_TTF)
+    // Dynamic font, glyph rasterized on first use
+    if ((font.lookup != NULL) && (font.lookup->cache != NULL)) return RLGetCachedGlyphIndex(font.lookup->cache, codepoint);
+#endif
+
+    // Use font lookup table if available, constant time
+    // NOTE: Table could be stale if font.glyphs/font.glyphCount were edited by user after loading,
+    // found entry is validated against glyph codepoint, linear search is used on mismatch and to confirm
+    // codepoints not available (only unavailable codepoints pay the linear search cost)
+    if ((font.lookup != NULL) && (font.lookup->glyphs == font.glyphs) && (font.lookup->glyphCount == font.glyphCount))
+    {
+        const rGlyphLookup *lookup = font.lookup;
+        int found = -1;
+
+        if ((codepoint >= 0) && (codepoint < lookup->directCount)) found = lookup->direct[codepoint];
+        else if (lookup->hashCapacity > 0)
+        {
+            unsigned int mask = (unsigned int)lookup->hashCapacity - 1;
+            unsigned int slot = ((unsigned int)codepoint*2654435761u >> 8) & mask;
+
+            while (lookup->hashCodepoints[slot] != -1)
+            {
+                if (lookup->hashCodepoints[slot] == codepoint)
+                {
+                    found = lookup->hashIndices[slot];
+                    break;
+                }
+
+                slot = (slot + 1) & mask;
+            }
+        }
+
+        if ((found >= 0) && (font.glyphs[found].value == codepoint)) return found;
+    }
+
 #define SUPPORT_UNORDERED_CHARSET
 #if defined(SUPPORT_UNORDERED_CHARSET)
     int fallbackIndex = 0;      // Get index of fallback glyph '?'
@@ -2135,62 +2501,885 @@ int RLGetCodepointPrevious(const char *text, int *codepointSize)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
-#if defined(SUPPORT_FILEFORMAT_FNT) || defined(SUPPORT_FILEFORMAT_BDF)
-// Read a line from memory
-// REQUIRES: memcpy()
-// NOTE: Returns the number of bytes read
-static int RLGetLine(const char *origin, char *buffer, int maxLength)
-{
-    int count = 0;
-    for (; count < maxLength - 1; count++) if (origin[count] == '\n') break;
-    memcpy(buffer, origin, count);
-    buffer[count] = '\0';
-    return count;
-}
-#endif
 
-#if defined(SUPPORT_FILEFORMAT_FNT)
-// Load a BMFont file (AngelCode font file)
-// REQUIRES: strstr(), sscanf(), strrchr(), memcpy()
-static Font RLLoadBMFont(const char *fileName)
+// Load glyphs lookup table, codepoint to glyph index
+// NOTE: Lookup results match linear search (first glyph with the codepoint), codepoints not available
+// are resolved by GetGlyphIndex() linear search, all data is allocated in a single block, freed with RL_FREE()
+static rGlyphLookup *RLLoadGlyphLookup(const GlyphInfo *glyphs, int glyphCount)
 {
-    #define MAX_BUFFER_SIZE       256
-    #define MAX_FONT_IMAGE_PAGES    8
+    if ((glyphs == NULL) || (glyphCount <= 0)) return NULL;
 
-    Font font = { 0 };
+    int directCount = 0;
+    int hashCount = 0;
 
-    char buffer[MAX_BUFFER_SIZE] = { 0 };
-    char *searchPoint = NULL;
+    for (int i = 0; i < glyphCount; i++)
+    {
+        int codepoint = glyphs[i].value;
 
-    int fontSize = 0;
-    int glyphCount = 0;
+        if ((codepoint >= 0) && (codepoint < 0x10000)) { if (codepoint >= directCount) directCount = codepoint + 1; }
+        else hashCount++;
+    }
 
-    int imWidth = 0;
-    int imHeight = 0;
-    int pageCount = 1;
-    char imFileName[MAX_FONT_IMAGE_PAGES][129] = { 0 };
+    // Hash table load factor kept below 0.5
+    int hashCapacity = 0;
+    if (hashCount > 0) for (hashCapacity = 16; hashCapacity < 2*hashCount; hashCapacity *= 2) { }
 
-    int base = 0;       // Useless data
-    int readBytes = 0;  // Data bytes read
-    int readVars = 0;   // Variables filled by sscanf()
+    rGlyphLookup *lookup = (rGlyphLookup *)RL_MALLOC(sizeof(rGlyphLookup) + (directCount + 2*hashCapacity)*sizeof(int));
+    if (lookup == NULL) return NULL;
 
-    char *fileText = RLLoadFileText(fileName);
+    lookup->glyphs = glyphs;
+    lookup->glyphCount = glyphCount;
+    lookup->cache = NULL;
+    lookup->directCount = directCount;
+    lookup->direct = (int *)(lookup + 1);
+    lookup->hashCapacity = hashCapacity;
+    lookup->hashCodepoints = lookup->direct + directCount;
+    lookup->hashIndices = lookup->hashCodepoints + hashCapacity;
 
-    if (fileText == NULL) return font;
+    for (int i = 0; i < directCount; i++) lookup->direct[i] = -1;
+    for (int i = 0; i < hashCapacity; i++) lookup->hashCodepoints[i] = -1;
 
-    char *fileTextPtr = fileText;
+    for (int i = 0; i < glyphCount; i++)
+    {
+        int codepoint = glyphs[i].value;
 
-    // NOTE: We skip first line, it contains no useful information
-    readBytes = RLGetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-    fileTextPtr += (readBytes + 1);
+        if ((codepoint >= 0) && (codepoint < directCount))
+        {
+            if (lookup->direct[codepoint] == -1) lookup->direct[codepoint] = i;
+        }
+        else if (codepoint != -1)
+        {
+            unsigned int mask = (unsigned int)hashCapacity - 1;
+            unsigned int slot = ((unsigned int)codepoint*2654435761u >> 8) & mask;
 
-    // Read line data
-    readBytes = RLGetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
-    searchPoint = strstr(buffer, "lineHeight");
-    readVars = sscanf(searchPoint, "lineHeight=%i base=%i scaleW=%i scaleH=%i pages=%i", &fontSize, &base, &imWidth, &imHeight, &pageCount);
-    fileTextPtr += (readBytes + 1);
+            while ((lookup->hashCodepoints[slot] != -1) && (lookup->hashCodepoints[slot] != codepoint)) slot = (slot + 1) & mask;
 
-    if (readVars < 4) { RLUnloadFileText(fileText); return font; } // Some data not available, file malformed
+            if (lookup->hashCodepoints[slot] == -1)
+            {
+                lookup->hashCodepoints[slot] = codepoint;
+                lookup->hashIndices[slot] = i;
+            }
+        }
+    }
+
+    return lookup;
+}
+
+#if defined(SUPPORT_FILEFORMAT_TTF)
+// Allocate stb_truetype temporary memory from scratch arena (if provided)
+static void *RLFontScratchAlloc(size_t size, void *userData)
+{
+    FontScratchArena *arena = (FontScratchArena *)userData;
+
+    if (arena == NULL) return RL_MALLOC(size);
+
+    size_t alignedSize = (size + 15) & ~(size_t)15;
+    arena->required += alignedSize;
+
+    if ((arena->used + alignedSize) <= arena->size)
+    {
+        void *ptr = arena->data + arena->used;
+        arena->used += alignedSize;
+
+        return ptr;
+    }
+
+    return RL_MALLOC(size);
+}
+
+// Free stb_truetype temporary memory, arena memory is released at once after every glyph
+static void RLFontScratchFree(void *ptr, void *userData)
+{
+    FontScratchArena *arena = (FontScratchArena *)userData;
+
+    if ((arena != NULL) && (arena->data != NULL) &&
+        ((unsigned char *)ptr >= arena->data) && ((unsigned char *)ptr < (arena->data + arena->size))) return;
+
+    RL_FREE(ptr);
+}
+
+// Rasterize glyphs range, using worker font info copy and scratch arena
+static void RLLoadGlyphsRange(void *userData, int start, int end, int worker)
+{
+    FontRasterJob *job = (FontRasterJob *)userData;
+    FontScratchArena *arena = (job->arenas != NULL)? &job->arenas[worker] : NULL;
+
+    stbtt_fontinfo fontInfo = *job->fontInfo;
+    fontInfo.userdata = arena;
+
+    for (int i = start; i < end; i++)
+    {
+        RLLoadGlyph(&fontInfo, job->codepoints[i], job->fontSize, job->type, job->scaleFactor, job->ascent, &job->glyphs[i]);
+        if (arena != NULL) RLResetFontScratchArena(arena);
+    }
+}
+
+// Release scratch arena memory used by last glyph, growing arena if some allocations did not fit
+static void RLResetFontScratchArena(FontScratchArena *arena)
+{
+    if (arena->required > arena->size)
+    {
+        RL_FREE(arena->data);
+        arena->data = (unsigned char *)RL_MALLOC(arena->required);
+        arena->size = (arena->data != NULL)? arena->required : 0;
+    }
+
+    arena->used = 0;
+    arena->required = 0;
+}
+
+// Rasterize glyph for codepoint, temporary allocations use font info userdata scratch arena (if provided)
+// NOTE: Glyph image is GRAYSCALE, codepoints not available in the font only get the value filled
+static void RLLoadGlyph(const stbtt_fontinfo *fontInfo, int codepoint, int fontSize, int type, float scaleFactor, int ascent, GlyphInfo *glyph)
+{
+    int chw = 0, chh = 0;       // Character width and height (on generation)
+    int ch = codepoint;         // Character value to get info for
+    glyph->value = ch;
+
+    //  Render a unicode codepoint to a bitmap
+    //      stbtt_GetCodepointBitmapBox()        -- how big the bitmap must be
+    //      stbtt_MakeCodepointBitmap()          -- renders into bitmap you provide
+    //      stbtt_GetCodepointSDF()              -- allocates and returns a SDF bitmap (scratch arena)
+
+    // Check if a glyph is available in the font
+    // WARNING: if (index == 0), glyph not found, it could fallback to default .notdef glyph (if defined in font)
+    int index = stbtt_FindGlyphIndex(fontInfo, ch);
+
+    if (index > 0)
+    {
+        switch (type)
+        {
+            case FONT_DEFAULT:
+            case FONT_BITMAP:
+            {
+                // NOTE: Same result as stbtt_GetCodepointBitmap(), rendering into final glyph image
+                int x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+                stbtt_GetCodepointBitmapBox(fontInfo, ch, scaleFactor, scaleFactor, &x0, &y0, &x1, &y1);
+
+                chw = x1 - x0;
+                chh = y1 - y0;
+                glyph->offsetX = x0;
+                glyph->offsetY = y0;
+
+                if ((chw > 0) && (chh > 0))
+                {
+                    glyph->image.data = RL_MALLOC(chw*chh);
+                    if (glyph->image.data != NULL) stbtt_MakeCodepointBitmap(fontInfo, (unsigned char *)glyph->image.data, chw, chh, chw, scaleFactor, scaleFactor, ch);
+                }
+            } break;
+            case FONT_SDF:
+            {
+                if (ch != 32)
+                {
+                    unsigned char *sdf = stbtt_GetCodepointSDF(fontInfo, scaleFactor, ch, FONT_SDF_CHAR_PADDING, FONT_SDF_ON_EDGE_VALUE, FONT_SDF_PIXEL_DIST_SCALE, &chw, &chh, &glyph->offsetX, &glyph->offsetY);
+
+                    if (sdf != NULL)
+                    {
+                        glyph->image.data = RL_MALLOC(chw*chh);
+                        if (glyph->image.data != NULL) memcpy(glyph->image.data, sdf, chw*chh);
+                        STBTT_free(sdf, fontInfo->userdata);
+                    }
+                }
+            } break;
+            default: break;
+        }
+
+        if (glyph->image.data != NULL)    // Glyph data has been found in the font
+        {
+            stbtt_GetCodepointHMetrics(fontInfo, ch, &glyph->advanceX, NULL);
+            glyph->advanceX = (int)((float)glyph->advanceX*scaleFactor);
+
+            if (chh > fontSize) TRACELOG(LOG_WARNING, "FONT: Character [0x%08x] size is bigger than expected font size", ch);
+
+            // Load characters images
+            glyph->image.width = chw;
+            glyph->image.height = chh;
+            glyph->image.mipmaps = 1;
+            glyph->image.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+
+            glyph->offsetY += (int)((float)ascent*scaleFactor);
+        }
+
+        // NOTE: We create an empty image for space character,
+        // it could be further required for atlas packing
+        if (ch == 32)
+        {
+            stbtt_GetCodepointHMetrics(fontInfo, ch, &glyph->advanceX, NULL);
+            glyph->advanceX = (int)((float)glyph->advanceX*scaleFactor);
+
+            RL_FREE(glyph->image.data);
+
+            Image imSpace = {
+                .data = RL_CALLOC(glyph->advanceX*fontSize, 2),
+                .width = glyph->advanceX,
+                .height = fontSize,
+                .mipmaps = 1,
+                .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+            };
+
+            glyph->image = imSpace;
+        }
+
+        if (type == FONT_BITMAP)
+        {
+            // Aliased bitmap (black & white) font generation, avoiding anti-aliasing
+            // NOTE: For optimum results, bitmap font should be generated at base pixel size
+            for (int p = 0; p < chw*chh; p++)
+            {
+                if (((unsigned char *)glyph->image.data)[p] < FONT_BITMAP_ALPHA_THRESHOLD) ((unsigned char *)glyph->image.data)[p] = 0;
+                else ((unsigned char *)glyph->image.data)[p] = 255;
+            }
+        }
+    }
+    else
+    {
+        // TODO: Use some fallback glyph for codepoints not found in the font
+    }
+}
+
+// Load dynamic font glyphs cache, font file data is copied
+// NOTE: Atlas size fits glyphCapacity glyphs of fontSize, split in FONT_CACHE_ATLAS_PAGES horizontal pages
+static FontGlyphCache *RLLoadFontGlyphCache(const unsigned char *fileData, int dataSize, int fontSize, int capacity)
+{
+    FontGlyphCache *cache = (FontGlyphCache *)RL_CALLOC(1, sizeof(FontGlyphCache));
+    if (cache == NULL) return NULL;
+
+    cache->fileData = (unsigned char *)RL_MALLOC(dataSize);
+    if (cache->fileData != NULL) memcpy(cache->fileData, fileData, dataSize);
+
+    if ((cache->fileData == NULL) || !stbtt_InitFont(&cache->fontInfo, cache->fileData, 0))
+    {
+        TRACELOG(LOG_WARNING, "FONT: Failed to process TTF font data");
+        RL_FREE(cache->fileData);
+        RL_FREE(cache);
+        return NULL;
+    }
+
+    int descent, lineGap;
+    stbtt_GetFontVMetrics(&cache->fontInfo, &cache->ascent, &descent, &lineGap);
+    cache->fontInfo.userdata = &cache->arena;
+    cache->scaleFactor = stbtt_ScaleForPixelHeight(&cache->fontInfo, (float)fontSize);
+    cache->fontSize = fontSize;
+    cache->padding = FONT_TTF_DEFAULT_CHARS_PADDING;
+
+    // Atlas area estimated for glyphs cells of font size (plus padding), with some packing margin
+    int cellSize = fontSize + 2*cache->padding;
+    cache->pageCount = FONT_CACHE_ATLAS_PAGES;
+    for (cache->atlasSize = 64; (float)cache->atlasSize*cache->atlasSize < 1.25f*capacity*cellSize*cellSize; cache->atlasSize *= 2) { }
+    if (cache->atlasSize < 2*cellSize) cache->atlasSize *= 2;
+
+    // NOTE: Atlas smaller than estimated just evicts pages more often
+    int maxTextureSize = isGpuReady? rlGetTextureMaxSize() : 0;
+    if ((maxTextureSize > 0) && (cache->atlasSize > maxTextureSize))
+    {
+        TRACELOG(LOG_WARNING, "FONT: Dynamic font atlas size clamped to maximum texture size supported (%ix%i)", maxTextureSize, maxTextureSize);
+        cache->atlasSize = maxTextureSize;
+    }
+
+    while ((cache->atlasSize < 2*cellSize*cache->pageCount) && (cache->pageCount > 1)) cache->pageCount--;
+    cache->pageHeight = cache->atlasSize/cache->pageCount;
+
+    // NOTE: Last glyph slot is reserved empty glyph, used for glyphs that do not fit on atlas pages
+    cache->capacity = capacity;
+    cache->glyphs = (GlyphInfo *)RL_CALLOC(capacity + 1, sizeof(GlyphInfo));
+    cache->recs = (Rectangle *)RL_CALLOC(capacity + 1, sizeof(Rectangle));
+    cache->slotPages = (int *)RL_MALLOC(capacity*sizeof(int));
+    cache->freeSlots = (int *)RL_MALLOC(capacity*sizeof(int));
+
+    // Hash table load factor kept below 0.5
+    for (cache->hashCapacity = 16; cache->hashCapacity < 2*capacity; cache->hashCapacity *= 2) { }
+    cache->hashCodepoints = (int *)RL_MALLOC(cache->hashCapacity*sizeof(int));
+    cache->hashSlots = (int *)RL_MALLOC(cache->hashCapacity*sizeof(int));
+
+    cache->pages = (FontAtlasPage *)RL_CALLOC(cache->pageCount, sizeof(FontAtlasPage));
+
+    if ((cache->glyphs == NULL) || (cache->recs == NULL) || (cache->slotPages == NULL) || (cache->freeSlots == NULL) ||
+        (cache->hashCodepoints == NULL) || (cache->hashSlots == NULL) || (cache->pages == NULL))
+    {
+        RL_FREE(cache->glyphs);
+        RL_FREE(cache->recs);
+        RLUnloadFontGlyphCache(cache);
+        return NULL;
+    }
+
+    // Free slots stack, first slots used first
+    for (int i = 0; i < capacity; i++)
+    {
+        cache->slotPages[i] = -1;
+        cache->freeSlots[i] = capacity - 1 - i;
+    }
+
+    cache->freeCount = capacity;
+
+    for (int i = 0; i < cache->hashCapacity; i++) cache->hashCodepoints[i] = -1;
+
+    for (int i = 0; i < cache->pageCount; i++)
+    {
+        cache->pages[i].nodes = (FontSkylineNode *)RL_MALLOC((cache->atlasSize + 1)*sizeof(FontSkylineNode));
+
+        if (cache->pages[i].nodes == NULL)
+        {
+            RL_FREE(cache->glyphs);
+            RL_FREE(cache->recs);
+            RLUnloadFontGlyphCache(cache);
+            return NULL;
+        }
+
+        cache->pages[i].nodes[0] = (FontSkylineNode){ 0, 0, cache->atlasSize };
+        cache->pages[i].nodeCount = 1;
+    }
+
+    if (isGpuReady)
+    {
+        // Empty atlas, glyphs are uploaded to their rectangle when rasterized
+        Image atlas = {
+            .data = RL_CALLOC(cache->atlasSize*cache->atlasSize, 2),
+            .width = cache->atlasSize,
+            .height = cache->atlasSize,
+            .mipmaps = 1,
+            .format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
+        };
+
+        cache->texture = RLLoadTextureFromImage(atlas);
+        RLUnloadImage(atlas);
+    }
+
+    return cache;
+}
+
+// Unload dynamic font glyphs cache
+// NOTE: Glyphs, recs and texture are owned by Font, unloaded by UnloadFont()
+static void RLUnloadFontGlyphCache(FontGlyphCache *cache)
+{
+    if (cache->pages != NULL)
+    {
+        for (int i = 0; i < cache->pageCount; i++) RL_FREE(cache->pages[i].nodes);
+    }
+
+    RL_FREE(cache->pages);
+    RL_FREE(cache->hashCodepoints);
+    RL_FREE(cache->hashSlots);
+    RL_FREE(cache->slotPages);
+    RL_FREE(cache->freeSlots);
+    RL_FREE(cache->arena.data);
+    RL_FREE(cache->fileData);
+    RL_FREE(cache);
+}
+
+// Get glyph slot for codepoint, glyph is rasterized and packed on atlas on first use
+// NOTE: Codepoints not available in the font or not fitting on atlas use glyph '?',
+// reserved empty glyph slot is used if '?' is not available or does not fit either
+static int RLGetCachedGlyphIndex(FontGlyphCache *cache, int codepoint)
+{
+    if (codepoint < 0) codepoint = '?';
+
+    unsigned int mask = (unsigned int)cache->hashCapacity - 1;
+    unsigned int entry = ((unsigned int)codepoint*2654435761u >> 8) & mask;
+    int slot = -1;
+
+    cache->tick++;
+
+    while (cache->hashCodepoints[entry] != -1)
+    {
+        if (cache->hashCodepoints[entry] == codepoint)
+        {
+            slot = cache->hashSlots[entry];
+            break;
+        }
+
+        entry = (entry + 1) & mask;
+    }
+
+    if (slot == -1)
+    {
+        if ((codepoint != '?') && (stbtt_FindGlyphIndex(&cache->fontInfo, codepoint) == 0)) return RLGetCachedGlyphIndex(cache, '?');
+
+        GlyphInfo glyph = { 0 };
+        RLLoadGlyph(&cache->fontInfo, codepoint, cache->fontSize, FONT_DEFAULT, cache->scaleFactor, cache->ascent, &glyph);
+        RLResetFontScratchArena(&cache->arena);
+
+        int width = glyph.image.width + 2*cache->padding;
+        int height = glyph.image.height + 2*cache->padding;
+
+        if ((width > cache->atlasSize) || (height > cache->pageHeight))
+        {
+            TRACELOG(LOG_WARNING, "FONT: Character [0x%08x] does not fit on dynamic font atlas page", codepoint);
+            RLUnloadImage(glyph.image);
+            return (codepoint != '?')? RLGetCachedGlyphIndex(cache, '?') : cache->capacity;
+        }
+
+        // Find atlas space, evicting least recently used pages when required
+        // NOTE: Packing always succeeds once all pages have been evicted
+        if (cache->freeCount == 0) RLEvictFontCachePage(cache);
+
+        int page = -1;
+        int x = 0, y = 0;
+
+        while (page == -1)
+        {
+            for (int i = 0; i < cache->pageCount; i++)
+            {
+                if (RLPackSkylinePage(&cache->pages[i], width, height, cache->atlasSize, cache->pageHeight, &x, &y)) { page = i; break; }
+            }
+
+            if (page == -1) RLEvictFontCachePage(cache);
+        }
+
+        y += page*cache->pageHeight;
+
+        // Glyph rectangle, including padding, converted from GRAYSCALE to GRAY_ALPHA (same as atlas)
+        Image padded = {
+            .data = RL_CALLOC(width*height, 2),
+            .width = width,
+            .height = height,
+            .mipmaps = 1,
+            .format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA
+        };
+
+        unsigned char *pixels = (unsigned char *)padded.data;
+        for (int i = 0; i < width*height; i++) pixels[2*i] = 255;
+
+        if (glyph.image.data != NULL)
+        {
+            for (int gy = 0; gy < glyph.image.height; gy++)
+            {
+                for (int gx = 0; gx < glyph.image.width; gx++)
+                {
+                    pixels[2*((gy + cache->padding)*width + gx + cache->padding) + 1] = ((unsigned char *)glyph.image.data)[gy*glyph.image.width + gx];
+                }
+            }
+        }
+
+        if (cache->texture.id > 0) rlUpdateTexture(cache->texture.id, x, y, width, height, cache->texture.format, padded.data);
+
+        Rectangle rec = { (float)cache->padding, (float)cache->padding, (float)glyph.image.width, (float)glyph.image.height };
+
+        // Glyph image is kept as the atlas rectangle, same as fonts with all glyphs loaded
+        RLUnloadImage(glyph.image);
+        glyph.image = ((rec.width > 0) && (rec.height > 0))? RLImageFromImage(padded, rec) : (Image){ 0 };
+        RLUnloadImage(padded);
+
+        slot = cache->freeSlots[--cache->freeCount];
+        cache->glyphs[slot] = glyph;
+        cache->recs[slot] = (Rectangle){ (float)(x + cache->padding), (float)(y + cache->padding), rec.width, rec.height };
+        cache->slotPages[slot] = page;
+        cache->pages[page].glyphCount++;
+
+        // NOTE: Entry found free on lookup could be moved by evictions, searched again
+        entry = ((unsigned int)codepoint*2654435761u >> 8) & mask;
+        while (cache->hashCodepoints[entry] != -1) entry = (entry + 1) & mask;
+
+        cache->hashCodepoints[entry] = codepoint;
+        cache->hashSlots[entry] = slot;
+    }
+
+    cache->pages[cache->slotPages[slot]].lastUse = cache->tick;
+
+    return slot;
+}
+
+// Pack rectangle on atlas page using skyline bottom-left heuristic, returns false if it does not fit
+static bool RLPackSkylinePage(FontAtlasPage *page, int width, int height, int pageWidth, int pageHeight, int *x, int *y)
+{
+    int bestIndex = -1;
+    int bestY = pageHeight;
+
+    // Lowest position where rectangle fits, over the nodes it spans
+    for (int i = 0; i < page->nodeCount; i++)
+    {
+        if ((page->nodes[i].x + width) > pageWidth) break;
+
+        int top = 0;
+        for (int j = i, remaining = width; remaining > 0; j++)
+        {
+            if (page->nodes[j].y > top) top = page->nodes[j].y;
+            remaining -= page->nodes[j].width;
+        }
+
+        if (((top + height) <= pageHeight) && (top < bestY))
+        {
+            bestIndex = i;
+            bestY = top;
+        }
+    }
+
+    if (bestIndex == -1) return false;
+
+    *x = page->nodes[bestIndex].x;
+    *y = bestY;
+
+    // Insert new node, raising skyline under the rectangle
+    memmove(&page->nodes[bestIndex + 1], &page->nodes[bestIndex], (page->nodeCount - bestIndex)*sizeof(FontSkylineNode));
+    page->nodes[bestIndex] = (FontSkylineNode){ *x, bestY + height, width };
+    page->nodeCount++;
+
+    // Shrink or remove nodes covered by the new one
+    int right = *x + width;
+
+    for (int i = bestIndex + 1; i < page->nodeCount;)
+    {
+        if (page->nodes[i].x >= right) break;
+
+        int overlap = right - page->nodes[i].x;
+
+        if (overlap < page->nodes[i].width)
+        {
+            page->nodes[i].x += overlap;
+            page->nodes[i].width -= overlap;
+            break;
+        }
+
+        memmove(&page->nodes[i], &page->nodes[i + 1], (page->nodeCount - i - 1)*sizeof(FontSkylineNode));
+        page->nodeCount--;
+    }
+
+    // Merge consecutive nodes at same height
+    for (int i = 0; i < (page->nodeCount - 1);)
+    {
+        if (page->nodes[i].y == page->nodes[i + 1].y)
+        {
+            page->nodes[i].width += page->nodes[i + 1].width;
+            memmove(&page->nodes[i + 1], &page->nodes[i + 2], (page->nodeCount - i - 2)*sizeof(FontSkylineNode));
+            page->nodeCount--;
+        }
+        else i++;
+    }
+
+    return true;
+}
+
+// Evict least recently used atlas page, its glyphs are removed from cache and page area reused
+static void RLEvictFontCachePage(FontGlyphCache *cache)
+{
+    int evicted = -1;
+
+    for (int i = 0; i < cache->pageCount; i++)
+    {
+        if ((cache->pages[i].glyphCount > 0) && ((evicted == -1) || (cache->pages[i].lastUse < cache->pages[evicted].lastUse))) evicted = i;
+    }
+
+    if (evicted == -1) return;
+
+    // Glyphs on evicted page could be used by vertices pending on render batch
+    rlDrawRenderBatchActive();
+
+    unsigned int mask = (unsigned int)cache->hashCapacity - 1;
+
+    for (int slot = 0; slot < cache->capacity; slot++)
+    {
+        if (cache->slotPages[slot] != evicted) continue;
+
+        // Remove hash entry, moving back following entries of the probe sequence
+        unsigned int entry = ((unsigned int)cache->glyphs[slot].value*2654435761u >> 8) & mask;
+        while (cache->hashCodepoints[entry] != cache->glyphs[slot].value) entry = (entry + 1) & mask;
+
+        for (unsigned int next = (entry + 1) & mask; cache->hashCodepoints[next] != -1; next = (next + 1) & mask)
+        {
+            unsigned int home = ((unsigned int)cache->hashCodepoints[next]*2654435761u >> 8) & mask;
+
+            // Entry can be moved back if its home is not cyclically in (entry, next]
+            if (((next - home) & mask) >= ((next - entry) & mask))
+            {
+                cache->hashCodepoints[entry] = cache->hashCodepoints[next];
+                cache->hashSlots[entry] = cache->hashSlots[next];
+                entry = next;
+            }
+        }
+
+        cache->hashCodepoints[entry] = -1;
+
+        RLUnloadImage(cache->glyphs[slot].image);
+        cache->glyphs[slot] = (GlyphInfo){ 0 };
+        cache->recs[slot] = (Rectangle){ 0 };
+        cache->slotPages[slot] = -1;
+        cache->freeSlots[cache->freeCount++] = slot;
+    }
+
+    cache->pages[evicted].nodes[0] = (FontSkylineNode){ 0, 0, cache->atlasSize };
+    cache->pages[evicted].nodeCount = 1;
+    cache->pages[evicted].glyphCount = 0;
+    cache->pages[evicted].lastUse = 0;
+
+    TRACELOG(LOG_DEBUG, "FONT: Dynamic font atlas page %i evicted", evicted);
+}
+#endif
+
+// Layout text into run, same layout as DrawTextEx() and same size as MeasureTextEx()
+// NOTE: Run buffers are reused if capacity (glyphs) is enough, grown otherwise
+static void RLLayoutTextRun(TextRun *run, int *capacity, Font font, const char *text, float fontSize, float spacing, float wrapWidth)
+{
+    int size = RLTextLength(text);    // Total size in bytes of the text, upper bound of codepoints count
+
+    if (size > *capacity)
+    {
+        // NOTE: Positions, codepoints and glyph indices share a single allocation
+        Vector2 *positions = (Vector2 *)RL_REALLOC(run->positions, size*(sizeof(Vector2) + 2*sizeof(int)));
+        if (positions == NULL) return;
+
+        run->positions = positions;
+        *capacity = size;
+    }
+
+    if (run->positions != NULL)
+    {
+        run->codepoints = (int *)(run->positions + *capacity);
+        run->glyphIndices = run->codepoints + *capacity;
+    }
+
+    run->font = font;
+    run->fontSize = fontSize;
+    run->spacing = spacing;
+    run->lineSpacing = textLineSpacing;
+    run->glyphCount = 0;
+    run->size = (Vector2){ 0.0f, 0.0f };
+
+    if (size == 0) return;
+
+    float scaleFactor = fontSize/font.baseSize;         // Character quad scaling factor
+    float lineStep = fontSize + textLineSpacing;        // NOTE: Line spacing is a global variable, use SetTextLineSpacing() to setup
+
+    float textOffsetX = 0.0f;       // Offset X to next character
+    float textOffsetY = 0.0f;       // Offset between lines
+    float textHeight = fontSize;
+
+    // Line measures, same as MeasureTextEx(): unscaled width and codepoints count
+    float lineWidth = 0.0f;
+    float maxLineWidth = 0.0f;
+    int lineCount = 0;
+    int maxLineCount = 0;
+
+    // Last space on current line, candidate for word wrapping
+    int spaceGlyph = -1;            // First glyph after space
+    float spaceOffsetX = 0.0f;      // Offset X after space
+    float spaceLineWidth = 0.0f;    // Line width before space
+    float spaceAdvance = 0.0f;      // Space measured width
+    int spaceLineCount = 0;         // Line codepoints before space
+
+    for (int i = 0; i < size;)
+    {
+        // Get next codepoint from byte string and glyph index in font
+        int codepointByteCount = 0;
+        int codepoint = RLGetCodepointNext(&text[i], &codepointByteCount);
+        int index = RLGetGlyphIndex(font, codepoint);
+
+        i += codepointByteCount;   // Move text bytes counter to next codepoint
+
+        if (codepoint == '\n')
+        {
+            if (maxLineWidth < lineWidth) maxLineWidth = lineWidth;
+            if (maxLineCount < lineCount) maxLineCount = lineCount;
+            lineWidth = 0.0f;
+            lineCount = 0;
+            spaceGlyph = -1;
+
+            textOffsetY += lineStep;
+            textHeight += lineStep;
+            textOffsetX = 0.0f;
+            continue;
+        }
+
+        float advance = 0.0f;
+        if (font.glyphs[index].advanceX == 0) advance = ((float)font.recs[index].width*scaleFactor + spacing);
+        else advance = ((float)font.glyphs[index].advanceX*scaleFactor + spacing);
+
+        float measure = 0.0f;
+        if (font.glyphs[index].advanceX > 0) measure = (float)font.glyphs[index].advanceX;
+        else measure = (font.recs[index].width + font.glyphs[index].offsetX);
+
+        // Word wrapping, glyph not fitting breaks the line at last space or just before the glyph
+        while ((wrapWidth > 0.0f) && (codepoint != ' ') && (textOffsetX > 0.0f) && ((textOffsetX + advance - spacing) > wrapWidth))
+        {
+            if (spaceGlyph >= 0)
+            {
+                // Last space turns into a linebreak, glyphs after it move to next line
+                if (maxLineWidth < spaceLineWidth) maxLineWidth = spaceLineWidth;
+                if (maxLineCount < spaceLineCount) maxLineCount = spaceLineCount;
+                lineWidth -= (spaceLineWidth + spaceAdvance);
+                lineCount -= (spaceLineCount + 1);
+
+                for (int g = spaceGlyph; g < run->glyphCount; g++)
+                {
+                    run->positions[g].x -= spaceOffsetX;
+                    run->positions[g].y += lineStep;
+                }
+
+                textOffsetX -= spaceOffsetX;
+                spaceGlyph = -1;
+            }
+            else
+            {
+                if (maxLineWidth < lineWidth) maxLineWidth = lineWidth;
+                if (maxLineCount < lineCount) maxLineCount = lineCount;
+                lineWidth = 0.0f;
+                lineCount = 0;
+
+                textOffsetX = 0.0f;
+            }
+
+            textOffsetY += lineStep;
+            textHeight += lineStep;
+        }
+
+        if (codepoint == ' ')
+        {
+            spaceGlyph = run->glyphCount;
+            spaceOffsetX = textOffsetX + advance;
+            spaceLineWidth = lineWidth;
+            spaceAdvance = measure;
+            spaceLineCount = lineCount;
+        }
+        else if (codepoint != '\t')
+        {
+            run->positions[run->glyphCount] = (Vector2){ textOffsetX, textOffsetY };
+            run->codepoints[run->glyphCount] = codepoint;
+            run->glyphIndices[run->glyphCount] = index;
+            run->glyphCount++;
+        }
+
+        textOffsetX += advance;
+        lineWidth += measure;
+        lineCount++;
+    }
+
+    if (maxLineWidth < lineWidth) maxLineWidth = lineWidth;
+    if (maxLineCount < lineCount) maxLineCount = lineCount;
+
+    run->size.x = maxLineWidth*scaleFactor + (float)((maxLineCount - 1)*spacing);
+    run->size.y = textHeight;
+}
+
+#if defined(SUPPORT_TEXT_RUN_CACHE)
+// Get text run from cache, text is laid out on cache miss, NULL if text is not cacheable
+// NOTE: Runs are keyed by font, text, size, spacing and line spacing, returned run is valid until next call,
+// texts longer than MAX_TEXT_BUFFER_LENGTH are not cached (cache memory stays bounded)
+// WARNING: Cache is not thread safe, only used by DrawTextEx() (main thread)
+static TextRun *RLGetCachedTextRun(Font font, const char *text, float fontSize, float spacing)
+{
+    if ((text == NULL) || (text[0] == '\0') || (font.glyphs == NULL)) return NULL;
+
+    // FNV-1a hash of text, combined with layout parameters
+    unsigned int hash = 2166136261u;
+    int length = 0;
+    for (; text[length] != '\0'; length++)
+    {
+        if (length >= MAX_TEXT_BUFFER_LENGTH) return NULL;
+        hash = (hash ^ (unsigned char)text[length])*16777619u;
+    }
+
+    unsigned int sizeBits = 0;
+    unsigned int spacingBits = 0;
+    memcpy(&sizeBits, &fontSize, sizeof(unsigned int));
+    memcpy(&spacingBits, &spacing, sizeof(unsigned int));
+    hash = (hash ^ font.texture.id)*16777619u;
+    hash = (hash ^ sizeBits)*16777619u;
+    hash = (hash ^ spacingBits)*16777619u;
+
+    TextRunCacheEntry *entry = &textRunCache[(hash ^ (hash >> 16)) & (TEXT_RUN_CACHE_SIZE - 1)];
+
+    if ((entry->text != NULL) && (entry->hash == hash) &&
+        (entry->run.font.glyphs == font.glyphs) && (entry->run.font.texture.id == font.texture.id) &&
+        (entry->run.fontSize == fontSize) && (entry->run.spacing == spacing) &&
+        (entry->run.lineSpacing == textLineSpacing) && (strcmp(entry->text, text) == 0)) return &entry->run;
+
+    // Cache miss, entry replaced reusing its memory
+    if (length + 1 > entry->textCapacity)
+    {
+        char *buffer = (char *)RL_REALLOC(entry->text, length + 1);
+        if (buffer == NULL) return NULL;
+
+        entry->text = buffer;
+        entry->textCapacity = length + 1;
+    }
+
+    RLLayoutTextRun(&entry->run, &entry->capacity, font, text, fontSize, spacing, 0.0f);
+
+    if (entry->capacity < length)
+    {
+        // Layout failed, entry left empty
+        entry->text[0] = '\0';
+        entry->run.font.glyphs = NULL;
+        return NULL;
+    }
+
+    memcpy(entry->text, text, length + 1);
+    entry->hash = hash;
+
+    return &entry->run;
+}
+
+// Unload cached text runs laid out with font, or all of them
+static void RLUnloadTextRunCache(Font font, bool all)
+{
+    for (int i = 0; i < TEXT_RUN_CACHE_SIZE; i++)
+    {
+        TextRunCacheEntry *entry = &textRunCache[i];
+
+        if (all || ((entry->run.font.glyphs == font.glyphs) && (entry->run.font.texture.id == font.texture.id)))
+        {
+            RL_FREE(entry->text);
+            RL_FREE(entry->run.positions);
+            *entry = (TextRunCacheEntry){ 0 };
+        }
+    }
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_FNT) || defined(SUPPORT_FILEFORMAT_BDF)
+// Read a line from memory
+// REQUIRES: memcpy()
+// NOTE: Returns the number of bytes read
+static int RLGetLine(const char *origin, char *buffer, int maxLength)
+{
+    int count = 0;
+    for (; count < maxLength - 1; count++) if (origin[count] == '\n') break;
+    memcpy(buffer, origin, count);
+    buffer[count] = '\0';
+    return count;
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_FNT)
+// Load a BMFont file (AngelCode font file)
+// REQUIRES: strstr(), sscanf(), strrchr(), memcpy()
+static Font RLLoadBMFont(const char *fileName)
+{
+    #define MAX_BUFFER_SIZE       256
+    #define MAX_FONT_IMAGE_PAGES    8
+
+    Font font = { 0 };
+
+    char buffer[MAX_BUFFER_SIZE] = { 0 };
+    char *searchPoint = NULL;
+
+    int fontSize = 0;
+    int glyphCount = 0;
+
+    int imWidth = 0;
+    int imHeight = 0;
+    int pageCount = 1;
+    char imFileName[MAX_FONT_IMAGE_PAGES][129] = { 0 };
+
+    int base = 0;       // Useless data
+    int readBytes = 0;  // Data bytes read
+    int readVars = 0;   // Variables filled by sscanf()
+
+    char *fileText = RLLoadFileText(fileName);
+
+    if (fileText == NULL) return font;
+
+    char *fileTextPtr = fileText;
+
+    // NOTE: We skip first line, it contains no useful information
+    readBytes = RLGetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+    fileTextPtr += (readBytes + 1);
+
+    // Read line data
+    readBytes = RLGetLine(fileTextPtr, buffer, MAX_BUFFER_SIZE);
+    searchPoint = strstr(buffer, "lineHeight");
+    readVars = sscanf(searchPoint, "lineHeight=%i base=%i scaleW=%i scaleH=%i pages=%i", &fontSize, &base, &imWidth, &imHeight, &pageCount);
+    fileTextPtr += (readBytes + 1);
+
+    if (readVars < 4) { RLUnloadFileText(fileText); return font; } // Some data not available, file malformed
 
     if (pageCount > MAX_FONT_IMAGE_PAGES)
     {
@@ -2306,6 +3495,8 @@ static Font RLLoadBMFont(const char *fileName)
     RLUnloadImage(fullFont);
     RLUnloadFileText(fileText);
 
+    font.lookup = RLLoadGlyphLookup(font.glyphs, font.glyphCount);
+
     if (isGpuReady && (font.texture.id == 0))
     {
         RLUnloadFont(font);
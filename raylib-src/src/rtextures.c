@@ -34,6 +34,10 @@
 *       #define SUPPORT_IMAGE_GENERATION
 *           Support procedural image generation functionality (gradient, spot, perlin-noise, cellular)
 *
+*       #define SUPPORT_SIMD_FILTERING
+*           Use SIMD kernels (SSE2/NEON, if available on target) for image filtering, ImageBlurGaussian(), ImageKernelConvolution(),
+*           and pixel format conversion, ImageFormat()
+*
 *   DEPENDENCIES:
 *       stb_image        - Multiple image formats loading (JPEG, PNG, BMP, TGA, PSD, GIF, PIC)
 *                          NOTE: stb_image has been slightly modified to support Android platform.
@@ -78,6 +82,16 @@
 #include <math.h>               // Required for: fabsf() [Used in DrawTextureRec()]
 #include <stdio.h>              // Required for: sprintf() [Used in ExportImageAsCode()]
 
+#if defined(SUPPORT_SIMD_FILTERING)
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #define RL_FILTERING_SSE2
+        #include <emmintrin.h>          // Required for: SSE2 intrinsics [Used in ImageBlurGaussian(), ImageKernelConvolution(), ImageFormat()]
+    #elif defined(__ARM_NEON) && defined(__aarch64__)
+        #define RL_FILTERING_NEON
+        #include <arm_neon.h>           // Required for: NEON intrinsics [Used in ImageBlurGaussian(), ImageKernelConvolution(), ImageFormat()]
+    #endif
+#endif
+
 // Support only desired texture formats on stb_image
 #if !defined(SUPPORT_FILEFORMAT_BMP)
     #define STBI_NO_BMP
@@ -232,14 +246,76 @@
     #define PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD  50    // Threshold over 255 to set alpha as 0
 #endif
 
+#ifndef IMAGE_FORMAT_BATCH_PIXELS
+    #define IMAGE_FORMAT_BATCH_PIXELS  256 // Pixels unpacked per batch on format conversion, through a stack colors buffer
+#endif
+
 #ifndef GAUSSIAN_BLUR_ITERATIONS
     #define GAUSSIAN_BLUR_ITERATIONS  4    // Number of box blur iterations to approximate gaussian blur
 #endif
+#ifndef IMAGE_FILTER_BATCH_ROWS
+    #define IMAGE_FILTER_BATCH_ROWS  32    // Image rows filtered per band (and minimum per worker batch) on blur/convolution
+#endif
+#ifndef IMAGE_FILTER_STRIP_COLUMNS
+    #define IMAGE_FILTER_STRIP_COLUMNS  16 // Image columns filtered together on blur vertical passes (cache blocking)
+#endif
+#ifndef SPRITE_QUEUE_MAX_SHADERS
+    #define SPRITE_QUEUE_MAX_SHADERS    16 // Maximum number of shaders used per sprite queue (default shader included)
+#endif
+#ifndef SPRITE_QUEUE_BATCH_SPRITES
+    #define SPRITE_QUEUE_BATCH_SPRITES  4096 // Sprites quads built per worker batch on sprite queue drawing
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// Pixels row conversion function, from/to RGBA 8bit colors
+// NOTE: Used on ImageFormat() for uncompressed 8bit per channel (or less) pixel formats
+typedef void (*PixelRowConverter)(const void *src, void *dst, int count);
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Image filtering job data, shared by all workers
+// NOTE: Used on ImageBlurGaussian() and ImageKernelConvolution()
+typedef struct ImageFilterJob {
+    Color *pixels;                  // Source pixels (blur passes are applied in-place)
+    Color *output;                  // Output pixels (convolution only)
+    int width;                      // Image width
+    int height;                     // Image height
+    int radius;                     // Box blur radius
+    int kernelWidth;                // Convolution kernel width (square kernel)
+    const float *kernel;            // Convolution kernel, NULL if applied as separable
+    const float *rowWeights;        // Separable kernel horizontal weights (kernelWidth)
+    const float *colWeights;        // Separable kernel vertical weights (kernelWidth)
+} ImageFilterJob;
+#endif
+
+// Sprite queued for deferred drawing
+typedef struct rSprite {
+    Rectangle dest;                 // Destination rectangle (positive size)
+    Vector2 origin;                 // Rotation origin, relative to destination rectangle
+    float rotation;                 // Rotation in degrees
+    float texcoords[4];             // Texture coordinates: left, top, right, bottom (flipping applied)
+    Color tint;                     // Tint color
+} rSprite;
+
+// Sprite queue internal data
+// NOTE: Sort keys pack [layer:16|blend:8|shader:8|texture:32], sprites are drawn in key order
+struct rSpriteQueue {
+    rSprite *sprites;               // Sprites queued
+    unsigned long long *keys;       // Sprites sort keys
+    unsigned int *order;            // Sprites indices, sorted on drawing
+    unsigned long long *sortKeys;   // Radix sort keys buffer
+    unsigned int *sortOrder;        // Radix sort indices buffer
+    Vector2 *corners;               // Sprites quads corners (4 per sprite), built on drawing in sorted order
+    int capacity;                   // Maximum number of sprites (before growing)
+    int count;                      // Number of sprites queued
+
+    int layer;                      // Layer for next queued sprites
+    int blendMode;                  // Blend mode for next queued sprites
+    int shaderIndex;                // Shader index for next queued sprites
+    int shaderCount;                // Number of shaders registered
+    Shader shaders[SPRITE_QUEUE_MAX_SHADERS]; // Shaders used by queued sprites, [0] refers to default shader
+};
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -257,6 +333,34 @@ extern void RLLoadFontDefault(void);          // [Module: text] Loads default fo
 static float RLHalfToFloat(unsigned short x);
 static unsigned short RLFloatToHalf(float x);
 static Vector4 * RLLoadImageDataNormalized(Image image);       // Load pixel data from image as Vector4 array (float normalized)
+static void RLUnpackGrayscaleRow(const void *src, void *dst, int count);    // Unpack grayscale pixels to RGBA colors [ImageFormat()]
+static void RLUnpackGrayAlphaRow(const void *src, void *dst, int count);    // Unpack gray+alpha pixels to RGBA colors [ImageFormat()]
+static void RLUnpackR5G6B5Row(const void *src, void *dst, int count);       // Unpack R5G6B5 pixels to RGBA colors [ImageFormat()]
+static void RLUnpackR8G8B8Row(const void *src, void *dst, int count);       // Unpack R8G8B8 pixels to RGBA colors [ImageFormat()]
+static void RLUnpackR5G5B5A1Row(const void *src, void *dst, int count);     // Unpack R5G5B5A1 pixels to RGBA colors [ImageFormat()]
+static void RLUnpackR4G4B4A4Row(const void *src, void *dst, int count);     // Unpack R4G4B4A4 pixels to RGBA colors [ImageFormat()]
+static void RLPackGrayscaleRow(const void *src, void *dst, int count);      // Pack RGBA colors to grayscale pixels [ImageFormat()]
+static void RLPackGrayAlphaRow(const void *src, void *dst, int count);      // Pack RGBA colors to gray+alpha pixels [ImageFormat()]
+static void RLPackR5G6B5Row(const void *src, void *dst, int count);         // Pack RGBA colors to R5G6B5 pixels [ImageFormat()]
+static void RLPackR8G8B8Row(const void *src, void *dst, int count);         // Pack RGBA colors to R8G8B8 pixels [ImageFormat()]
+static void RLPackR5G5B5A1Row(const void *src, void *dst, int count);       // Pack RGBA colors to R5G5B5A1 pixels [ImageFormat()]
+static void RLPackR4G4B4A4Row(const void *src, void *dst, int count);       // Pack RGBA colors to R4G4B4A4 pixels [ImageFormat()]
+static void RLPackShortRow(const Color *pixels, unsigned short *output, int count, int format); // Pack RGBA colors to 16bit pixels [ImageFormat()]
+static void RLConvertShortRow(const unsigned short *input, unsigned short *output, int count, int srcFormat, int dstFormat); // Convert between 16bit pixel formats [ImageFormat()]
+static void RLGetShortPixelLayout(int format, int *max, int *shift);  // Get 16bit pixel format channels max values and bit shifts
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+static void RLBoxBlurLine(const unsigned short *src, unsigned short *dst, int count, int lanes, int radius);
+static void RLLoadFilterRow(const Color *pixels, int width, int padLeft, int padRight, float *row);
+static void RLConvolveFilterRow(const float *row, int width, const float *weights, int count, float *output);
+static void RLAccumulateFilterRow(const float *row, int size, float weight, float *output);
+static void RLStoreFilterRow(const float *row, int width, Color *pixels);
+static void RLBlurRowsRange(void *userData, int start, int end, int worker);      // Blur image rows range, horizontal passes [ImageBlurGaussian()]
+static void RLBlurColumnsRange(void *userData, int start, int end, int worker);   // Blur image column strips range, vertical passes [ImageBlurGaussian()]
+static void RLConvolveRowsRange(void *userData, int start, int end, int worker);  // Convolve image rows range [ImageKernelConvolution()]
+#endif
+static bool RLResizeSpriteQueue(rSpriteQueue *data, int capacity);                 // Resize sprite queue buffers [QueueTexturePro()]
+static void RLSortSpriteQueue(rSpriteQueue *data);                                  // Sort sprites by key, radix sort [DrawSpriteQueue()]
+static void RLBuildSpriteQuadsRange(void *userData, int start, int end, int worker); // Build sorted sprites quads range [DrawSpriteQueue()]
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -280,16 +384,16 @@ Image RLLoadImage(const char *fileName)
     #define STBI_REQUIRED
 #endif
 
-    // Loading file to memory
-    int dataSize = 0;
-    unsigned char *fileData = RLLoadFileData(fileName, &dataSize);
+    // Mapping file in memory, image decoded directly from file data
+    MappedFile file = RLLoadMappedFile(fileName);
 
     // Loading image from memory data
-    if (fileData != NULL)
+    if (RLIsMappedFileValid(file))
     {
-        image = RLLoadImageFromMemory(RLGetFileExtension(fileName), fileData, dataSize);
+        if (file.size <= 2147483647) image = RLLoadImageFromMemory(RLGetFileExtension(fileName), file.data, (int)file.size);
+        else TRACELOG(LOG_WARNING, "IMAGE: [%s] File is bigger than 2147483647 bytes, not supported", fileName);
 
-        RLUnloadFileData(fileData);
+        RLUnloadMappedFile(file);
     }
 
     return image;
@@ -300,12 +404,12 @@ Image RLLoadImageRaw(const char *fileName, int width, int height, int format, in
 {
     Image image = { 0 };
 
-    int dataSize = 0;
-    unsigned char *fileData = RLLoadFileData(fileName, &dataSize);
+    MappedFile file = RLLoadMappedFile(fileName);
 
-    if (fileData != NULL)
+    if (RLIsMappedFileValid(file))
     {
-        unsigned char *dataPtr = fileData;
+        const unsigned char *dataPtr = file.data;
+        long long dataSize = file.size;
         int size = RLGetPixelDataSize(width, height, format);
 
         if (size <= dataSize)   // Security check
@@ -321,7 +425,7 @@ Image RLLoadImageRaw(const char *fileName, int width, int height, int format, in
             image.format = format;
         }
 
-        RLUnloadFileData(fileData);
+        RLUnloadMappedFile(file);
     }
 
     return image;
@@ -340,21 +444,21 @@ Image RLLoadImageAnim(const char *fileName, int *frames)
 #if defined(SUPPORT_FILEFORMAT_GIF)
     if (RLIsFileExtension(fileName, ".gif"))
     {
-        int dataSize = 0;
-        unsigned char *fileData = RLLoadFileData(fileName, &dataSize);
+        MappedFile file = RLLoadMappedFile(fileName);
 
-        if (fileData != NULL)
+        if (RLIsMappedFileValid(file) && (file.size <= 2147483647))
         {
             int comp = 0;
             int *delays = NULL;
-            image.data = stbi_load_gif_from_memory(fileData, dataSize, &delays, &image.width, &image.height, &frameCount, &comp, 4);
+            image.data = stbi_load_gif_from_memory(file.data, (int)file.size, &delays, &image.width, &image.height, &frameCount, &comp, 4);
 
             image.mipmaps = 1;
             image.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
 
-            RLUnloadFileData(fileData);
             RL_FREE(delays);        // NOTE: Frames delays are discarded
         }
+
+        RLUnloadMappedFile(file);
     }
 #else
     if (false) { }
@@ -1258,7 +1362,74 @@ void RLImageFormat(Image *image, int newFormat)
 
     if ((newFormat != 0) && (image->format != newFormat))
     {
-        if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
+        // Pixels row converters from/to RGBA colors, indexed by pixel format
+        // NOTE: Formats with no converter (16/32 bit per channel) are converted through float normalized data
+        static const PixelRowConverter unpackRow[PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 + 1] = {
+            NULL, RLUnpackGrayscaleRow, RLUnpackGrayAlphaRow, RLUnpackR5G6B5Row, RLUnpackR8G8B8Row, RLUnpackR5G5B5A1Row, RLUnpackR4G4B4A4Row, NULL
+        };
+        static const PixelRowConverter packRow[PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 + 1] = {
+            NULL, RLPackGrayscaleRow, RLPackGrayAlphaRow, RLPackR5G6B5Row, RLPackR8G8B8Row, RLPackR5G5B5A1Row, RLPackR4G4B4A4Row, NULL
+        };
+
+        if ((image->format >= 1) && (image->format <= PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) &&
+            (newFormat >= 1) && (newFormat <= PIXELFORMAT_UNCOMPRESSED_R8G8B8A8))
+        {
+            int pixelCount = image->width*image->height;
+            int srcBytes = RLGetPixelDataSize(1, 1, image->format);
+            int dstBytes = RLGetPixelDataSize(1, 1, newFormat);
+            unsigned char *src = (unsigned char *)image->data;
+
+            // Convert in-place when pixels do not grow, output is always behind input
+            // WARNING! We loose mipmaps data --> Regenerated at the end...
+            unsigned char *dst = (dstBytes <= srcBytes)? src : (unsigned char *)RL_MALLOC(pixelCount*dstBytes);
+
+            if (image->format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) packRow[newFormat](src, dst, pixelCount);
+            else if (newFormat == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) unpackRow[image->format](src, dst, pixelCount);
+            else if ((srcBytes == 2) && (dstBytes == 2) && (image->format != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA) &&
+                     (newFormat != PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA))
+            {
+                // 16bit to 16bit conversions are requantized directly, avoiding 8bit intermediate rounding
+                RLConvertShortRow((const unsigned short *)src, (unsigned short *)dst, pixelCount, image->format, newFormat);
+            }
+            else
+            {
+                // Unpack pixels in batches to a small colors buffer, no full image intermediate required
+                Color batch[IMAGE_FORMAT_BATCH_PIXELS] = { 0 };
+
+                for (int i = 0; i < pixelCount; i += IMAGE_FORMAT_BATCH_PIXELS)
+                {
+                    int count = ((pixelCount - i) < IMAGE_FORMAT_BATCH_PIXELS)? (pixelCount - i) : IMAGE_FORMAT_BATCH_PIXELS;
+
+                    unpackRow[image->format](src + i*srcBytes, batch, count);
+                    packRow[newFormat](batch, dst + i*dstBytes, count);
+                }
+            }
+
+            if (dst != src)
+            {
+                RL_FREE(src);
+                image->data = dst;
+            }
+            else
+            {
+                // Shrink pixel data to converted size (mipmaps dropped)
+                void *data = RL_REALLOC(dst, pixelCount*dstBytes);
+                if (data != NULL) image->data = data;
+            }
+
+            image->format = newFormat;
+
+            // In case original image had mipmaps, generate mipmaps for formatted image
+            // NOTE: Original mipmaps are replaced by new ones, if custom mipmaps were used, they are lost
+            if (image->mipmaps > 1)
+            {
+                image->mipmaps = 1;
+            #if defined(SUPPORT_IMAGE_MANIPULATION)
+                RLImageMipmaps(image);
+            #endif
+            }
+        }
+        else if ((image->format < PIXELFORMAT_COMPRESSED_DXT1_RGB) && (newFormat < PIXELFORMAT_COMPRESSED_DXT1_RGB))
         {
             Vector4 *pixels = RLLoadImageDataNormalized(*image);     // Supports 8 to 32 bit per channel
 
@@ -2090,142 +2261,29 @@ void RLImageAlphaPremultiply(Image *image)
 }
 
 // Apply box blur to image
+// NOTE: Box blur passes are applied on 8.8 fixed-point premultiplied pixels, horizontal passes
+// row by row and vertical passes on column strips, spreading rows/strips across job workers
 void RLImageBlurGaussian(Image *image, int blurSize)
 {
     // Security check to avoid program crash
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0)) return;
 
-    RLImageAlphaPremultiply(image);
-
     Color *pixels = RLLoadImageColors(*image);
 
-    // Loop switches between pixelsCopy1 and pixelsCopy2
-    Vector4 *pixelsCopy1 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *pixelsCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-
-    for (int i = 0; i < (image->height*image->width); i++)
-    {
-        pixelsCopy1[i].x = pixels[i].r;
-        pixelsCopy1[i].y = pixels[i].g;
-        pixelsCopy1[i].z = pixels[i].b;
-        pixelsCopy1[i].w = pixels[i].a;
-    }
+    ImageFilterJob job = {
+        .pixels = pixels,
+        .width = image->width,
+        .height = image->height,
+        .radius = (blurSize > 0)? blurSize : 0
+    };
 
     // Repeated convolution of rectangular window signal by itself converges to a gaussian distribution
-    for (int j = 0; j < GAUSSIAN_BLUR_ITERATIONS; j++)
-    {
-        // Horizontal motion blur
-        for (int row = 0; row < image->height; row++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
-
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy1[row*image->width + i].x;
-                avgG += pixelsCopy1[row*image->width + i].y;
-                avgB += pixelsCopy1[row*image->width + i].z;
-                avgAlpha += pixelsCopy1[row*image->width + i].w;
-            }
-
-            for (int x = 0; x < image->width; x++)
-            {
-                if (x-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy1[row*image->width + x-blurSize-1].x;
-                    avgG -= pixelsCopy1[row*image->width + x-blurSize-1].y;
-                    avgB -= pixelsCopy1[row*image->width + x-blurSize-1].z;
-                    avgAlpha -= pixelsCopy1[row*image->width + x-blurSize-1].w;
-                    convolutionSize--;
-                }
-
-                if (x+blurSize < image->width)
-                {
-                    avgR += pixelsCopy1[row*image->width + x+blurSize].x;
-                    avgG += pixelsCopy1[row*image->width + x+blurSize].y;
-                    avgB += pixelsCopy1[row*image->width + x+blurSize].z;
-                    avgAlpha += pixelsCopy1[row*image->width + x+blurSize].w;
-                    convolutionSize++;
-                }
-
-                pixelsCopy2[row*image->width + x].x = avgR/convolutionSize;
-                pixelsCopy2[row*image->width + x].y = avgG/convolutionSize;
-                pixelsCopy2[row*image->width + x].z = avgB/convolutionSize;
-                pixelsCopy2[row*image->width + x].w = avgAlpha/convolutionSize;
-            }
-        }
-
-        // Vertical motion blur
-        for (int col = 0; col < image->width; col++)
-        {
-            float avgR = 0.0f;
-            float avgG = 0.0f;
-            float avgB = 0.0f;
-            float avgAlpha = 0.0f;
-            int convolutionSize = blurSize;
-
-            for (int i = 0; i < blurSize; i++)
-            {
-                avgR += pixelsCopy2[i*image->width + col].x;
-                avgG += pixelsCopy2[i*image->width + col].y;
-                avgB += pixelsCopy2[i*image->width + col].z;
-                avgAlpha += pixelsCopy2[i*image->width + col].w;
-            }
-
-            for (int y = 0; y < image->height; y++)
-            {
-                if (y-blurSize-1 >= 0)
-                {
-                    avgR -= pixelsCopy2[(y-blurSize-1)*image->width + col].x;
-                    avgG -= pixelsCopy2[(y-blurSize-1)*image->width + col].y;
-                    avgB -= pixelsCopy2[(y-blurSize-1)*image->width + col].z;
-                    avgAlpha -= pixelsCopy2[(y-blurSize-1)*image->width + col].w;
-                    convolutionSize--;
-                }
-                if (y+blurSize < image->height)
-                {
-                    avgR += pixelsCopy2[(y+blurSize)*image->width + col].x;
-                    avgG += pixelsCopy2[(y+blurSize)*image->width + col].y;
-                    avgB += pixelsCopy2[(y+blurSize)*image->width + col].z;
-                    avgAlpha += pixelsCopy2[(y+blurSize)*image->width + col].w;
-                    convolutionSize++;
-                }
-
-                pixelsCopy1[y*image->width + col].x = (unsigned char) (avgR/convolutionSize);
-                pixelsCopy1[y*image->width + col].y = (unsigned char) (avgG/convolutionSize);
-                pixelsCopy1[y*image->width + col].z = (unsigned char) (avgB/convolutionSize);
-                pixelsCopy1[y*image->width + col].w = (unsigned char) (avgAlpha/convolutionSize);
-            }
-        }
-    }
-
-    // Reverse premultiply
-    for (int i = 0; i < (image->width)*(image->height); i++)
-    {
-        if (pixelsCopy1[i].w == 0.0f)
-        {
-            pixels[i].r = 0;
-            pixels[i].g = 0;
-            pixels[i].b = 0;
-            pixels[i].a = 0;
-        }
-        else if (pixelsCopy1[i].w <= 255.0f)
-        {
-            float alpha = (float)pixelsCopy1[i].w/255.0f;
-            pixels[i].r = (unsigned char)((float)pixelsCopy1[i].x/alpha);
-            pixels[i].g = (unsigned char)((float)pixelsCopy1[i].y/alpha);
-            pixels[i].b = (unsigned char)((float)pixelsCopy1[i].z/alpha);
-            pixels[i].a = (unsigned char) pixelsCopy1[i].w;
-        }
-    }
+    // NOTE: Horizontal and vertical box filters commute, so all horizontal passes are applied first
+    RLParallelFor(image->height, IMAGE_FILTER_BATCH_ROWS, RLBlurRowsRange, &job);
+    RLParallelFor((image->width + IMAGE_FILTER_STRIP_COLUMNS - 1)/IMAGE_FILTER_STRIP_COLUMNS, 1, RLBlurColumnsRange, &job);
 
     int format = image->format;
     RL_FREE(image->data);
-    RL_FREE(pixelsCopy1);
-    RL_FREE(pixelsCopy2);
 
     image->data = pixels;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
@@ -2234,7 +2292,9 @@ void RLImageBlurGaussian(Image *image, int blurSize)
 }
 
 // Apply custom square convolution kernel to image
-// NOTE: The convolution kernel matrix is expected to be square
+// NOTE 1: The convolution kernel matrix is expected to be square
+// NOTE 2: Separable kernels (i.e. gaussian, box, sobel) are applied as two 1D passes
+// NOTE 3: Pixels outside image bounds are considered transparent black (zero)
 void RLImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
 {
     if ((image->data == NULL) || (image->width == 0) || (image->height == 0) || kernel == NULL) return;
@@ -2247,118 +2307,53 @@ void RLImageKernelConvolution(Image *image, const float *kernel, int kernelSize)
         return;
     }
 
-    Color *pixels = RLLoadImageColors(*image);
-
-    Vector4 *imageCopy2 = RL_MALLOC((image->height)*(image->width)*sizeof(Vector4));
-    Vector4 *temp = RL_MALLOC(kernelSize*sizeof(Vector4));
+    // Check if kernel is separable (rank 1): kernel[i][j] == colWeights[i]*rowWeights[j]
+    float *weights = RL_MALLOC(2*kernelWidth*sizeof(float));
+    float *colWeights = weights;
+    float *rowWeights = weights + kernelWidth;
+    int pivot = 0;
 
-    for (int i = 0; i < kernelSize; i++)
-    {
-        temp[i].x = 0.0f;
-        temp[i].y = 0.0f;
-        temp[i].z = 0.0f;
-        temp[i].w = 0.0f;
-    }
+    for (int i = 1; i < kernelSize; i++) if (fabsf(kernel[i]) > fabsf(kernel[pivot])) pivot = i;
 
-    float rRes = 0.0f;
-    float gRes = 0.0f;
-    float bRes = 0.0f;
-    float aRes = 0.0f;
+    bool separable = (kernel[pivot] != 0.0f);
 
-    int startRange = 0, endRange = 0;
-
-    if (kernelWidth%2 == 0)
-    {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2;
-    }
-    else
+    if (separable)
     {
-        startRange = -kernelWidth/2;
-        endRange = kernelWidth/2 + 1;
-    }
+        float tolerance = fabsf(kernel[pivot])*1e-5f;
 
-    for (int x = 0; x < image->height; x++)
-    {
-        for (int y = 0; y < image->width; y++)
+        for (int i = 0; i < kernelWidth; i++)
         {
-            for (int xk = startRange; xk < endRange; xk++)
-            {
-                for (int yk = startRange; yk < endRange; yk++)
-                {
-                    int xkabs = xk + kernelWidth/2;
-                    int ykabs = yk + kernelWidth/2;
-                    unsigned int imgindex = image->width*(x + xk) + (y + yk);
-
-                    if (imgindex >= (unsigned int)(image->width*image->height))
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].y = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].z = 0.0f;
-                        temp[kernelWidth*xkabs + ykabs].w = 0.0f;
-                    }
-                    else
-                    {
-                        temp[kernelWidth*xkabs + ykabs].x = ((float)pixels[imgindex].r)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].y = ((float)pixels[imgindex].g)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].z = ((float)pixels[imgindex].b)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                        temp[kernelWidth*xkabs + ykabs].w = ((float)pixels[imgindex].a)/255.0f*kernel[kernelWidth*xkabs + ykabs];
-                    }
-                }
-            }
-
-            for (int i = 0; i < kernelSize; i++)
-            {
-                rRes += temp[i].x;
-                gRes += temp[i].y;
-                bRes += temp[i].z;
-                aRes += temp[i].w;
-            }
-
-            if (rRes < 0.0f) rRes = 0.0f;
-            if (gRes < 0.0f) gRes = 0.0f;
-            if (bRes < 0.0f) bRes = 0.0f;
-
-            if (rRes > 1.0f) rRes = 1.0f;
-            if (gRes > 1.0f) gRes = 1.0f;
-            if (bRes > 1.0f) bRes = 1.0f;
-
-            imageCopy2[image->width*x + y].x = rRes;
-            imageCopy2[image->width*x + y].y = gRes;
-            imageCopy2[image->width*x + y].z = bRes;
-            imageCopy2[image->width*x + y].w = aRes;
-
-            rRes = 0.0f;
-            gRes = 0.0f;
-            bRes = 0.0f;
-            aRes = 0.0f;
+            colWeights[i] = kernel[i*kernelWidth + pivot%kernelWidth];
+            rowWeights[i] = kernel[(pivot/kernelWidth)*kernelWidth + i]/kernel[pivot];
+        }
 
-            for (int i = 0; i < kernelSize; i++)
-            {
-                temp[i].x = 0.0f;
-                temp[i].y = 0.0f;
-                temp[i].z = 0.0f;
-                temp[i].w = 0.0f;
-            }
+        for (int i = 0; (i < kernelSize) && separable; i++)
+        {
+            if (fabsf(colWeights[i/kernelWidth]*rowWeights[i%kernelWidth] - kernel[i]) > tolerance) separable = false;
         }
     }
 
-    for (int i = 0; i < (image->width*image->height); i++)
-    {
-        float alpha = (float)imageCopy2[i].w;
+    Color *pixels = RLLoadImageColors(*image);
 
-        pixels[i].r = (unsigned char)((imageCopy2[i].x)*255.0f);
-        pixels[i].g = (unsigned char)((imageCopy2[i].y)*255.0f);
-        pixels[i].b = (unsigned char)((imageCopy2[i].z)*255.0f);
-        pixels[i].a = (unsigned char)((alpha)*255.0f);
-    }
+    ImageFilterJob job = {
+        .pixels = pixels,
+        .output = RL_MALLOC(image->width*image->height*sizeof(Color)),
+        .width = image->width,
+        .height = image->height,
+        .kernelWidth = kernelWidth,
+        .kernel = separable? NULL : kernel,
+        .rowWeights = rowWeights,
+        .colWeights = colWeights
+    };
+
+    RLParallelFor(image->height, IMAGE_FILTER_BATCH_ROWS, RLConvolveRowsRange, &job);
 
     int format = image->format;
     RL_FREE(image->data);
-    RL_FREE(imageCopy2);
-    RL_FREE(temp);
+    RL_FREE(pixels);
+    RL_FREE(weights);
 
-    image->data = pixels;
+    image->data = job.output;
     image->format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
     RLImageFormat(image, format);
 }
@@ -4808,6 +4803,255 @@ void RLDrawTextureNPatch(Texture2D texture, NPatchInfo nPatchInfo, Rectangle des
     }
 }
 
+// Load sprite queue, capacity grows as required
+SpriteQueue RLLoadSpriteQueue(int capacity)
+{
+    SpriteQueue queue = { 0 };
+
+    rSpriteQueue *data = (rSpriteQueue *)RL_CALLOC(1, sizeof(rSpriteQueue));
+
+    if (data != NULL)
+    {
+        data->blendMode = BLEND_ALPHA;
+        data->shaderCount = 1;      // NOTE: shaders[0] refers to default shader, resolved on drawing
+
+        if (RLResizeSpriteQueue(data, (capacity > 0)? capacity : 1024))
+        {
+            queue.data = data;
+            TRACELOG(LOG_DEBUG, "TEXTURE: Sprite queue loaded successfully (capacity: %i)", data->capacity);
+        }
+        else RL_FREE(data);
+    }
+
+    if (queue.data == NULL) TRACELOG(LOG_WARNING, "TEXTURE: Failed to load sprite queue");
+
+    return queue;
+}
+
+// Check if a sprite queue is valid
+bool RLIsSpriteQueueValid(SpriteQueue queue)
+{
+    return (queue.data != NULL);
+}
+
+// Unload sprite queue
+void RLUnloadSpriteQueue(SpriteQueue queue)
+{
+    rSpriteQueue *data = queue.data;
+
+    if (data != NULL)
+    {
+        RL_FREE(data->sprites);
+        RL_FREE(data->keys);
+        RL_FREE(data->order);
+        RL_FREE(data->sortKeys);
+        RL_FREE(data->sortOrder);
+        RL_FREE(data->corners);
+        RL_FREE(data);
+    }
+}
+
+// Set layer for next queued sprites
+// NOTE: Lower layers are drawn first, layer is clamped to [-32768..32767]
+void RLSetSpriteQueueLayer(SpriteQueue queue, int layer)
+{
+    if (queue.data == NULL) return;
+
+    if (layer < -32768) layer = -32768;
+    else if (layer > 32767) layer = 32767;
+
+    queue.data->layer = layer;
+}
+
+// Set blend mode for next queued sprites
+void RLSetSpriteQueueBlendMode(SpriteQueue queue, int mode)
+{
+    if (queue.data == NULL) return;
+
+    if ((mode < 0) || (mode > 255)) TRACELOG(LOG_WARNING, "TEXTURE: Sprite queue blend mode not valid");
+    else queue.data->blendMode = mode;
+}
+
+// Set shader for next queued sprites
+// NOTE: Up to SPRITE_QUEUE_MAX_SHADERS different shaders can be used per queue drawing
+void RLSetSpriteQueueShader(SpriteQueue queue, Shader shader)
+{
+    rSpriteQueue *data = queue.data;
+    if (data == NULL) return;
+
+    int index = -1;
+
+    if ((shader.id == 0) || (shader.id == rlGetShaderIdDefault())) index = 0;
+
+    for (int i = 1; (index == -1) && (i < data->shaderCount); i++)
+    {
+        if (data->shaders[i].id == shader.id) { index = i; break; }
+    }
+
+    if (index == -1)
+    {
+        if (data->shaderCount < SPRITE_QUEUE_MAX_SHADERS)
+        {
+            index = data->shaderCount;
+            data->shaders[index] = shader;
+            data->shaderCount++;
+        }
+        else
+        {
+            TRACELOG(LOG_WARNING, "TEXTURE: Sprite queue shaders limit reached (%i), using default shader", SPRITE_QUEUE_MAX_SHADERS);
+            index = 0;
+        }
+    }
+
+    data->shaderIndex = index;
+}
+
+// Queue a part of a texture defined by a rectangle with 'pro' parameters
+// NOTE: Parameters work the same as DrawTexturePro(), quad is built on DrawSpriteQueue()
+void RLQueueTexturePro(SpriteQueue queue, Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    rSpriteQueue *data = queue.data;
+
+    // Check if queue and texture are valid
+    if ((data == NULL) || (texture.id == 0)) return;
+
+    if ((data->count == data->capacity) && !RLResizeSpriteQueue(data, data->capacity*2))
+    {
+        TRACELOG(LOG_WARNING, "TEXTURE: Failed to grow sprite queue, sprite skipped");
+        return;
+    }
+
+    float width = (float)texture.width;
+    float height = (float)texture.height;
+
+    bool flipX = false;
+
+    if (source.width < 0) { flipX = true; source.width *= -1; }
+    if (source.height < 0) source.y -= source.height;
+
+    if (dest.width < 0) dest.width *= -1;
+    if (dest.height < 0) dest.height *= -1;
+
+    rSprite *sprite = &data->sprites[data->count];
+
+    sprite->dest = dest;
+    sprite->origin = origin;
+    sprite->rotation = rotation;
+    sprite->tint = tint;
+    sprite->texcoords[0] = (flipX? (source.x + source.width) : source.x)/width;
+    sprite->texcoords[1] = source.y/height;
+    sprite->texcoords[2] = (flipX? source.x : (source.x + source.width))/width;
+    sprite->texcoords[3] = (source.y + source.height)/height;
+
+    data->keys[data->count] = ((unsigned long long)(data->layer + 32768) << 48) |
+                              ((unsigned long long)data->blendMode << 40) |
+                              ((unsigned long long)data->shaderIndex << 32) |
+                              (unsigned long long)texture.id;
+    data->count++;
+}
+
+// Get number of sprites queued
+int RLGetSpriteQueueCount(SpriteQueue queue)
+{
+    return (queue.data != NULL)? queue.data->count : 0;
+}
+
+// Clear queued sprites, without drawing
+// NOTE: Layer, blend mode and shader for next queued sprites are kept
+void RLClearSpriteQueue(SpriteQueue queue)
+{
+    rSpriteQueue *data = queue.data;
+    if (data == NULL) return;
+
+    data->count = 0;
+
+    // Shaders no longer referenced are released, current one is kept
+    if (data->shaderIndex > 0)
+    {
+        data->shaders[1] = data->shaders[data->shaderIndex];
+        data->shaderIndex = 1;
+        data->shaderCount = 2;
+    }
+    else data->shaderCount = 1;
+}
+
+// Draw queued sprites and clear queue
+// NOTE: Sprites are sorted by layer, blend mode, shader and texture, every run of sprites sharing
+// blend mode, shader and texture is drawn as a single quads batch (one draw call if batch not full)
+void RLDrawSpriteQueue(SpriteQueue queue)
+{
+    rSpriteQueue *data = queue.data;
+    if ((data == NULL) || (data->count == 0)) return;
+
+    RLSortSpriteQueue(data);
+
+    // Quads are independent, built by job workers for big queues
+    RLParallelFor(data->count, SPRITE_QUEUE_BATCH_SPRITES, RLBuildSpriteQuadsRange, data);
+
+    // Drawing state set by caller (BeginShaderMode()/BeginBlendMode()), restored after drawing
+    int previousBlendMode = rlGetBlendMode();
+    unsigned int previousShaderId = rlGetShaderIdCurrent();
+    int *previousShaderLocs = rlGetShaderLocsCurrent();
+
+    int currentBlendMode = -1;
+    int currentShader = -1;
+
+    for (int i = 0; i < data->count;)
+    {
+        unsigned long long key = data->keys[i];
+        int blendMode = (int)((key >> 40) & 0xff);
+        int shaderIndex = (int)((key >> 32) & 0xff);
+
+        if (blendMode != currentBlendMode)
+        {
+            rlSetBlendMode(blendMode);
+            currentBlendMode = blendMode;
+        }
+
+        if (shaderIndex != currentShader)
+        {
+            if (shaderIndex == 0) rlSetShader(rlGetShaderIdDefault(), rlGetShaderLocsDefault());
+            else rlSetShader(data->shaders[shaderIndex].id, data->shaders[shaderIndex].locs);
+            currentShader = shaderIndex;
+        }
+
+        // Find run of sprites sharing blend mode, shader and texture (layer does not break the run)
+        int end = i + 1;
+        while ((end < data->count) && ((data->keys[end] & 0xffffffffffffULL) == (key & 0xffffffffffffULL))) end++;
+
+        rlSetTexture((unsigned int)(key & 0xffffffff));
+        rlBegin(RL_QUADS);
+
+            rlNormal3f(0.0f, 0.0f, 1.0f);                          // Normal vector pointing towards viewer
+
+            for (int j = i; j < end; j++)
+            {
+                const rSprite *sprite = &data->sprites[data->order[j]];
+                const Vector2 *quad = &data->corners[4*j];
+
+                rlColor4ub(sprite->tint.r, sprite->tint.g, sprite->tint.b, sprite->tint.a);
+
+                // Top-left, bottom-left, bottom-right and top-right corners for texture and quad
+                rlTexCoord2f(sprite->texcoords[0], sprite->texcoords[1]); rlVertex2f(quad[0].x, quad[0].y);
+                rlTexCoord2f(sprite->texcoords[0], sprite->texcoords[3]); rlVertex2f(quad[1].x, quad[1].y);
+                rlTexCoord2f(sprite->texcoords[2], sprite->texcoords[3]); rlVertex2f(quad[2].x, quad[2].y);
+                rlTexCoord2f(sprite->texcoords[2], sprite->texcoords[1]); rlVertex2f(quad[3].x, quad[3].y);
+            }
+
+        rlEnd();
+
+        i = end;
+    }
+
+    rlSetTexture(0);
+
+    // Restore caller drawing state
+    rlSetShader(previousShaderId, previousShaderLocs);
+    rlSetBlendMode(previousBlendMode);
+
+    RLClearSpriteQueue(queue);
+}
+
 // Check if two colors are equal
 bool RLColorIsEqual(Color col1, Color col2)
 {
@@ -5545,4 +5789,898 @@ static Vector4 * RLLoadImageDataNormalized(Image image)
     return pixels;
 }
 
+// Unpack grayscale pixels to RGBA colors
+static void RLUnpackGrayscaleRow(const void *src, void *dst, int count)
+{
+    const unsigned char *input = (const unsigned char *)src;
+    Color *pixels = (Color *)dst;
+    int i = 0;
+
+#if defined(RL_FILTERING_SSE2)
+    __m128i alpha = _mm_set1_epi8((char)0xff);
+
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i gray = _mm_loadu_si128((const __m128i *)(input + i));
+        __m128i grayGray = _mm_unpacklo_epi8(gray, gray);
+        __m128i grayAlpha = _mm_unpacklo_epi8(gray, alpha);
+
+        _mm_storeu_si128((__m128i *)(pixels + i), _mm_unpacklo_epi16(grayGray, grayAlpha));
+        _mm_storeu_si128((__m128i *)(pixels + i + 4), _mm_unpackhi_epi16(grayGray, grayAlpha));
+
+        grayGray = _mm_unpackhi_epi8(gray, gray);
+        grayAlpha = _mm_unpackhi_epi8(gray, alpha);
+
+        _mm_storeu_si128((__m128i *)(pixels + i + 8), _mm_unpacklo_epi16(grayGray, grayAlpha));
+        _mm_storeu_si128((__m128i *)(pixels + i + 12), _mm_unpackhi_epi16(grayGray, grayAlpha));
+    }
+#elif defined(RL_FILTERING_NEON)
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16x4_t rgba;
+        rgba.val[0] = vld1q_u8(input + i);
+        rgba.val[1] = rgba.val[0];
+        rgba.val[2] = rgba.val[0];
+        rgba.val[3] = vdupq_n_u8(255);
+
+        vst4q_u8((unsigned char *)(pixels + i), rgba);
+    }
+#endif
+
+    for (; i < count; i++) pixels[i] = (Color){ input[i], input[i], input[i], 255 };
+}
+
+// Unpack gray+alpha pixels to RGBA colors
+static void RLUnpackGrayAlphaRow(const void *src, void *dst, int count)
+{
+    const unsigned char *input = (const unsigned char *)src;
+    Color *pixels = (Color *)dst;
+
+    for (int i = 0; i < count; i++) pixels[i] = (Color){ input[i*2], input[i*2], input[i*2], input[i*2 + 1] };
+}
+
+// Unpack R5G6B5 pixels to RGBA colors
+// NOTE: Channels are expanded as (value*255)/max, same values float conversion provides
+static void RLUnpackR5G6B5Row(const void *src, void *dst, int count)
+{
+    const unsigned short *input = (const unsigned short *)src;
+    Color *pixels = (Color *)dst;
+
+    for (int i = 0; i < count; i++)
+    {
+        unsigned short pixel = input[i];
+
+        pixels[i].r = (unsigned char)((((pixel >> 11) & 0x1f)*255)/31);
+        pixels[i].g = (unsigned char)((((pixel >> 5) & 0x3f)*255)/63);
+        pixels[i].b = (unsigned char)(((pixel & 0x1f)*255)/31);
+        pixels[i].a = 255;
+    }
+}
+
+// Unpack R8G8B8 pixels to RGBA colors
+static void RLUnpackR8G8B8Row(const void *src, void *dst, int count)
+{
+    const unsigned char *input = (const unsigned char *)src;
+    Color *pixels = (Color *)dst;
+
+    for (int i = 0; i < count; i++) pixels[i] = (Color){ input[i*3], input[i*3 + 1], input[i*3 + 2], 255 };
+}
+
+// Unpack R5G5B5A1 pixels to RGBA colors
+static void RLUnpackR5G5B5A1Row(const void *src, void *dst, int count)
+{
+    const unsigned short *input = (const unsigned short *)src;
+    Color *pixels = (Color *)dst;
+
+    for (int i = 0; i < count; i++)
+    {
+        unsigned short pixel = input[i];
+
+        pixels[i].r = (unsigned char)((((pixel >> 11) & 0x1f)*255)/31);
+        pixels[i].g = (unsigned char)((((pixel >> 6) & 0x1f)*255)/31);
+        pixels[i].b = (unsigned char)((((pixel >> 1) & 0x1f)*255)/31);
+        pixels[i].a = (pixel & 0x01)? 255 : 0;
+    }
+}
+
+// Unpack R4G4B4A4 pixels to RGBA colors
+static void RLUnpackR4G4B4A4Row(const void *src, void *dst, int count)
+{
+    const unsigned short *input = (const unsigned short *)src;
+    Color *pixels = (Color *)dst;
+
+    for (int i = 0; i < count; i++)
+    {
+        unsigned short pixel = input[i];
+
+        pixels[i].r = (unsigned char)(((pixel >> 12) & 0x0f)*17);
+        pixels[i].g = (unsigned char)(((pixel >> 8) & 0x0f)*17);
+        pixels[i].b = (unsigned char)(((pixel >> 4) & 0x0f)*17);
+        pixels[i].a = (unsigned char)((pixel & 0x0f)*17);
+    }
+}
+
+// Pack RGBA colors to grayscale pixels
+// NOTE: Luminance weights (0.299, 0.587, 0.114) are applied in 15bit fixed point, rounded to nearest
+static void RLPackGrayscaleRow(const void *src, void *dst, int count)
+{
+    const Color *pixels = (const Color *)src;
+    unsigned char *output = (unsigned char *)dst;
+    int i = 0;
+
+#if defined(RL_FILTERING_SSE2)
+    __m128i zero = _mm_setzero_si128();
+    __m128i weights = _mm_setr_epi16(9798, 19235, 3735, 0, 9798, 19235, 3735, 0);
+    __m128i half = _mm_set1_epi32(16384);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        // NOTE: All source pixels are loaded before storing, output can overlap input (in-place conversion)
+        __m128i first = _mm_loadu_si128((const __m128i *)(pixels + i));
+        __m128i second = _mm_loadu_si128((const __m128i *)(pixels + i + 4));
+        __m128i gray[2];
+
+        for (int k = 0; k < 2; k++)
+        {
+            __m128i block = (k == 0)? first : second;
+            __m128 low = _mm_castsi128_ps(_mm_madd_epi16(_mm_unpacklo_epi8(block, zero), weights));
+            __m128 high = _mm_castsi128_ps(_mm_madd_epi16(_mm_unpackhi_epi8(block, zero), weights));
+
+            // Sum red+green and blue partial products per pixel
+            __m128i sum = _mm_add_epi32(_mm_castps_si128(_mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0))),
+                                        _mm_castps_si128(_mm_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1))));
+            gray[k] = _mm_srli_epi32(_mm_add_epi32(sum, half), 15);
+        }
+
+        __m128i words = _mm_packs_epi32(gray[0], gray[1]);
+        _mm_storel_epi64((__m128i *)(output + i), _mm_packus_epi16(words, words));
+    }
+#elif defined(RL_FILTERING_NEON)
+    for (; i + 8 <= count; i += 8)
+    {
+        uint8x8x4_t rgba = vld4_u8((const unsigned char *)(pixels + i));
+        uint16x8_t r = vmovl_u8(rgba.val[0]);
+        uint16x8_t g = vmovl_u8(rgba.val[1]);
+        uint16x8_t b = vmovl_u8(rgba.val[2]);
+
+        uint32x4_t low = vmull_n_u16(vget_low_u16(r), 9798);
+        low = vmlal_n_u16(low, vget_low_u16(g), 19235);
+        low = vmlal_n_u16(low, vget_low_u16(b), 3735);
+        uint32x4_t high = vmull_n_u16(vget_high_u16(r), 9798);
+        high = vmlal_n_u16(high, vget_high_u16(g), 19235);
+        high = vmlal_n_u16(high, vget_high_u16(b), 3735);
+
+        vst1_u8(output + i, vmovn_u16(vcombine_u16(vrshrn_n_u32(low, 15), vrshrn_n_u32(high, 15))));
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        Color pixel = pixels[i];
+        output[i] = (unsigned char)((pixel.r*9798 + pixel.g*19235 + pixel.b*3735 + 16384) >> 15);
+    }
+}
+
+// Pack RGBA colors to gray+alpha pixels
+static void RLPackGrayAlphaRow(const void *src, void *dst, int count)
+{
+    const Color *pixels = (const Color *)src;
+    unsigned char *output = (unsigned char *)dst;
+
+    for (int i = 0; i < count; i++)
+    {
+        Color pixel = pixels[i];
+        output[i*2] = (unsigned char)((pixel.r*9798 + pixel.g*19235 + pixel.b*3735 + 16384) >> 15);
+        output[i*2 + 1] = pixel.a;
+    }
+}
+
+// Pack RGBA colors to R5G6B5 pixels
+static void RLPackR5G6B5Row(const void *src, void *dst, int count)
+{
+    RLPackShortRow((const Color *)src, (unsigned short *)dst, count, PIXELFORMAT_UNCOMPRESSED_R5G6B5);
+}
+
+// Pack RGBA colors to R8G8B8 pixels
+static void RLPackR8G8B8Row(const void *src, void *dst, int count)
+{
+    const Color *pixels = (const Color *)src;
+    unsigned char *output = (unsigned char *)dst;
+
+    for (int i = 0; i < count; i++)
+    {
+        Color pixel = pixels[i];
+        output[i*3] = pixel.r;
+        output[i*3 + 1] = pixel.g;
+        output[i*3 + 2] = pixel.b;
+    }
+}
+
+// Pack RGBA colors to R5G5B5A1 pixels
+static void RLPackR5G5B5A1Row(const void *src, void *dst, int count)
+{
+    RLPackShortRow((const Color *)src, (unsigned short *)dst, count, PIXELFORMAT_UNCOMPRESSED_R5G5B5A1);
+}
+
+// Pack RGBA colors to R4G4B4A4 pixels
+static void RLPackR4G4B4A4Row(const void *src, void *dst, int count)
+{
+    RLPackShortRow((const Color *)src, (unsigned short *)dst, count, PIXELFORMAT_UNCOMPRESSED_R4G4B4A4);
+}
+
+// Pack RGBA colors to 16bit pixels: R5G6B5, R5G5B5A1 or R4G4B4A4
+// NOTE: Channels are quantized as (value*max + 127)/255, rounded to nearest as float conversion does,
+// R5G5B5A1 alpha bit is set over PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD
+static void RLPackShortRow(const Color *pixels, unsigned short *output, int count, int format)
+{
+    // Channels max values (quantization) and bit shifts, alpha threshold only used for 1bit alpha
+    int max[4] = { 0 };
+    int shift[4] = { 0 };
+    int threshold = 255;
+
+    RLGetShortPixelLayout(format, max, shift);
+
+    if (format == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1)
+    {
+        max[3] = 0;
+        threshold = PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD;
+    }
+
+    int i = 0;
+
+#if defined(RL_FILTERING_SSE2)
+    // NOTE: Quantized values are computed on 16bit lanes, x/255 as (x + 1 + (x >> 8)) >> 8 (exact for x < 65535),
+    // channels are shifted in place multiplying by (1 << shift) and summed per pixel
+    __m128i zero = _mm_setzero_si128();
+    __m128i multiplier = _mm_setr_epi16((short)max[0], (short)max[1], (short)max[2], (short)max[3], (short)max[0], (short)max[1], (short)max[2], (short)max[3]);
+    __m128i weights = _mm_setr_epi16((short)(1 << shift[0]), (short)(1 << shift[1]), (short)(1 << shift[2]), (short)(1 << shift[3]),
+                                     (short)(1 << shift[0]), (short)(1 << shift[1]), (short)(1 << shift[2]), (short)(1 << shift[3]));
+    __m128i alphaBit = (threshold < 255)? _mm_setr_epi16(0, 0, 0, 1, 0, 0, 0, 1) : zero;
+    __m128i limit = _mm_set1_epi16((short)threshold);
+    __m128i rounding = _mm_set1_epi16(127);
+    __m128i one = _mm_set1_epi16(1);
+    __m128i bias = _mm_set1_epi32(32768);
+    __m128i flip = _mm_set1_epi16((short)0x8000);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        // NOTE: All source pixels are loaded before storing, output can overlap input (in-place conversion)
+        __m128i first = _mm_loadu_si128((const __m128i *)(pixels + i));
+        __m128i second = _mm_loadu_si128((const __m128i *)(pixels + i + 4));
+        __m128i packed[2];
+
+        for (int k = 0; k < 2; k++)
+        {
+            __m128i block = (k == 0)? first : second;
+            __m128i sums[2];
+
+            for (int h = 0; h < 2; h++)
+            {
+                __m128i value = (h == 0)? _mm_unpacklo_epi8(block, zero) : _mm_unpackhi_epi8(block, zero);
+                __m128i x = _mm_add_epi16(_mm_mullo_epi16(value, multiplier), rounding);
+                __m128i quantized = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(x, one), _mm_srli_epi16(x, 8)), 8);
+
+                quantized = _mm_or_si128(quantized, _mm_and_si128(_mm_cmpgt_epi16(value, limit), alphaBit));
+                sums[h] = _mm_madd_epi16(quantized, weights);
+            }
+
+            __m128 low = _mm_castsi128_ps(sums[0]);
+            __m128 high = _mm_castsi128_ps(sums[1]);
+            packed[k] = _mm_add_epi32(_mm_castps_si128(_mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0))),
+                                      _mm_castps_si128(_mm_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1))));
+        }
+
+        // Pack to unsigned 16 bit (using signed saturation with a bias)
+        __m128i words = _mm_packs_epi32(_mm_sub_epi32(packed[0], bias), _mm_sub_epi32(packed[1], bias));
+        _mm_storeu_si128((__m128i *)(output + i), _mm_xor_si128(words, flip));
+    }
+#elif defined(RL_FILTERING_NEON)
+    int16x8_t shiftRed = vdupq_n_s16((short)shift[0]);
+    int16x8_t shiftGreen = vdupq_n_s16((short)shift[1]);
+    int16x8_t shiftBlue = vdupq_n_s16((short)shift[2]);
+    int16x8_t shiftAlpha = vdupq_n_s16((short)shift[3]);
+    uint16x8_t rounding = vdupq_n_u16(127);
+    uint16x8_t one = vdupq_n_u16(1);
+    uint16x8_t limit = vdupq_n_u16((unsigned short)threshold);
+    uint16x8_t alphaBit = vdupq_n_u16((threshold < 255)? 1 : 0);
+
+    for (; i + 8 <= count; i += 8)
+    {
+        uint8x8x4_t rgba = vld4_u8((const unsigned char *)(pixels + i));
+        uint16x8_t quantized[4];
+
+        for (int c = 0; c < 4; c++)
+        {
+            uint16x8_t x = vmlaq_n_u16(rounding, vmovl_u8(rgba.val[c]), (unsigned short)max[c]);
+            quantized[c] = vshrq_n_u16(vaddq_u16(vaddq_u16(x, one), vshrq_n_u16(x, 8)), 8);
+        }
+
+        quantized[3] = vorrq_u16(quantized[3], vandq_u16(vcgtq_u16(vmovl_u8(rgba.val[3]), limit), alphaBit));
+
+        uint16x8_t result = vshlq_u16(quantized[0], shiftRed);
+        result = vorrq_u16(result, vshlq_u16(quantized[1], shiftGreen));
+        result = vorrq_u16(result, vshlq_u16(quantized[2], shiftBlue));
+        result = vorrq_u16(result, vshlq_u16(quantized[3], shiftAlpha));
+
+        vst1q_u16(output + i, result);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        Color pixel = pixels[i];
+        unsigned short value = (unsigned short)((((pixel.r*max[0] + 127)/255) << shift[0]) | (((pixel.g*max[1] + 127)/255) << shift[1]) |
+                                                (((pixel.b*max[2] + 127)/255) << shift[2]) | (((pixel.a*max[3] + 127)/255) << shift[3]));
+
+        if ((threshold < 255) && (pixel.a > threshold)) value |= 0x01;
+
+        output[i] = value;
+    }
+}
+
+// Convert between 16bit pixel formats: R5G6B5, R5G5B5A1 and R4G4B4A4
+// NOTE: Channels are requantized directly as round(value*dstMax/srcMax), no 8bit intermediate rounding
+static void RLConvertShortRow(const unsigned short *input, unsigned short *output, int count, int srcFormat, int dstFormat)
+{
+    int srcMax[4] = { 0 };
+    int srcShift[4] = { 0 };
+    int dstMax[4] = { 0 };
+    int dstShift[4] = { 0 };
+
+    RLGetShortPixelLayout(srcFormat, srcMax, srcShift);
+    RLGetShortPixelLayout(dstFormat, dstMax, dstShift);
+
+    for (int i = 0; i < count; i++)
+    {
+        unsigned short pixel = input[i];
+        unsigned short value = 0;
+
+        for (int c = 0; c < 4; c++)
+        {
+            // NOTE: Formats with no alpha channel are considered opaque
+            int channel = (srcMax[c] > 0)? ((pixel >> srcShift[c]) & srcMax[c]) : 1;
+            int range = (srcMax[c] > 0)? srcMax[c] : 1;
+
+            if ((c == 3) && (dstFormat == PIXELFORMAT_UNCOMPRESSED_R5G5B5A1))
+            {
+                if (channel*255 > PIXELFORMAT_UNCOMPRESSED_R5G5B5A1_ALPHA_THRESHOLD*range) value |= 0x01;
+            }
+            else value |= (unsigned short)(((channel*dstMax[c]*2 + range)/(range*2)) << dstShift[c]);
+        }
+
+        output[i] = value;
+    }
+}
+
+// Get 16bit pixel format channels max values and bit shifts (RGBA order, max is 0 if channel not available)
+static void RLGetShortPixelLayout(int format, int *max, int *shift)
+{
+    switch (format)
+    {
+        case PIXELFORMAT_UNCOMPRESSED_R5G6B5:
+        {
+            max[0] = 31; max[1] = 63; max[2] = 31; max[3] = 0;
+            shift[0] = 11; shift[1] = 5; shift[2] = 0; shift[3] = 0;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R5G5B5A1:
+        {
+            max[0] = 31; max[1] = 31; max[2] = 31; max[3] = 1;
+            shift[0] = 11; shift[1] = 6; shift[2] = 1; shift[3] = 0;
+        } break;
+        case PIXELFORMAT_UNCOMPRESSED_R4G4B4A4:
+        {
+            max[0] = 15; max[1] = 15; max[2] = 15; max[3] = 15;
+            shift[0] = 12; shift[1] = 8; shift[2] = 4; shift[3] = 0;
+        } break;
+        default: break;
+    }
+}
+
+#if defined(SUPPORT_IMAGE_MANIPULATION)
+// Box blur a line of interleaved 8.8 fixed-point values, window is clamped to line bounds
+// NOTE: Used for horizontal passes (4 lanes per pixel) and vertical passes (4 lanes per strip column)
+static void RLBoxBlurLine(const unsigned short *src, unsigned short *dst, int count, int lanes, int radius)
+{
+    if (radius > count) radius = count;
+
+#if defined(RL_FILTERING_SSE2) || defined(RL_FILTERING_NEON)
+    // NOTE: SIMD path keeps window sums as signed 32 bit, valid for lines up to 32768 values
+    if (count <= 32768)
+    {
+        int groups = lanes/4;
+    #if defined(RL_FILTERING_SSE2)
+        __m128i sums[IMAGE_FILTER_STRIP_COLUMNS];
+        __m128i zero = _mm_setzero_si128();
+        __m128i bias = _mm_set1_epi32(32768);
+        __m128i flip = _mm_set1_epi16((short)0x8000);
+
+        for (int g = 0; g < groups; g++) sums[g] = zero;
+
+        for (int i = 0; (i <= radius) && (i < count); i++)
+        {
+            for (int g = 0; g < groups; g++) sums[g] = _mm_add_epi32(sums[g], _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)(src + i*lanes + g*4)), zero));
+        }
+    #else
+        uint32x4_t sums[IMAGE_FILTER_STRIP_COLUMNS];
+
+        for (int g = 0; g < groups; g++) sums[g] = vdupq_n_u32(0);
+
+        for (int i = 0; (i <= radius) && (i < count); i++)
+        {
+            for (int g = 0; g < groups; g++) sums[g] = vaddw_u16(sums[g], vld1_u16(src + i*lanes + g*4));
+        }
+    #endif
+
+        for (int i = 0; i < count; i++)
+        {
+            int first = (i - radius > 0)? i - radius : 0;
+            int last = (i + radius < count - 1)? i + radius : count - 1;
+            float scale = 1.0f/(float)(last - first + 1);
+            const unsigned short *leaving = (i - radius >= 0)? src + (i - radius)*lanes : NULL;
+            const unsigned short *entering = (i + radius + 1 < count)? src + (i + radius + 1)*lanes : NULL;
+            unsigned short *output = dst + i*lanes;
+
+    #if defined(RL_FILTERING_SSE2)
+            __m128 factor = _mm_set1_ps(scale);
+
+            for (int g = 0; g < groups; g++)
+            {
+                // Round to nearest and pack to unsigned 16 bit (using signed saturation with a bias)
+                __m128i value = _mm_sub_epi32(_mm_cvtps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(sums[g]), factor)), bias);
+                _mm_storel_epi64((__m128i *)(output + g*4), _mm_xor_si128(_mm_packs_epi32(value, value), flip));
+
+                if (leaving != NULL) sums[g] = _mm_sub_epi32(sums[g], _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)(leaving + g*4)), zero));
+                if (entering != NULL) sums[g] = _mm_add_epi32(sums[g], _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)(entering + g*4)), zero));
+            }
+    #else
+            for (int g = 0; g < groups; g++)
+            {
+                vst1_u16(output + g*4, vqmovn_u32(vcvtnq_u32_f32(vmulq_n_f32(vcvtq_f32_u32(sums[g]), scale))));
+
+                if (leaving != NULL) sums[g] = vsubw_u16(sums[g], vld1_u16(leaving + g*4));
+                if (entering != NULL) sums[g] = vaddw_u16(sums[g], vld1_u16(entering + g*4));
+            }
+    #endif
+        }
+
+        return;
+    }
+#endif
+
+    unsigned int sums[4*IMAGE_FILTER_STRIP_COLUMNS] = { 0 };
+    float scale = 0.0f;
+    int prevSize = 0;
+
+    for (int i = 0; (i <= radius) && (i < count); i++)
+    {
+        for (int l = 0; l < lanes; l++) sums[l] += src[i*lanes + l];
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        int first = (i - radius > 0)? i - radius : 0;
+        int last = (i + radius < count - 1)? i + radius : count - 1;
+        int size = last - first + 1;
+
+        // Window size reciprocal only changes near line bounds
+        if (size != prevSize)
+        {
+            scale = 1.0f/(float)size;
+            prevSize = size;
+        }
+
+        for (int l = 0; l < lanes; l++) dst[i*lanes + l] = (unsigned short)((float)sums[l]*scale + 0.5f);
+
+        if (i - radius >= 0)
+        {
+            for (int l = 0; l < lanes; l++) sums[l] -= src[(i - radius)*lanes + l];
+        }
+
+        if (i + radius + 1 < count)
+        {
+            for (int l = 0; l < lanes; l++) sums[l] += src[(i + radius + 1)*lanes + l];
+        }
+    }
+}
+
+// Blur image rows range, horizontal passes
+// NOTE: Pixels are premultiplied and kept premultiplied (rounded to 8 bit) for vertical passes
+static void RLBlurRowsRange(void *userData, int start, int end, int worker)
+{
+    ImageFilterJob *job = (ImageFilterJob *)userData;
+    int lineSize = job->width*4;
+    unsigned short *buffer = (unsigned short *)RL_MALLOC(2*lineSize*sizeof(unsigned short));
+
+    for (int y = start; y < end; y++)
+    {
+        unsigned char *row = (unsigned char *)(job->pixels + y*job->width);
+        unsigned short *src = buffer;
+        unsigned short *dst = buffer + lineSize;
+
+        // Premultiply alpha and convert to 8.8 fixed-point
+        for (int k = 0; k < lineSize; k += 4)
+        {
+            unsigned int alpha = row[k + 3];
+
+            src[k] = (unsigned short)((row[k]*alpha/255) << 8);
+            src[k + 1] = (unsigned short)((row[k + 1]*alpha/255) << 8);
+            src[k + 2] = (unsigned short)((row[k + 2]*alpha/255) << 8);
+            src[k + 3] = (unsigned short)(alpha << 8);
+        }
+
+        for (int i = 0; i < GAUSSIAN_BLUR_ITERATIONS; i++)
+        {
+            RLBoxBlurLine(src, dst, job->width, 4, job->radius);
+
+            unsigned short *temp = src;
+            src = dst;
+            dst = temp;
+        }
+
+        for (int k = 0; k < lineSize; k++) row[k] = (unsigned char)((src[k] + 128) >> 8);
+    }
+
+    RL_FREE(buffer);
+}
+
+// Blur image column strips range, vertical passes
+// NOTE: Strips of IMAGE_FILTER_STRIP_COLUMNS columns are gathered and blurred together to avoid
+// walking the image column by column, alpha premultiply is reversed on storing
+static void RLBlurColumnsRange(void *userData, int start, int end, int worker)
+{
+    ImageFilterJob *job = (ImageFilterJob *)userData;
+    int stripSize = job->height*4*IMAGE_FILTER_STRIP_COLUMNS;
+    unsigned short *buffer = (unsigned short *)RL_MALLOC(2*stripSize*sizeof(unsigned short));
+
+    for (int strip = start; strip < end; strip++)
+    {
+        int x0 = strip*IMAGE_FILTER_STRIP_COLUMNS;
+        int columns = (job->width - x0 < IMAGE_FILTER_STRIP_COLUMNS)? job->width - x0 : IMAGE_FILTER_STRIP_COLUMNS;
+        int lanes = columns*4;
+        unsigned short *src = buffer;
+        unsigned short *dst = buffer + stripSize;
+
+        for (int y = 0; y < job->height; y++)
+        {
+            const unsigned char *row = (const unsigned char *)(job->pixels + y*job->width + x0);
+
+            for (int l = 0; l < lanes; l++) src[y*lanes + l] = (unsigned short)(row[l] << 8);
+        }
+
+        for (int i = 0; i < GAUSSIAN_BLUR_ITERATIONS; i++)
+        {
+            RLBoxBlurLine(src, dst, job->height, lanes, job->radius);
+
+            unsigned short *temp = src;
+            src = dst;
+            dst = temp;
+        }
+
+        // Reverse premultiply
+        for (int y = 0; y < job->height; y++)
+        {
+            Color *row = job->pixels + y*job->width + x0;
+            const unsigned short *value = src + y*lanes;
+
+            for (int x = 0; x < columns; x++, value += 4)
+            {
+                if ((value[3] >> 8) == 0) row[x] = (Color){ 0, 0, 0, 0 };
+                else
+                {
+                    float scale = 255.0f/(float)value[3];
+                    float r = (float)value[0]*scale + 0.5f;
+                    float g = (float)value[1]*scale + 0.5f;
+                    float b = (float)value[2]*scale + 0.5f;
+
+                    row[x].r = (r < 255.0f)? (unsigned char)r : 255;
+                    row[x].g = (g < 255.0f)? (unsigned char)g : 255;
+                    row[x].b = (b < 255.0f)? (unsigned char)b : 255;
+                    row[x].a = (unsigned char)(value[3] >> 8);
+                }
+            }
+        }
+    }
+
+    RL_FREE(buffer);
+}
+
+// Load pixels row as floats (4 per pixel), adding zero padding on both sides
+static void RLLoadFilterRow(const Color *pixels, int width, int padLeft, int padRight, float *row)
+{
+    memset(row, 0, padLeft*4*sizeof(float));
+
+    for (int x = 0; x < width; x++)
+    {
+        float *value = row + (padLeft + x)*4;
+
+        value[0] = (float)pixels[x].r;
+        value[1] = (float)pixels[x].g;
+        value[2] = (float)pixels[x].b;
+        value[3] = (float)pixels[x].a;
+    }
+
+    memset(row + (padLeft + width)*4, 0, padRight*4*sizeof(float));
+}
+
+// Convolve padded row with 1D weights, accumulating the result into output row (4 floats per pixel)
+static void RLConvolveFilterRow(const float *row, int width, const float *weights, int count, float *output)
+{
+    int x = 0;
+
+#if defined(RL_FILTERING_SSE2)
+    // Two pixels per iteration, sharing weights broadcast
+    for (; x + 1 < width; x += 2)
+    {
+        __m128 sum0 = _mm_loadu_ps(output + x*4);
+        __m128 sum1 = _mm_loadu_ps(output + x*4 + 4);
+
+        for (int k = 0; k < count; k++)
+        {
+            __m128 weight = _mm_set1_ps(weights[k]);
+            sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(row + (x + k)*4), weight));
+            sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(row + (x + k)*4 + 4), weight));
+        }
+
+        _mm_storeu_ps(output + x*4, sum0);
+        _mm_storeu_ps(output + x*4 + 4, sum1);
+    }
+#elif defined(RL_FILTERING_NEON)
+    for (; x + 1 < width; x += 2)
+    {
+        float32x4_t sum0 = vld1q_f32(output + x*4);
+        float32x4_t sum1 = vld1q_f32(output + x*4 + 4);
+
+        for (int k = 0; k < count; k++)
+        {
+            sum0 = vmlaq_n_f32(sum0, vld1q_f32(row + (x + k)*4), weights[k]);
+            sum1 = vmlaq_n_f32(sum1, vld1q_f32(row + (x + k)*4 + 4), weights[k]);
+        }
+
+        vst1q_f32(output + x*4, sum0);
+        vst1q_f32(output + x*4 + 4, sum1);
+    }
+#endif
+
+    for (; x < width; x++)
+    {
+        float *sum = output + x*4;
+
+        for (int k = 0; k < count; k++)
+        {
+            const float *value = row + (x + k)*4;
+
+            sum[0] += value[0]*weights[k];
+            sum[1] += value[1]*weights[k];
+            sum[2] += value[2]*weights[k];
+            sum[3] += value[3]*weights[k];
+        }
+    }
+}
+
+// Accumulate weighted row into output row
+static void RLAccumulateFilterRow(const float *row, int size, float weight, float *output)
+{
+    int k = 0;
+
+#if defined(RL_FILTERING_SSE2)
+    __m128 weights = _mm_set1_ps(weight);
+    for (; k + 4 <= size; k += 4) _mm_storeu_ps(output + k, _mm_add_ps(_mm_loadu_ps(output + k), _mm_mul_ps(_mm_loadu_ps(row + k), weights)));
+#elif defined(RL_FILTERING_NEON)
+    for (; k + 4 <= size; k += 4) vst1q_f32(output + k, vmlaq_n_f32(vld1q_f32(output + k), vld1q_f32(row + k), weight));
+#endif
+
+    for (; k < size; k++) output[k] += row[k]*weight;
+}
+
+// Store filtered row as pixels, values are clamped to [0..255]
+static void RLStoreFilterRow(const float *row, int width, Color *pixels)
+{
+    int x = 0;
+
+#if defined(RL_FILTERING_SSE2)
+    __m128 zero = _mm_setzero_ps();
+    __m128 max = _mm_set1_ps(255.0f);
+
+    for (; x < width; x++)
+    {
+        __m128i value = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(row + x*4), zero), max));
+        value = _mm_packs_epi32(value, value);
+        value = _mm_packus_epi16(value, value);
+
+        int packed = _mm_cvtsi128_si32(value);
+        memcpy(pixels + x, &packed, sizeof(Color));
+    }
+#endif
+
+    for (; x < width; x++)
+    {
+        const float *value = row + x*4;
+
+        pixels[x].r = (unsigned char)((value[0] < 0.0f)? 0.0f : ((value[0] > 255.0f)? 255.0f : value[0]));
+        pixels[x].g = (unsigned char)((value[1] < 0.0f)? 0.0f : ((value[1] > 255.0f)? 255.0f : value[1]));
+        pixels[x].b = (unsigned char)((value[2] < 0.0f)? 0.0f : ((value[2] > 255.0f)? 255.0f : value[2]));
+        pixels[x].a = (unsigned char)((value[3] < 0.0f)? 0.0f : ((value[3] > 255.0f)? 255.0f : value[3]));
+    }
+}
+
+// Convolve image rows range
+// NOTE: Rows are processed in bands of IMAGE_FILTER_BATCH_ROWS, keeping in a scratch buffer the band
+// source rows (2D kernel) or horizontally filtered rows (separable kernel), including kernel borders
+static void RLConvolveRowsRange(void *userData, int start, int end, int worker)
+{
+    ImageFilterJob *job = (ImageFilterJob *)userData;
+    int width = job->width;
+    int kernelWidth = job->kernelWidth;
+    int padLeft = kernelWidth/2;
+    int padRight = kernelWidth - 1 - padLeft;
+    int paddedSize = (width + kernelWidth - 1)*4;
+    int bandStride = (job->kernel == NULL)? width*4 : paddedSize;
+
+    float *band = (float *)RL_MALLOC((IMAGE_FILTER_BATCH_ROWS + kernelWidth - 1)*bandStride*sizeof(float));
+    float *line = (float *)RL_MALLOC((paddedSize + width*4)*sizeof(float));
+    float *result = line + paddedSize;
+
+    for (int y0 = start; y0 < end; y0 += IMAGE_FILTER_BATCH_ROWS)
+    {
+        int rows = (end - y0 < IMAGE_FILTER_BATCH_ROWS)? end - y0 : IMAGE_FILTER_BATCH_ROWS;
+
+        for (int i = 0; i < rows + kernelWidth - 1; i++)
+        {
+            int y = y0 + i - padLeft;
+            float *bandRow = band + i*bandStride;
+
+            if ((y < 0) || (y >= job->height)) memset(bandRow, 0, bandStride*sizeof(float));
+            else if (job->kernel != NULL) RLLoadFilterRow(job->pixels + y*width, width, padLeft, padRight, bandRow);
+            else
+            {
+                RLLoadFilterRow(job->pixels + y*width, width, padLeft, padRight, line);
+                memset(bandRow, 0, bandStride*sizeof(float));
+                RLConvolveFilterRow(line, width, job->rowWeights, kernelWidth, bandRow);
+            }
+        }
+
+        for (int r = 0; r < rows; r++)
+        {
+            memset(result, 0, width*4*sizeof(float));
+
+            for (int i = 0; i < kernelWidth; i++)
+            {
+                if (job->kernel != NULL) RLConvolveFilterRow(band + (r + i)*bandStride, width, job->kernel + i*kernelWidth, kernelWidth, result);
+                else if (job->colWeights[i] != 0.0f) RLAccumulateFilterRow(band + (r + i)*bandStride, width*4, job->colWeights[i], result);
+            }
+
+            RLStoreFilterRow(result, width, job->output + (y0 + r)*width);
+        }
+    }
+
+    RL_FREE(band);
+    RL_FREE(line);
+}
+#endif      // SUPPORT_IMAGE_MANIPULATION
+
+// Resize sprite queue buffers, queued sprites are kept
+static bool RLResizeSpriteQueue(rSpriteQueue *data, int capacity)
+{
+    rSprite *sprites = (rSprite *)RL_REALLOC(data->sprites, capacity*sizeof(rSprite));
+    if (sprites != NULL) data->sprites = sprites;
+    unsigned long long *keys = (unsigned long long *)RL_REALLOC(data->keys, capacity*sizeof(unsigned long long));
+    if (keys != NULL) data->keys = keys;
+    unsigned int *order = (unsigned int *)RL_REALLOC(data->order, capacity*sizeof(unsigned int));
+    if (order != NULL) data->order = order;
+    unsigned long long *sortKeys = (unsigned long long *)RL_REALLOC(data->sortKeys, capacity*sizeof(unsigned long long));
+    if (sortKeys != NULL) data->sortKeys = sortKeys;
+    unsigned int *sortOrder = (unsigned int *)RL_REALLOC(data->sortOrder, capacity*sizeof(unsigned int));
+    if (sortOrder != NULL) data->sortOrder = sortOrder;
+    Vector2 *corners = (Vector2 *)RL_REALLOC(data->corners, 4*capacity*sizeof(Vector2));
+    if (corners != NULL) data->corners = corners;
+
+    // NOTE: On failure, successfully resized buffers are kept (still valid for current capacity)
+    if ((sprites == NULL) || (keys == NULL) || (order == NULL) || (sortKeys == NULL) || (sortOrder == NULL) || (corners == NULL)) return false;
+
+    data->capacity = capacity;
+
+    return true;
+}
+
+// Sort sprites by key, stable LSD radix sort (8 bits per pass)
+// NOTE: Passes where all keys share the same byte are skipped, usually only
+// layer, blend/shader and texture id low bytes require sorting
+static void RLSortSpriteQueue(rSpriteQueue *data)
+{
+    unsigned int histogram[8][256] = { 0 };
+    bool sorted = true;
+
+    for (int i = 0; i < data->count; i++)
+    {
+        unsigned long long key = data->keys[i];
+
+        for (int b = 0; b < 8; b++) histogram[b][(key >> (8*b)) & 0xff]++;
+        if ((i > 0) && (data->keys[i - 1] > key)) sorted = false;
+
+        data->order[i] = i;
+    }
+
+    if (sorted) return;
+
+    for (int b = 0; b < 8; b++)
+    {
+        unsigned int *counts = histogram[b];
+        int shift = 8*b;
+
+        if (counts[(data->keys[0] >> shift) & 0xff] == (unsigned int)data->count) continue;
+
+        // Counts to offsets
+        unsigned int offset = 0;
+        for (int k = 0; k < 256; k++)
+        {
+            unsigned int count = counts[k];
+            counts[k] = offset;
+            offset += count;
+        }
+
+        for (int i = 0; i < data->count; i++)
+        {
+            unsigned long long key = data->keys[i];
+            unsigned int position = counts[(key >> shift) & 0xff]++;
+
+            data->sortKeys[position] = key;
+            data->sortOrder[position] = data->order[i];
+        }
+
+        // Swap buffers, sorted data is now on keys/order
+        unsigned long long *keys = data->keys;
+        data->keys = data->sortKeys;
+        data->sortKeys = keys;
+
+        unsigned int *order = data->order;
+        data->order = data->sortOrder;
+        data->sortOrder = order;
+    }
+}
+
+// Build sorted sprites quads range, same quad corners as DrawTexturePro()
+static void RLBuildSpriteQuadsRange(void *userData, int start, int end, int worker)
+{
+    rSpriteQueue *data = (rSpriteQueue *)userData;
+
+    for (int i = start; i < end; i++)
+    {
+        const rSprite *sprite = &data->sprites[data->order[i]];
+        Vector2 *quad = &data->corners[4*i];
+
+        Rectangle dest = sprite->dest;
+        Vector2 origin = sprite->origin;
+
+        // Corners: top-left, bottom-left, bottom-right, top-right
+        if (sprite->rotation == 0.0f)
+        {
+            float x = dest.x - origin.x;
+            float y = dest.y - origin.y;
+            quad[0] = (Vector2){ x, y };
+            quad[1] = (Vector2){ x, y + dest.height };
+            quad[2] = (Vector2){ x + dest.width, y + dest.height };
+            quad[3] = (Vector2){ x + dest.width, y };
+        }
+        else
+        {
+            float sinRotation = sinf(sprite->rotation*DEG2RAD);
+            float cosRotation = cosf(sprite->rotation*DEG2RAD);
+            float dx = -origin.x;
+            float dy = -origin.y;
+
+            quad[0].x = dest.x + dx*cosRotation - dy*sinRotation;
+            quad[0].y = dest.y + dx*sinRotation + dy*cosRotation;
+
+            quad[1].x = dest.x + dx*cosRotation - (dy + dest.height)*sinRotation;
+            quad[1].y = dest.y + dx*sinRotation + (dy + dest.height)*cosRotation;
+
+            quad[2].x = dest.x + (dx + dest.width)*cosRotation - (dy + dest.height)*sinRotation;
+            quad[2].y = dest.y + (dx + dest.width)*sinRotation + (dy + dest.height)*cosRotation;
+
+            quad[3].x = dest.x + (dx + dest.width)*cosRotation - dy*sinRotation;
+            quad[3].y = dest.y + (dx + dest.width)*sinRotation + dy*cosRotation;
+        }
+    }
+}
+
 #endif      // SUPPORT_MODULE_RTEXTURES
@@ -7,6 +7,15 @@
 *           Show TraceLog() output messages
 *           NOTE: By default LOG_DEBUG traces not shown
 *
+*       #define SUPPORT_THREADED_JOBS
+*           Use a pool of worker threads for data-parallel jobs: RLParallelFor()
+*           NOTE: If not defined, jobs are processed serially on the calling thread
+*           Background jobs (RLRunBackgroundJob()) are processed in order on a dedicated thread
+*
+*       #define SUPPORT_FILE_MAPPING
+*           Map files read-only in memory for assets loading: RLLoadMappedFile()
+*           NOTE: If not defined or not available on platform (Android, Web), file data is loaded with RLLoadFileData()
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -49,12 +58,177 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+#if defined(SUPPORT_THREADED_JOBS)
+#if defined(_WIN32)
+// NOTE: Avoid windows.h inclusion (symbols conflict), SRWLOCK and CONDITION_VARIABLE are pointer-sized structures
+typedef struct { void *ptr; } RLWinSyncObject;
+__declspec(dllimport) void *__stdcall CreateThread(void *attributes, size_t stackSize, unsigned long (__stdcall *start)(void *), void *param, unsigned long flags, unsigned long *threadId);
+__declspec(dllimport) unsigned long __stdcall WaitForSingleObject(void *handle, unsigned long milliseconds);
+__declspec(dllimport) int __stdcall CloseHandle(void *handle);
+__declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(unsigned short groupNumber);
+__declspec(dllimport) void __stdcall AcquireSRWLockExclusive(RLWinSyncObject *lock);
+__declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(RLWinSyncObject *lock);
+__declspec(dllimport) int __stdcall SleepConditionVariableSRW(RLWinSyncObject *cond, RLWinSyncObject *lock, unsigned long milliseconds, unsigned long flags);
+__declspec(dllimport) void __stdcall WakeAllConditionVariable(RLWinSyncObject *cond);
+#else
+    #include <pthread.h>                // Required for: pthread_create(), pthread_join(), pthread_mutex_*(), pthread_cond_*()
+    #include <unistd.h>                 // Required for: sysconf()
+#endif
+#endif
+
+#if defined(SUPPORT_FILE_MAPPING) && !defined(PLATFORM_ANDROID) && !defined(__EMSCRIPTEN__)
+#if defined(_WIN32)
+    #define FILE_MAPPING_AVAILABLE
+// NOTE: Avoid windows.h inclusion (symbols conflict), LARGE_INTEGER is passed as a 64bit integer
+__declspec(dllimport) void *__stdcall CreateFileA(const char *fileName, unsigned long access, unsigned long shareMode, void *security, unsigned long creation, unsigned long flags, void *templateFile);
+__declspec(dllimport) int __stdcall GetFileSizeEx(void *file, long long *size);
+__declspec(dllimport) void *__stdcall CreateFileMappingA(void *file, void *attributes, unsigned long protect, unsigned long maxSizeHigh, unsigned long maxSizeLow, const char *name);
+__declspec(dllimport) void *__stdcall MapViewOfFile(void *mapping, unsigned long access, unsigned long offsetHigh, unsigned long offsetLow, size_t size);
+__declspec(dllimport) int __stdcall UnmapViewOfFile(const void *address);
+__declspec(dllimport) int __stdcall CloseHandle(void *handle);
+#elif defined(__unix__) || defined(__APPLE__)
+    #define FILE_MAPPING_AVAILABLE
+    #include <sys/mman.h>               // Required for: mmap(), munmap()
+    #include <sys/stat.h>               // Required for: fstat()
+    #include <fcntl.h>                  // Required for: open()
+    #include <unistd.h>                 // Required for: close()
+#endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
 #ifndef MAX_TRACELOG_MSG_LENGTH
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
+#ifndef MAX_JOB_WORKER_THREADS
+    #define MAX_JOB_WORKER_THREADS        8         // Max number of worker threads for parallel jobs
+#endif
+#ifndef MAX_BACKGROUND_JOBS
+    #define MAX_BACKGROUND_JOBS          64         // Max number of background jobs queued at once
+#endif
+#ifndef MAX_MOUNTED_ASSET_PACKS
+    #define MAX_MOUNTED_ASSET_PACKS       8         // Max number of asset packs mounted at once
+#endif
+#ifndef ASSET_PACK_DATA_ALIGNMENT
+    #define ASSET_PACK_DATA_ALIGNMENT    64         // Asset pack files data alignment on export (bytes, power of two)
+#endif
+
+#define ASSET_PACK_VERSION                1         // Asset pack format version
+#define ASSET_PACK_COMPRESSED          0x01         // Asset pack entry flag: file data compressed (DEFLATE)
+
+#if defined(SUPPORT_THREADED_JOBS)
+#if defined(_WIN32)
+    #define JOB_MUTEX_INITIALIZER       { 0 }
+    #define JOB_COND_INITIALIZER        { 0 }
+    #define JobMutexLock(m)             AcquireSRWLockExclusive(m)
+    #define JobMutexUnlock(m)           ReleaseSRWLockExclusive(m)
+    #define JobCondWait(c, m)           SleepConditionVariableSRW(c, m, 0xFFFFFFFF, 0)
+    #define JobCondBroadcast(c)         WakeAllConditionVariable(c)
+#else
+    #define JOB_MUTEX_INITIALIZER       PTHREAD_MUTEX_INITIALIZER
+    #define JOB_COND_INITIALIZER        PTHREAD_COND_INITIALIZER
+    #define JobMutexLock(m)             pthread_mutex_lock(m)
+    #define JobMutexUnlock(m)           pthread_mutex_unlock(m)
+    #define JobCondWait(c, m)           pthread_cond_wait(c, m)
+    #define JobCondBroadcast(c)         pthread_cond_broadcast(c)
+#endif
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+#if defined(SUPPORT_THREADED_JOBS)
+#if defined(_WIN32)
+typedef RLWinSyncObject JobMutex;
+typedef RLWinSyncObject JobCond;
+typedef void *JobThread;
+#else
+typedef pthread_mutex_t JobMutex;
+typedef pthread_cond_t JobCond;
+typedef pthread_t JobThread;
+#endif
+
+// Worker threads pool, all fields protected by lock
+// NOTE: Only one job runs at a time, concurrent or nested RLParallelFor() calls run serially
+typedef struct JobPool {
+    JobMutex lock;                      // Pool state lock
+    JobCond wake;                       // Signaled when a new job is available (or on shutdown)
+    JobCond done;                       // Signaled when last worker leaves current job
+    bool initialized;                   // Worker threads have been created
+    bool shutdown;                      // Worker threads must exit
+    bool busy;                          // A job is currently being processed
+    int threadCount;                    // Number of worker threads (caller thread not included)
+    JobThread threads[MAX_JOB_WORKER_THREADS];
+    unsigned int generation;            // Job counter, workers use it to detect new jobs
+    unsigned int startGeneration;       // Job counter value when worker threads were created
+
+    JobRangeCallback callback;          // Current job callback
+    void *userData;                     // Current job user data
+    int count;                          // Current job items count
+    int batchSize;                      // Current job items per batch
+    int next;                           // Next item to be claimed
+    int pending;                        // Worker threads still attached to current job
+} JobPool;
+
+// Background job
+typedef struct BackgroundJob {
+    JobCallback callback;               // Job callback
+    void *userData;                     // Job user data
+} BackgroundJob;
+
+// Background jobs queue, processed in submission order by a single thread, all fields protected by lock
+typedef struct BackgroundJobQueue {
+    JobMutex lock;                      // Queue state lock
+    JobCond wake;                       // Signaled when a job is queued (or on shutdown)
+    JobCond done;                       // Signaled when queue gets empty
+    bool initialized;                   // Background thread has been created
+    bool shutdown;                      // Background thread must exit once queue is empty
+    bool running;                       // A job is currently being processed
+    JobCallback runningCallback;        // Callback of job currently being processed
+    JobThread thread;                   // Background thread
+    BackgroundJob jobs[MAX_BACKGROUND_JOBS]; // Jobs ring buffer
+    int head;                           // Next job to be processed
+    int count;                          // Jobs queued (not including running job)
+} BackgroundJobQueue;
+#endif
+
+// Asset pack file header, all values are little-endian
+// NOTE: Pack layout: [header][files data (aligned)][index: buckets, entries, names]
+typedef struct AssetPackHeader {
+    char id[4];                         // Pack identifier: "rPAK"
+    unsigned int version;               // Pack format version
+    unsigned int entryCount;            // Files count
+    unsigned int bucketBits;            // Index buckets count (power of two exponent)
+    unsigned long long indexOffset;     // Index offset on pack (8 bytes aligned)
+    unsigned long long namesSize;       // Index names block size
+} AssetPackHeader;
+
+// Asset pack index entry, entries are sorted by hash
+typedef struct AssetPackEntry {
+    unsigned long long hash;            // File name hash (FNV-1a)
+    unsigned long long offset;          // File data offset on pack
+    unsigned long long size;            // File data size on pack (compressed size if compressed)
+    unsigned long long fileSize;        // File data size (uncompressed)
+    unsigned int nameOffset;            // File name offset on names block ('\0' terminated)
+    unsigned int flags;                 // Entry flags: ASSET_PACK_COMPRESSED
+} AssetPackEntry;
+
+// Asset pack data
+// NOTE: Index bucket i holds entries range [buckets[i], buckets[i + 1]) with hash top bits equal to i,
+// there are at least as many buckets as entries, so a lookup checks about one entry
+struct rAssetPack {
+    unsigned char *fileData;            // Pack file data (mapped copy-on-write or loaded)
+    long long fileSize;                 // Pack file size in bytes
+    bool mapped;                        // Pack file data is mapped by the system
+    bool mounted;                       // Pack is mounted
+
+    const unsigned int *buckets;        // Index buckets, first entry of every bucket (bucketCount + 1)
+    const AssetPackEntry *entries;      // Index entries
+    const char *names;                  // Index names block
+    unsigned int entryCount;            // Index entries count
+    unsigned int bucketBits;            // Index buckets count (power of two exponent)
+};
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -76,6 +250,14 @@ void RLSetSaveFileDataCallback(SaveFileDataCallback callback) { saveFileData = c
 void RLSetLoadFileTextCallback(LoadFileTextCallback callback) { loadFileText = callback; }  // Set custom file text loader
 void RLSetSaveFileTextCallback(SaveFileTextCallback callback) { saveFileText = callback; }  // Set custom file text saver
 
+#if defined(SUPPORT_THREADED_JOBS)
+static JobPool jobs = { JOB_MUTEX_INITIALIZER, JOB_COND_INITIALIZER, JOB_COND_INITIALIZER };    // Worker threads pool
+static BackgroundJobQueue background = { JOB_MUTEX_INITIALIZER, JOB_COND_INITIALIZER, JOB_COND_INITIALIZER };  // Background jobs queue
+#endif
+
+static rAssetPack *mountedPacks[MAX_MOUNTED_ASSET_PACKS] = { 0 };  // Mounted asset packs, in mounting order
+static int mountedPackCount = 0;                    // Mounted asset packs count
+
 #if defined(PLATFORM_ANDROID)
 static AAssetManager *assetManager = NULL;          // Android assets manager pointer
 static const char *internalDataPath = NULL;         // Android internal data path
@@ -94,6 +276,34 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+static unsigned char *RLReadFileData(const char *fileName, int *dataSize);  // Read file data into a buffer, using standard file io
+static char *RLReadFileText(const char *fileName);  // Read text data from file into a '\0' terminated string, using standard file io
+#if defined(FILE_MAPPING_AVAILABLE)
+static unsigned char *RLMapFileData(const char *fileName, long long *dataSize, bool copyOnWrite); // Map file data in memory, NULL on failure
+static void RLUnmapFileData(const unsigned char *data, long long dataSize);           // Unmap file data mapped by RLMapFileData()
+#endif
+
+static unsigned long long RLHashAssetPackName(const char *name, const char **normalized); // Get asset pack file name hash, normalized name returned
+static bool RLAssetPackNameEquals(const char *packName, const char *name); // Check if an asset pack name is equal to a normalized file name
+static const AssetPackEntry *RLFindAssetPackEntry(const rAssetPack *pack, const char *name, unsigned long long hash); // Find asset pack entry by normalized name
+static unsigned char *RLReadAssetPackEntry(const rAssetPack *pack, const AssetPackEntry *entry, const char *fileName, int *dataSize); // Read asset pack entry data
+static bool RLIsAssetPackData(const void *data);    // Check if data belongs to a mounted asset pack (not a copy)
+static int RLCompareAssetPackEntries(const void *a, const void *b); // Compare asset pack entries by hash (qsort callback)
+
+#if defined(SUPPORT_THREADED_JOBS)
+static void RLProcessJobBatches(int worker);        // Claim and process batches of current job, pool must be locked
+#if defined(_WIN32)
+static unsigned long __stdcall RLJobWorkerThread(void *arg);    // Worker thread entry point
+#else
+static void *RLJobWorkerThread(void *arg);          // Worker thread entry point
+#endif
+#if defined(_WIN32)
+static unsigned long __stdcall RLBackgroundJobThread(void *arg);    // Background thread entry point
+#else
+static void *RLBackgroundJobThread(void *arg);      // Background thread entry point
+#endif
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
 //----------------------------------------------------------------------------------
@@ -186,68 +396,78 @@ unsigned char * RLLoadFileData(const char *fileName, int *dataSize)
 
     if (fileName != NULL)
     {
-        if (loadFileData)
-        {
-            data = loadFileData(fileName, dataSize);
-            return data;
-        }
-#if defined(SUPPORT_STANDARD_FILEIO)
-        FILE *file = fopen(fileName, "rb");
+        if (loadFileData) data = loadFileData(fileName, dataSize);
+        else data = RLReadFileData(fileName, dataSize);
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
 
-        if (file != NULL)
-        {
-            // WARNING: On binary streams SEEK_END could not be found,
-            // using fseek() and ftell() could not work in some (rare) cases
-            fseek(file, 0, SEEK_END);
-            int size = ftell(file);     // WARNING: ftell() returns 'long int', maximum size returned is INT_MAX (2147483647 bytes)
-            fseek(file, 0, SEEK_SET);
+    return data;
+}
 
-            if (size > 0)
-            {
-                data = (unsigned char *)RL_MALLOC(size*sizeof(unsigned char));
+// Unload file data allocated by LoadFileData()
+void RLUnloadFileData(unsigned char *data)
+{
+    // NOTE: Uncompressed files data read from mounted asset packs is not a copy
+    if (RLIsAssetPackData(data)) return;
 
-                if (data != NULL)
-                {
-                    // NOTE: fread() returns number of read elements instead of bytes, so we read [1 byte, size elements]
-                    size_t count = fread(data, sizeof(unsigned char), size, file);
+    RL_FREE(data);
+}
 
-                    // WARNING: fread() returns a size_t value, usually 'unsigned int' (32bit compilation) and 'unsigned long long' (64bit compilation)
-                    // dataSize is unified along raylib as a 'int' type, so, for file-sizes > INT_MAX (2147483647 bytes) we have a limitation
-                    if (count > 2147483647)
-                    {
-                        TRACELOG(LOG_WARNING, "FILEIO: [%s] File is bigger than 2147483647 bytes, avoid using LoadFileData()", fileName);
+// Load file data mapped read-only in memory
+// NOTE: File data is loaded with LoadFileData() if a custom file data loader is set or file can not be mapped,
+// mapped data must not be accessed if file is modified (truncated) before UnloadMappedFile()
+MappedFile RLLoadMappedFile(const char *fileName)
+{
+    MappedFile file = { 0 };
 
-                        RL_FREE(data);
-                        data = NULL;
-                    }
-                    else
-                    {
-                        *dataSize = (int)count;
+    if (fileName == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+        return file;
+    }
 
-                        if ((*dataSize) != size) TRACELOG(LOG_WARNING, "FILEIO: [%s] File partially loaded (%i bytes out of %i)", fileName, dataSize, count);
-                        else TRACELOG(LOG_INFO, "FILEIO: [%s] File loaded successfully", fileName);
-                    }
-                }
-                else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to allocated memory for file reading", fileName);
-            }
-            else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file", fileName);
+#if defined(FILE_MAPPING_AVAILABLE)
+    if (loadFileData == NULL)
+    {
+        file.data = RLMapFileData(fileName, &file.size, false);
 
-            fclose(file);
+        if (file.data != NULL)
+        {
+            file.mapped = true;
+            TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully", fileName);
+            return file;
         }
-        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
-#else
-    TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, use custom file callback");
-#endif
     }
-    else TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+#endif
 
-    return data;
+    // NOTE: File errors reported by LoadFileData()
+    int dataSize = 0;
+    file.data = RLLoadFileData(fileName, &dataSize);
+    file.size = dataSize;
+
+    return file;
 }
 
-// Unload file data allocated by LoadFileData()
-void RLUnloadFileData(unsigned char *data)
+// Check if a mapped file is valid (data available)
+bool RLIsMappedFileValid(MappedFile file)
 {
-    RL_FREE(data);
+    return ((file.data != NULL) && (file.size > 0));
+}
+
+// Unload mapped file data
+void RLUnloadMappedFile(MappedFile file)
+{
+    if (file.data == NULL) return;
+
+#if defined(FILE_MAPPING_AVAILABLE)
+    if (file.mapped)
+    {
+        RLUnmapFileData(file.data, file.size);
+        return;
+    }
+#endif
+
+    RLUnloadFileData((unsigned char *)file.data);
 }
 
 // Save data to file from buffer
@@ -348,50 +568,8 @@ char * RLLoadFileText(const char *fileName)
 
     if (fileName != NULL)
     {
-        if (loadFileText)
-        {
-            text = loadFileText(fileName);
-            return text;
-        }
-#if defined(SUPPORT_STANDARD_FILEIO)
-        FILE *file = fopen(fileName, "rt");
-
-        if (file != NULL)
-        {
-            // WARNING: When reading a file as 'text' file,
-            // text mode causes carriage return-linefeed translation...
-            // ...but using fseek() should return correct byte-offset
-            fseek(file, 0, SEEK_END);
-            unsigned int size = (unsigned int)ftell(file);
-            fseek(file, 0, SEEK_SET);
-
-            if (size > 0)
-            {
-                text = (char *)RL_MALLOC((size + 1)*sizeof(char));
-
-                if (text != NULL)
-                {
-                    unsigned int count = (unsigned int)fread(text, sizeof(char), size, file);
-
-                    // WARNING: \r\n is converted to \n on reading, so,
-                    // read bytes count gets reduced by the number of lines
-                    if (count < size) text = RL_REALLOC(text, count + 1);
-
-                    // Zero-terminate the string
-                    text[count] = '\0';
-
-                    TRACELOG(LOG_INFO, "FILEIO: [%s] Text file loaded successfully", fileName);
-                }
-                else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to allocated memory for file reading", fileName);
-            }
-            else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read text file", fileName);
-
-            fclose(file);
-        }
-        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open text file", fileName);
-#else
-    TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, use custom file callback");
-#endif
+        if (loadFileText) text = loadFileText(fileName);
+        else text = RLReadFileText(fileName);
     }
     else TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
 
@@ -438,73 +616,1053 @@ bool RLSaveFileText(const char *fileName, char *text)
     return success;
 }
 
-#if defined(PLATFORM_ANDROID)
-// Initialize asset manager from android app
-void RLInitAssetManager(AAssetManager *manager, const char *dataPath)
+// Load asset pack from file, pack file is mapped in memory and only index is read
+// NOTE: Pack is loaded with standard file io if mapping is not available, file loading callbacks are not used
+AssetPack RLLoadAssetPack(const char *fileName)
 {
-    assetManager = manager;
-    internalDataPath = dataPath;
-}
+    AssetPack pack = { 0 };
 
-// Replacement for fopen()
-// Ref: https://developer.android.com/ndk/reference/group/asset
-FILE *android_fopen(const char *fileName, const char *mode)
-{
-    if (mode[0] == 'w')
+    if (fileName == NULL)
     {
-        // fopen() is mapped to android_fopen() that only grants read access to
-        // assets directory through AAssetManager but we want to also be able to
-        // write data when required using the standard stdio FILE access functions
-        // Ref: https://stackoverflow.com/questions/11294487/android-writing-saving-files-from-native-code-only
-        #undef fopen
-        return fopen(TextFormat("%s/%s", internalDataPath, fileName), mode);
-        #define fopen(name, mode) android_fopen(name, mode)
+        TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+        return pack;
     }
-    else
+
+    rAssetPack *data = (rAssetPack *)RL_CALLOC(1, sizeof(rAssetPack));
+    if (data == NULL) return pack;
+
+#if defined(FILE_MAPPING_AVAILABLE)
+    // NOTE: Mapped copy-on-write, files data is provided as LoadFileData() data that could be modified by loaders
+    data->fileData = RLMapFileData(fileName, &data->fileSize, true);
+    data->mapped = (data->fileData != NULL);
+#endif
+
+    if (data->fileData == NULL)
     {
-        // NOTE: AAsset provides access to read-only asset
-        AAsset *asset = AAssetManager_open(assetManager, fileName, AASSET_MODE_UNKNOWN);
+        int dataSize = 0;
+        data->fileData = RLReadFileData(fileName, &dataSize);
+        data->fileSize = dataSize;
+    }
 
-        if (asset != NULL)
-        {
-            // Get pointer to file in the assets
-            return funopen(asset, android_read, android_write, android_seek, android_close);
-        }
-        else
+    // Validate pack header and index, file data is not accessed out of pack bounds afterwards
+    bool valid = false;
+    AssetPackHeader header = { 0 };
+
+    if ((data->fileData != NULL) && (data->fileSize >= (long long)sizeof(AssetPackHeader)))
+    {
+        memcpy(&header, data->fileData, sizeof(AssetPackHeader));
+
+        unsigned long long fileSize = (unsigned long long)data->fileSize;
+        unsigned long long bucketsSize = ((((unsigned long long)1 << (header.bucketBits & 31)) + 1)*sizeof(unsigned int) + 7) & ~7ULL;
+        unsigned long long entriesSize = (unsigned long long)header.entryCount*sizeof(AssetPackEntry);
+
+        valid = (memcmp(header.id, "rPAK", 4) == 0) && (header.version == ASSET_PACK_VERSION) && (header.bucketBits <= 30) &&
+                ((header.indexOffset%8) == 0) && (header.indexOffset <= fileSize) && (header.namesSize <= fileSize) &&
+                ((bucketsSize + entriesSize + header.namesSize) <= (fileSize - header.indexOffset)) &&
+                ((header.entryCount == 0) || ((header.namesSize > 0) && (data->fileData[header.indexOffset + bucketsSize + entriesSize + header.namesSize - 1] == '\0')));
+
+        if (valid)
         {
-            #undef fopen
-            // Just do a regular open if file is not found in the assets
-            return fopen(TextFormat("%s/%s", internalDataPath, fileName), mode);
-            #define fopen(name, mode) android_fopen(name, mode)
+            data->buckets = (const unsigned int *)(data->fileData + header.indexOffset);
+            data->entries = (const AssetPackEntry *)(data->fileData + header.indexOffset + bucketsSize);
+            data->names = (const char *)(data->fileData + header.indexOffset + bucketsSize + entriesSize);
+            data->entryCount = header.entryCount;
+            data->bucketBits = header.bucketBits;
+
+            unsigned int bucketCount = 1u << data->bucketBits;
+            valid = (data->buckets[0] == 0) && (data->buckets[bucketCount] == data->entryCount);
+            for (unsigned int i = 0; valid && (i < bucketCount); i++) valid = (data->buckets[i] <= data->buckets[i + 1]);
+
+            for (unsigned int i = 0; valid && (i < data->entryCount); i++)
+            {
+                const AssetPackEntry *entry = &data->entries[i];
+                valid = (entry->offset <= fileSize) && (entry->size <= (fileSize - entry->offset)) && (entry->nameOffset < header.namesSize) &&
+                        ((entry->flags & ASSET_PACK_COMPRESSED) || (entry->size == entry->fileSize));
+            }
         }
     }
+
+    if (!valid)
+    {
+        if (data->fileData != NULL) TRACELOG(LOG_WARNING, "FILEIO: [%s] Asset pack is not valid", fileName);
+
+        pack.data = data;
+        RLUnloadAssetPack(pack);
+        pack.data = NULL;
+        return pack;
+    }
+
+    pack.data = data;
+    TRACELOG(LOG_INFO, "FILEIO: [%s] Asset pack loaded successfully (%i files)", fileName, data->entryCount);
+
+    return pack;
 }
-#endif  // PLATFORM_ANDROID
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
-#if defined(PLATFORM_ANDROID)
-static int android_read(void *cookie, char *data, int dataSize)
+// Check if an asset pack is valid
+bool RLIsAssetPackValid(AssetPack pack)
 {
-    return AAsset_read((AAsset *)cookie, data, dataSize);
+    return (pack.data != NULL);
 }
 
-static int android_write(void *cookie, const char *data, int dataSize)
+// Unload asset pack, unmounted if required
+void RLUnloadAssetPack(AssetPack pack)
 {
-    TRACELOG(LOG_WARNING, "ANDROID: Failed to provide write access to APK");
+    if (pack.data == NULL) return;
 
-    return EACCES;
+    if (pack.data->mounted) RLUnmountAssetPack(pack);
+
+#if defined(FILE_MAPPING_AVAILABLE)
+    if (pack.data->mapped) RLUnmapFileData(pack.data->fileData, pack.data->fileSize);
+    else RL_FREE(pack.data->fileData);
+#else
+    RL_FREE(pack.data->fileData);
+#endif
+
+    RL_FREE(pack.data);
 }
 
-static fpos_t android_seek(void *cookie, fpos_t offset, int whence)
+// Mount asset pack, files are searched on last mounted packs first
+// NOTE: Packs must be mounted (and unmounted) while no files are being loaded (i.e. background jobs)
+bool RLMountAssetPack(AssetPack pack)
 {
-    return AAsset_seek((AAsset *)cookie, offset, whence);
+    if ((pack.data == NULL) || pack.data->mounted) return false;
+
+    if (mountedPackCount >= MAX_MOUNTED_ASSET_PACKS)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: Asset packs mounted limit reached (%i)", MAX_MOUNTED_ASSET_PACKS);
+        return false;
+    }
+
+    mountedPacks[mountedPackCount] = pack.data;
+    mountedPackCount++;
+    pack.data->mounted = true;
+
+    return true;
 }
 
-static int android_close(void *cookie)
+// Unmount asset pack
+// WARNING: Files data loaded from pack must be unloaded before, uncompressed files data is part of the pack
+void RLUnmountAssetPack(AssetPack pack)
 {
-    AAsset_close((AAsset *)cookie);
-    return 0;
+    if ((pack.data == NULL) || !pack.data->mounted) return;
+
+    for (int i = 0; i < mountedPackCount; i++)
+    {
+        if (mountedPacks[i] == pack.data)
+        {
+            for (int j = i; j < (mountedPackCount - 1); j++) mountedPacks[j] = mountedPacks[j + 1];
+            mountedPackCount--;
+            break;
+        }
+    }
+
+    pack.data->mounted = false;
 }
-#endif  // PLATFORM_ANDROID
+
+// Load file data from mounted asset packs, file system is used for files not packed
+// NOTE: Intended to be set as file data loader: SetLoadFileDataCallback(LoadAssetPackFileData),
+// uncompressed files are not copied, data points to pack file data and UnloadFileData() does not free it
+unsigned char *RLLoadAssetPackFileData(const char *fileName, int *dataSize)
+{
+    *dataSize = 0;
+
+    if (fileName == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+        return NULL;
+    }
+
+    if (mountedPackCount > 0)
+    {
+        const char *name = NULL;
+        unsigned long long hash = RLHashAssetPackName(fileName, &name);
+
+        for (int i = mountedPackCount - 1; i >= 0; i--)
+        {
+            const AssetPackEntry *entry = RLFindAssetPackEntry(mountedPacks[i], name, hash);
+            if (entry != NULL) return RLReadAssetPackEntry(mountedPacks[i], entry, fileName, dataSize);
+        }
+    }
+
+    return RLReadFileData(fileName, dataSize);
+}
+
+// Load text data from mounted asset packs, file system is used for files not packed
+// NOTE: Intended to be set as file text loader: SetLoadFileTextCallback(LoadAssetPackFileText), text is always a copy
+char *RLLoadAssetPackFileText(const char *fileName)
+{
+    if (fileName == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+        return NULL;
+    }
+
+    if (mountedPackCount > 0)
+    {
+        const char *name = NULL;
+        unsigned long long hash = RLHashAssetPackName(fileName, &name);
+
+        for (int i = mountedPackCount - 1; i >= 0; i--)
+        {
+            const AssetPackEntry *entry = RLFindAssetPackEntry(mountedPacks[i], name, hash);
+
+            if (entry != NULL)
+            {
+                char *text = NULL;
+                int dataSize = 0;
+                unsigned char *data = RLReadAssetPackEntry(mountedPacks[i], entry, fileName, &dataSize);
+
+                if (data != NULL)
+                {
+                    text = (char *)RL_MALLOC(dataSize + 1);
+
+                    if (text != NULL)
+                    {
+                        memcpy(text, data, dataSize);
+                        text[dataSize] = '\0';
+                    }
+
+                    RLUnloadFileData(data);
+                }
+
+                return text;
+            }
+        }
+    }
+
+    return RLReadFileText(fileName);
+}
+
+// Export files to asset pack, optionally compressed (DEFLATE)
+// NOTE: Files are packed with the provided file names (normalized: '\' separators as '/' and no leading "./"),
+// compressed files are only kept compressed if they save at least 1/8 of file size (already compressed formats are stored)
+bool RLExportAssetPack(const char *fileName, FilePathList files, bool compress)
+{
+    bool success = false;
+
+    if (fileName == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: File name provided is not valid");
+        return success;
+    }
+
+#if defined(SUPPORT_STANDARD_FILEIO)
+    FILE *packFile = fopen(fileName, "wb");
+
+    if (packFile == NULL)
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+        return success;
+    }
+
+    AssetPackHeader header = { { 'r', 'P', 'A', 'K' }, ASSET_PACK_VERSION };
+    AssetPackEntry *entries = (AssetPackEntry *)RL_CALLOC((files.count > 0)? files.count : 1, sizeof(AssetPackEntry));
+    char *names = NULL;
+    unsigned long long namesCapacity = 0;
+    unsigned long long offset = sizeof(AssetPackHeader);
+    unsigned int count = 0;
+    static const unsigned char padding[ASSET_PACK_DATA_ALIGNMENT + 8] = { 0 };
+
+    success = (entries != NULL) && (fwrite(&header, sizeof(AssetPackHeader), 1, packFile) == 1);
+
+    for (unsigned int i = 0; success && (i < files.count); i++)
+    {
+        const char *name = NULL;
+        unsigned long long hash = RLHashAssetPackName(files.paths[i], &name);
+
+        // Files with the same normalized name are only packed once
+        bool packed = false;
+        for (unsigned int j = 0; !packed && (j < count); j++) packed = ((entries[j].hash == hash) && RLAssetPackNameEquals(names + entries[j].nameOffset, name));
+
+        if (packed)
+        {
+            TRACELOG(LOG_WARNING, "FILEIO: [%s] File already packed, skipped", files.paths[i]);
+            continue;
+        }
+
+        // NOTE: Empty files can not be loaded (NULL data), they are packed as empty entries
+        int dataSize = 0;
+        bool empty = RLFileExists(files.paths[i]) && (RLGetFileLength(files.paths[i]) == 0);
+        unsigned char *data = empty? NULL : RLLoadFileData(files.paths[i], &dataSize);
+
+        if ((data == NULL) && !empty)
+        {
+            success = false;
+            break;
+        }
+
+        AssetPackEntry *entry = &entries[count];
+        entry->hash = hash;
+        entry->fileSize = (unsigned long long)dataSize;
+
+        const unsigned char *packData = data;
+        unsigned char *compData = NULL;
+        int compDataSize = 0;
+
+        if (compress && (dataSize > 0)) compData = RLCompressData(data, dataSize, &compDataSize);
+
+        if ((compData != NULL) && (compDataSize <= (dataSize - dataSize/8)))
+        {
+            packData = compData;
+            entry->size = (unsigned long long)compDataSize;
+            entry->flags = ASSET_PACK_COMPRESSED;
+        }
+        else entry->size = (unsigned long long)dataSize;
+
+        // Align file data on pack
+        unsigned long long paddingSize = (ASSET_PACK_DATA_ALIGNMENT - offset%ASSET_PACK_DATA_ALIGNMENT)%ASSET_PACK_DATA_ALIGNMENT;
+        entry->offset = offset + paddingSize;
+
+        success = (fwrite(padding, 1, (size_t)paddingSize, packFile) == paddingSize) &&
+                  ((entry->size == 0) || (fwrite(packData, 1, (size_t)entry->size, packFile) == entry->size));
+        offset = entry->offset + entry->size;
+
+        RL_FREE(compData);
+        RLUnloadFileData(data);
+
+        // Add normalized file name to names block
+        unsigned long long nameSize = strlen(name) + 1;
+
+        if (success && ((header.namesSize + nameSize) > namesCapacity))
+        {
+            unsigned long long capacity = (namesCapacity > 0)? namesCapacity*2 : 4096;
+            while (capacity < (header.namesSize + nameSize)) capacity *= 2;
+
+            char *temp = (char *)RL_REALLOC(names, (size_t)capacity);
+            success = (temp != NULL) && (capacity <= 0xFFFFFFFFULL);
+
+            if (temp != NULL)
+            {
+                names = temp;
+                namesCapacity = capacity;
+            }
+        }
+
+        if (success)
+        {
+            entry->nameOffset = (unsigned int)header.namesSize;
+            for (unsigned long long c = 0; c < nameSize; c++) names[header.namesSize + c] = (name[c] == '\\')? '/' : name[c];
+            header.namesSize += nameSize;
+            count++;
+        }
+    }
+
+    if (success)
+    {
+        // Build index: entries sorted by hash, buckets by hash top bits (at least as many buckets as entries)
+        qsort(entries, count, sizeof(AssetPackEntry), RLCompareAssetPackEntries);
+
+        header.entryCount = count;
+        while ((1u << header.bucketBits) < count) header.bucketBits++;
+
+        unsigned int bucketCount = 1u << header.bucketBits;
+        unsigned int *buckets = (unsigned int *)RL_CALLOC(bucketCount + 2, sizeof(unsigned int));   // NOTE: +1 for 8 bytes alignment
+
+        if (buckets != NULL)
+        {
+            for (unsigned int i = 0; i < count; i++) buckets[((header.bucketBits > 0)? (unsigned int)(entries[i].hash >> (64 - header.bucketBits)) : 0) + 1]++;
+            for (unsigned int i = 0; i < bucketCount; i++) buckets[i + 1] += buckets[i];
+
+            unsigned long long paddingSize = (8 - offset%8)%8;
+            unsigned long long bucketsSize = (((unsigned long long)bucketCount + 1)*sizeof(unsigned int) + 7) & ~7ULL;
+            header.indexOffset = offset + paddingSize;
+
+            success = (fwrite(padding, 1, (size_t)paddingSize, packFile) == paddingSize) &&
+                      (fwrite(buckets, 1, (size_t)bucketsSize, packFile) == bucketsSize) &&
+                      (fwrite(entries, sizeof(AssetPackEntry), count, packFile) == count) &&
+                      (fwrite(names, 1, (size_t)header.namesSize, packFile) == header.namesSize) &&
+                      (fseek(packFile, 0, SEEK_SET) == 0) &&
+                      (fwrite(&header, sizeof(AssetPackHeader), 1, packFile) == 1);
+
+            RL_FREE(buckets);
+        }
+        else success = false;
+    }
+
+    if (fclose(packFile) != 0) success = false;
+
+    // Partially written pack is removed on failure
+    if (!success) remove(fileName);
+
+    RL_FREE(entries);
+    RL_FREE(names);
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Asset pack exported successfully (%i files)", fileName, count);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export asset pack", fileName);
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, asset pack can not be exported");
+#endif
+
+    return success;
+}
+
+// Run callback over [0, count) items range, split in batches across worker threads
+// NOTE: Calling thread also processes batches and returns once all items have been processed,
+// ranges smaller than batchSize (or nested/concurrent calls) are processed on calling thread
+void RLParallelFor(int count, int batchSize, JobRangeCallback callback, void *userData)
+{
+    if ((count <= 0) || (callback == NULL)) return;
+    if (batchSize < 1) batchSize = 1;
+
+#if defined(SUPPORT_THREADED_JOBS)
+    if (count > batchSize)
+    {
+        JobMutexLock(&jobs.lock);
+
+        if (!jobs.initialized)
+        {
+            // Workers are created on first use, one per available core (caller thread counts as one)
+        #if defined(_WIN32)
+            int cores = (int)GetActiveProcessorCount(0xFFFF);   // ALL_PROCESSOR_GROUPS
+        #else
+            int cores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+        #endif
+            int threadCount = (cores > MAX_JOB_WORKER_THREADS + 1)? MAX_JOB_WORKER_THREADS : cores - 1;
+
+            jobs.shutdown = false;
+            jobs.threadCount = 0;
+            jobs.startGeneration = jobs.generation;
+
+            for (int i = 0; i < threadCount; i++)
+            {
+                void *arg = (void *)(size_t)(i + 1);
+            #if defined(_WIN32)
+                jobs.threads[i] = CreateThread(NULL, 0, RLJobWorkerThread, arg, 0, NULL);
+                if (jobs.threads[i] == NULL) break;
+            #else
+                if (pthread_create(&jobs.threads[i], NULL, RLJobWorkerThread, arg) != 0) break;
+            #endif
+                jobs.threadCount++;
+            }
+
+            jobs.initialized = true;
+            TRACELOG(LOG_INFO, "JOBS: Worker threads initialized successfully (%i workers)", jobs.threadCount);
+        }
+
+        if (!jobs.busy && (jobs.threadCount > 0))
+        {
+            jobs.busy = true;
+            jobs.callback = callback;
+            jobs.userData = userData;
+            jobs.count = count;
+            jobs.next = 0;
+            jobs.pending = jobs.threadCount;
+
+            // Split work in several batches per worker for load balancing, but never below requested batch size
+            int workerBatch = count/((jobs.threadCount + 1)*4);
+            jobs.batchSize = (workerBatch > batchSize)? workerBatch : batchSize;
+
+            jobs.generation++;
+            JobCondBroadcast(&jobs.wake);
+
+            RLProcessJobBatches(0);
+
+            while (jobs.pending > 0) JobCondWait(&jobs.done, &jobs.lock);
+
+            jobs.callback = NULL;
+            jobs.userData = NULL;
+            jobs.busy = false;
+            JobMutexUnlock(&jobs.lock);
+            return;
+        }
+
+        JobMutexUnlock(&jobs.lock);
+    }
+#endif
+
+    callback(userData, 0, count, 0);
+}
+
+// Get number of workers available for parallel jobs (including caller thread)
+// NOTE: Worker threads are created on first RLParallelFor() call, it returns the expected count
+int RLGetJobWorkerCount(void)
+{
+    int count = 1;
+
+#if defined(SUPPORT_THREADED_JOBS)
+    JobMutexLock(&jobs.lock);
+    if (jobs.initialized) count += jobs.threadCount;
+    else
+    {
+    #if defined(_WIN32)
+        int cores = (int)GetActiveProcessorCount(0xFFFF);
+    #else
+        int cores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    #endif
+        count = (cores > MAX_JOB_WORKER_THREADS + 1)? MAX_JOB_WORKER_THREADS + 1 : ((cores > 1)? cores : 1);
+    }
+    JobMutexUnlock(&jobs.lock);
+#endif
+
+    return count;
+}
+
+// Queue job to be processed on background thread, jobs are processed in submission order
+// NOTE: Never blocks, if maxPending jobs are already pending (queued or running) job is not queued and false is returned,
+// if threaded jobs are not supported job is processed on calling thread before returning
+bool RLRunBackgroundJob(JobCallback callback, void *userData, int maxPending)
+{
+    if (callback == NULL) return false;
+
+#if defined(SUPPORT_THREADED_JOBS)
+    JobMutexLock(&background.lock);
+
+    if (!background.initialized)
+    {
+        background.shutdown = false;
+    #if defined(_WIN32)
+        background.thread = CreateThread(NULL, 0, RLBackgroundJobThread, NULL, 0, NULL);
+        background.initialized = (background.thread != NULL);
+    #else
+        background.initialized = (pthread_create(&background.thread, NULL, RLBackgroundJobThread, NULL) == 0);
+    #endif
+
+        if (background.initialized) TRACELOG(LOG_INFO, "JOBS: Background thread initialized successfully");
+        else TRACELOG(LOG_WARNING, "JOBS: Failed to create background thread, jobs processed on calling thread");
+    }
+
+    if (background.initialized)
+    {
+        int pending = background.count + (background.running? 1 : 0);
+
+        if ((background.count >= MAX_BACKGROUND_JOBS) || ((maxPending > 0) && (pending >= maxPending)))
+        {
+            JobMutexUnlock(&background.lock);
+            return false;
+        }
+
+        BackgroundJob *job = &background.jobs[(background.head + background.count)%MAX_BACKGROUND_JOBS];
+        job->callback = callback;
+        job->userData = userData;
+        background.count++;
+
+        JobCondBroadcast(&background.wake);
+        JobMutexUnlock(&background.lock);
+        return true;
+    }
+
+    JobMutexUnlock(&background.lock);
+#endif
+
+    callback(userData);
+
+    return true;
+}
+
+// Get number of background jobs pending (queued or running), only jobs using callback if not NULL
+// NOTE: Filtering by callback allows every job producer to track its own backlog
+int RLGetBackgroundJobCount(JobCallback callback)
+{
+    int count = 0;
+
+#if defined(SUPPORT_THREADED_JOBS)
+    JobMutexLock(&background.lock);
+    if (callback == NULL) count = background.count + (background.running? 1 : 0);
+    else
+    {
+        for (int i = 0; i < background.count; i++)
+        {
+            if (background.jobs[(background.head + i)%MAX_BACKGROUND_JOBS].callback == callback) count++;
+        }
+
+        if (background.running && (background.runningCallback == callback)) count++;
+    }
+    JobMutexUnlock(&background.lock);
+#endif
+
+    return count;
+}
+
+// Wait for all pending background jobs to be processed
+void RLWaitBackgroundJobs(void)
+{
+#if defined(SUPPORT_THREADED_JOBS)
+    JobMutexLock(&background.lock);
+    while (background.initialized && ((background.count > 0) || background.running)) JobCondWait(&background.done, &background.lock);
+    JobMutexUnlock(&background.lock);
+#endif
+}
+
+// Stop and join worker threads
+// NOTE: Worker threads are created again on next RLParallelFor() call,
+// background thread is stopped once all pending background jobs have been processed
+void RLCloseJobWorkers(void)
+{
+#if defined(SUPPORT_THREADED_JOBS)
+    JobMutexLock(&background.lock);
+
+    if (background.initialized)
+    {
+        background.shutdown = true;
+        JobCondBroadcast(&background.wake);
+        JobMutexUnlock(&background.lock);
+
+    #if defined(_WIN32)
+        WaitForSingleObject(background.thread, 0xFFFFFFFF);
+        CloseHandle(background.thread);
+    #else
+        pthread_join(background.thread, NULL);
+    #endif
+
+        JobMutexLock(&background.lock);
+        background.initialized = false;
+        background.shutdown = false;
+    }
+
+    JobMutexUnlock(&background.lock);
+
+    JobMutexLock(&jobs.lock);
+
+    if (!jobs.initialized || jobs.busy)
+    {
+        JobMutexUnlock(&jobs.lock);
+        return;
+    }
+
+    jobs.shutdown = true;
+    JobCondBroadcast(&jobs.wake);
+    JobMutexUnlock(&jobs.lock);
+
+    for (int i = 0; i < jobs.threadCount; i++)
+    {
+    #if defined(_WIN32)
+        WaitForSingleObject(jobs.threads[i], 0xFFFFFFFF);
+        CloseHandle(jobs.threads[i]);
+    #else
+        pthread_join(jobs.threads[i], NULL);
+    #endif
+    }
+
+    JobMutexLock(&jobs.lock);
+    jobs.threadCount = 0;
+    jobs.initialized = false;
+    jobs.shutdown = false;
+    JobMutexUnlock(&jobs.lock);
+
+    TRACELOG(LOG_INFO, "JOBS: Worker threads closed successfully");
+#endif
+}
+
+#if defined(PLATFORM_ANDROID)
+// Initialize asset manager from android app
+void RLInitAssetManager(AAssetManager *manager, const char *dataPath)
+{
+    assetManager = manager;
+    internalDataPath = dataPath;
+}
+
+// Replacement for fopen()
+// Ref: https://developer.android.com/ndk/reference/group/asset
+FILE *android_fopen(const char *fileName, const char *mode)
+{
+    if (mode[0] == 'w')
+    {
+        // fopen() is mapped to android_fopen() that only grants read access to
+        // assets directory through AAssetManager but we want to also be able to
+        // write data when required using the standard stdio FILE access functions
+        // Ref: https://stackoverflow.com/questions/11294487/android-writing-saving-files-from-native-code-only
+        #undef fopen
+        return fopen(TextFormat("%s/%s", internalDataPath, fileName), mode);
+        #define fopen(name, mode) android_fopen(name, mode)
+    }
+    else
+    {
+        // NOTE: AAsset provides access to read-only asset
+        AAsset *asset = AAssetManager_open(assetManager, fileName, AASSET_MODE_UNKNOWN);
+
+        if (asset != NULL)
+        {
+            // Get pointer to file in the assets
+            return funopen(asset, android_read, android_write, android_seek, android_close);
+        }
+        else
+        {
+            #undef fopen
+            // Just do a regular open if file is not found in the assets
+            return fopen(TextFormat("%s/%s", internalDataPath, fileName), mode);
+            #define fopen(name, mode) android_fopen(name, mode)
+        }
+    }
+}
+#endif  // PLATFORM_ANDROID
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+#if defined(PLATFORM_ANDROID)
+static int android_read(void *cookie, char *data, int dataSize)
+{
+    return AAsset_read((AAsset *)cookie, data, dataSize);
+}
+
+static int android_write(void *cookie, const char *data, int dataSize)
+{
+    TRACELOG(LOG_WARNING, "ANDROID: Failed to provide write access to APK");
+
+    return EACCES;
+}
+
+static fpos_t android_seek(void *cookie, fpos_t offset, int whence)
+{
+    return AAsset_seek((AAsset *)cookie, offset, whence);
+}
+
+static int android_close(void *cookie)
+{
+    AAsset_close((AAsset *)cookie);
+    return 0;
+}
+#endif  // PLATFORM_ANDROID
+
+// Read file data into a buffer, using standard file io
+static unsigned char *RLReadFileData(const char *fileName, int *dataSize)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
+
+#if defined(SUPPORT_STANDARD_FILEIO)
+    FILE *file = fopen(fileName, "rb");
+
+    if (file != NULL)
+    {
+        // WARNING: On binary streams SEEK_END could not be found,
+        // using fseek() and ftell() could not work in some (rare) cases
+        fseek(file, 0, SEEK_END);
+        int size = ftell(file);     // WARNING: ftell() returns 'long int', maximum size returned is INT_MAX (2147483647 bytes)
+        fseek(file, 0, SEEK_SET);
+
+        if (size > 0)
+        {
+            data = (unsigned char *)RL_MALLOC(size*sizeof(unsigned char));
+
+            if (data != NULL)
+            {
+                // NOTE: fread() returns number of read elements instead of bytes, so we read [1 byte, size elements]
+                size_t count = fread(data, sizeof(unsigned char), size, file);
+
+                // WARNING: fread() returns a size_t value, usually 'unsigned int' (32bit compilation) and 'unsigned long long' (64bit compilation)
+                // dataSize is unified along raylib as a 'int' type, so, for file-sizes > INT_MAX (2147483647 bytes) we have a limitation
+                if (count > 2147483647)
+                {
+                    TRACELOG(LOG_WARNING, "FILEIO: [%s] File is bigger than 2147483647 bytes, avoid using LoadFileData()", fileName);
+
+                    RL_FREE(data);
+                    data = NULL;
+                }
+                else
+                {
+                    *dataSize = (int)count;
+
+                    if ((*dataSize) != size) TRACELOG(LOG_WARNING, "FILEIO: [%s] File partially loaded (%i bytes out of %i)", fileName, dataSize, count);
+                    else TRACELOG(LOG_INFO, "FILEIO: [%s] File loaded successfully", fileName);
+                }
+            }
+            else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to allocated memory for file reading", fileName);
+        }
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file", fileName);
+
+        fclose(file);
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, use custom file callback");
+#endif
+
+    return data;
+}
+
+// Read text data from file into a '\0' terminated string, using standard file io
+static char *RLReadFileText(const char *fileName)
+{
+    char *text = NULL;
+
+#if defined(SUPPORT_STANDARD_FILEIO)
+    FILE *file = fopen(fileName, "rt");
+
+    if (file != NULL)
+    {
+        // WARNING: When reading a file as 'text' file,
+        // text mode causes carriage return-linefeed translation...
+        // ...but using fseek() should return correct byte-offset
+        fseek(file, 0, SEEK_END);
+        unsigned int size = (unsigned int)ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        if (size > 0)
+        {
+            text = (char *)RL_MALLOC((size + 1)*sizeof(char));
+
+            if (text != NULL)
+            {
+                unsigned int count = (unsigned int)fread(text, sizeof(char), size, file);
+
+                // WARNING: \r\n is converted to \n on reading, so,
+                // read bytes count gets reduced by the number of lines
+                if (count < size) text = RL_REALLOC(text, count + 1);
+
+                // Zero-terminate the string
+                text[count] = '\0';
+
+                TRACELOG(LOG_INFO, "FILEIO: [%s] Text file loaded successfully", fileName);
+            }
+            else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to allocated memory for file reading", fileName);
+        }
+        else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read text file", fileName);
+
+        fclose(file);
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to open text file", fileName);
+#else
+    TRACELOG(LOG_WARNING, "FILEIO: Standard file io not supported, use custom file callback");
+#endif
+
+    return text;
+}
+
+#if defined(FILE_MAPPING_AVAILABLE)
+// Map file data in memory, NULL on failure (empty file, size not addressable or mapping failed)
+// NOTE: Mapping does not keep file opened, mapped pages are shared with system file cache,
+// data is read-only unless mapped copy-on-write (written pages become private copies, file not modified)
+static unsigned char *RLMapFileData(const char *fileName, long long *dataSize, bool copyOnWrite)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
+
+#if defined(_WIN32)
+    void *file = CreateFileA(fileName, 0x80000000, 0x00000001, NULL, 3, 0x80, NULL);   // GENERIC_READ, FILE_SHARE_READ, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL
+    if (file == (void *)(size_t)-1) return NULL;        // INVALID_HANDLE_VALUE
+
+    long long size = 0;
+
+    if (GetFileSizeEx(file, &size) && (size > 0) && ((long long)(size_t)size == size))
+    {
+        void *mapping = CreateFileMappingA(file, NULL, copyOnWrite? 0x08 : 0x02, 0, 0, NULL);  // PAGE_WRITECOPY : PAGE_READONLY
+
+        if (mapping != NULL)
+        {
+            data = (unsigned char *)MapViewOfFile(mapping, copyOnWrite? 0x0001 : 0x0004, 0, 0, 0);  // FILE_MAP_COPY : FILE_MAP_READ
+            CloseHandle(mapping);   // NOTE: Mapping object is kept alive by the view
+        }
+    }
+
+    CloseHandle(file);
+#else
+    int file = open(fileName, O_RDONLY);
+    if (file == -1) return NULL;
+
+    struct stat info = { 0 };
+    long long size = 0;
+
+    if ((fstat(file, &info) == 0) && S_ISREG(info.st_mode)) size = (long long)info.st_size;
+
+    if ((size > 0) && ((long long)(size_t)size == size))
+    {
+        void *mapping = mmap(NULL, (size_t)size, copyOnWrite? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_PRIVATE, file, 0);
+        if (mapping != MAP_FAILED) data = (unsigned char *)mapping;
+    }
+
+    close(file);
+#endif
+
+    if (data != NULL) *dataSize = size;
+
+    return data;
+}
+
+// Unmap file data mapped by RLMapFileData()
+static void RLUnmapFileData(const unsigned char *data, long long dataSize)
+{
+#if defined(_WIN32)
+    UnmapViewOfFile(data);
+#else
+    munmap((void *)data, (size_t)dataSize);
+#endif
+}
+#endif  // FILE_MAPPING_AVAILABLE
+
+// Get asset pack file name hash (FNV-1a), normalized name start returned (no leading "./")
+// NOTE: '\' separators are hashed as '/', so Windows style paths find the same files
+static unsigned long long RLHashAssetPackName(const char *name, const char **normalized)
+{
+    while ((name[0] == '.') && ((name[1] == '/') || (name[1] == '\\'))) name += 2;
+    *normalized = name;
+
+    unsigned long long hash = 14695981039346656037ULL;
+
+    for (const char *c = name; *c != '\0'; c++)
+    {
+        hash ^= (unsigned char)((*c == '\\')? '/' : *c);
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+// Check if an asset pack name is equal to a normalized file name ('\' separators equal to '/')
+static bool RLAssetPackNameEquals(const char *packName, const char *name)
+{
+    for (; *name != '\0'; packName++, name++)
+    {
+        if (*packName != ((*name == '\\')? '/' : *name)) return false;
+    }
+
+    return (*packName == '\0');
+}
+
+// Find asset pack entry by normalized file name and hash, NULL if not packed
+static const AssetPackEntry *RLFindAssetPackEntry(const rAssetPack *pack, const char *name, unsigned long long hash)
+{
+    unsigned int bucket = (pack->bucketBits > 0)? (unsigned int)(hash >> (64 - pack->bucketBits)) : 0;
+
+    for (unsigned int i = pack->buckets[bucket]; i < pack->buckets[bucket + 1]; i++)
+    {
+        const AssetPackEntry *entry = &pack->entries[i];
+        if ((entry->hash == hash) && RLAssetPackNameEquals(pack->names + entry->nameOffset, name)) return entry;
+    }
+
+    return NULL;
+}
+
+// Read asset pack entry data, compressed data is decompressed to a new buffer
+// NOTE: Uncompressed data is not copied, it is shared by all loads of the file and should not be modified
+static unsigned char *RLReadAssetPackEntry(const rAssetPack *pack, const AssetPackEntry *entry, const char *fileName, int *dataSize)
+{
+    unsigned char *data = NULL;
+    *dataSize = 0;
+
+    if ((entry->fileSize > 2147483647) || (entry->size > 2147483647))
+    {
+        TRACELOG(LOG_WARNING, "FILEIO: [%s] File is bigger than 2147483647 bytes, avoid using LoadFileData()", fileName);
+        return NULL;
+    }
+
+    if (entry->flags & ASSET_PACK_COMPRESSED)
+    {
+        int size = 0;
+        data = RLDecompressData(pack->fileData + entry->offset, (int)entry->size, &size);
+
+        if ((data != NULL) && (size != (int)entry->fileSize))
+        {
+            RL_FREE(data);
+            data = NULL;
+        }
+
+        if (data == NULL) TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to decompress packed file", fileName);
+        else *dataSize = size;
+    }
+    else if (entry->fileSize > 0)
+    {
+        data = pack->fileData + entry->offset;
+        *dataSize = (int)entry->fileSize;
+    }
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to read file", fileName);
+
+    if (data != NULL) TRACELOG(LOG_INFO, "FILEIO: [%s] File loaded successfully from asset pack", fileName);
+
+    return data;
+}
+
+// Check if data belongs to a mounted asset pack file data (not a copy)
+static bool RLIsAssetPackData(const void *data)
+{
+    for (int i = 0; i < mountedPackCount; i++)
+    {
+        const unsigned char *start = mountedPacks[i]->fileData;
+        if (((const unsigned char *)data >= start) && ((const unsigned char *)data < (start + mountedPacks[i]->fileSize))) return true;
+    }
+
+    return false;
+}
+
+// Compare asset pack entries by hash (qsort callback)
+static int RLCompareAssetPackEntries(const void *a, const void *b)
+{
+    unsigned long long hashA = ((const AssetPackEntry *)a)->hash;
+    unsigned long long hashB = ((const AssetPackEntry *)b)->hash;
+
+    return (hashA > hashB) - (hashA < hashB);
+}
+
+#if defined(SUPPORT_THREADED_JOBS)
+// Claim and process batches of current job until no items left
+// NOTE: Pool lock must be held on call, it is released while callback runs
+static void RLProcessJobBatches(int worker)
+{
+    while (jobs.next < jobs.count)
+    {
+        int start = jobs.next;
+        int end = ((jobs.count - start) > jobs.batchSize)? (start + jobs.batchSize) : jobs.count;
+        jobs.next = end;
+
+        JobRangeCallback callback = jobs.callback;
+        void *userData = jobs.userData;
+
+        JobMutexUnlock(&jobs.lock);
+        callback(userData, start, end, worker);
+        JobMutexLock(&jobs.lock);
+    }
+}
+
+// Worker thread entry point, waits for jobs until pool shutdown
+#if defined(_WIN32)
+static unsigned long __stdcall RLJobWorkerThread(void *arg)
+#else
+static void *RLJobWorkerThread(void *arg)
+#endif
+{
+    int worker = (int)(size_t)arg;
+
+    JobMutexLock(&jobs.lock);
+    unsigned int generation = jobs.startGeneration;
+
+    while (true)
+    {
+        while (!jobs.shutdown && (jobs.generation == generation)) JobCondWait(&jobs.wake, &jobs.lock);
+        if (jobs.shutdown) break;
+
+        generation = jobs.generation;
+        RLProcessJobBatches(worker);
+
+        jobs.pending--;
+        if (jobs.pending == 0) JobCondBroadcast(&jobs.done);
+    }
+
+    JobMutexUnlock(&jobs.lock);
+
+    return 0;
+}
+
+// Background thread entry point, processes queued jobs in order until shutdown
+#if defined(_WIN32)
+static unsigned long __stdcall RLBackgroundJobThread(void *arg)
+#else
+static void *RLBackgroundJobThread(void *arg)
+#endif
+{
+    JobMutexLock(&background.lock);
+
+    while (true)
+    {
+        while (!background.shutdown && (background.count == 0)) JobCondWait(&background.wake, &background.lock);
+        if (background.count == 0) break;   // Shutdown requested and no jobs left
+
+        BackgroundJob job = background.jobs[background.head];
+        background.head = (background.head + 1)%MAX_BACKGROUND_JOBS;
+        background.count--;
+        background.running = true;
+        background.runningCallback = job.callback;
+
+        JobMutexUnlock(&background.lock);
+        job.callback(job.userData);
+        JobMutexLock(&background.lock);
+
+        background.running = false;
+        background.runningCallback = NULL;
+        if (background.count == 0) JobCondBroadcast(&background.done);
+    }
+
+    JobMutexUnlock(&background.lock);
+
+    return 0;
+}
+#endif  // SUPPORT_THREADED_JOBS
@@ -55,7 +55,12 @@
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Parallel job callback, processes items range [start, end) on worker [0..RLGetJobWorkerCount() - 1]
+// NOTE: Worker index can be used to access per-worker scratch data, caller thread is always worker 0
+typedef void (*JobRangeCallback)(void *userData, int start, int end, int worker);
+
+// Background job callback
+typedef void (*JobCallback)(void *userData);
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -69,6 +74,16 @@
 extern "C" {            // Prevents name mangling of functions
 #endif
 
+// Parallel jobs (worker threads pool)
+void RLParallelFor(int count, int batchSize, JobRangeCallback callback, void *userData); // Run callback over [0, count) items range, split in batches across workers
+int RLGetJobWorkerCount(void);                          // Get number of workers available for parallel jobs (including caller thread)
+void RLCloseJobWorkers(void);                           // Stop and join worker threads (restarted on next RLParallelFor() call)
+
+// Background jobs (single background thread, jobs processed in submission order)
+bool RLRunBackgroundJob(JobCallback callback, void *userData, int maxPending); // Queue job on background thread, false if maxPending jobs already pending (0 for no limit)
+int RLGetBackgroundJobCount(JobCallback callback);      // Get number of background jobs pending (queued or running), only jobs using callback if not NULL
+void RLWaitBackgroundJobs(void);                        // Wait for all pending background jobs to be processed
+
 #if defined(PLATFORM_ANDROID)
 void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initialize asset manager from android app
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!